@@ -76,7 +76,9 @@ public:
   /// Function you want to fit to.
   void function(const FunctionDomain &domain,
                 FunctionValues &values) const override;
-  /// Derivatives of function with respect to active parameters
+  /// Derivatives of function with respect to active parameters. Large
+  /// composites differentiate their members in parallel, which must therefore
+  /// not share mutable state.
   void functionDeriv(const FunctionDomain &domain, Jacobian &jacobian) override;
 
   /// Set i-th parameter
@@ -37,6 +37,11 @@ public:
   /// Wrapper for VMD
   Mantid::Kernel::VMD applyVMD(const Mantid::Kernel::VMD &inputVector) const;
 
+  /// Transform a block of points stored one dimension after the other
+  virtual void applyToColumns(const coord_t *inputColumns, coord_t *outColumns,
+                              const size_t numPoints,
+                              const size_t stride) const;
+
   /// @return the number of input dimensions
   size_t getInD() const { return inD; };
 
@@ -68,6 +68,13 @@ public:
                          const uint64_t /*blockPosition*/,
                          const size_t /*BlockSize*/) const = 0;
 
+  /** Hint that a data block will be loaded soon, so that it can be read in
+   * the background. Does nothing unless the IO supports reading ahead */
+  virtual void prefetchBlock(const uint64_t /*blockPosition*/,
+                             const size_t /*BlockSize*/) const {}
+  /** Forget a block requested by prefetchBlock which will not be loaded */
+  virtual void cancelPrefetch(const uint64_t /*blockPosition*/) const {}
+
   /** flush the IO buffers */
   virtual void flushData() const = 0;
   /** Close the file */
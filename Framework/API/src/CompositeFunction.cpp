@@ -7,11 +7,13 @@
 #include "MantidAPI/ParameterTie.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 
 #include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <boost/shared_array.hpp>
+#include <exception>
 #include <sstream>
 
 namespace Mantid {
@@ -20,6 +22,9 @@ namespace API {
 namespace {
 /// static logger
 Kernel::Logger g_log("CompositeFunction");
+/// Members times domain points below which the members are differentiated
+/// serially, as starting the threads would cost more than it saves
+const size_t MIN_PARALLEL_DERIVATIVE_SIZE = 10000;
 } // namespace
 
 using std::size_t;
@@ -155,20 +160,49 @@ void CompositeFunction::function(const FunctionDomain &domain,
 }
 
 /**
- * Derivatives of function with respect to active parameters
+ * Derivatives of function with respect to active parameters.
+ * With enough members and domain points, the members are differentiated in
+ * parallel, so functionDeriv and calNumericalDeriv of a member must not
+ * modify state shared with the other members.
  * @param domain :: Function domain to get the arguments from.
  * @param jacobian :: A Jacobian to store the derivatives.
  */
 void CompositeFunction::functionDeriv(const FunctionDomain &domain,
                                       Jacobian &jacobian) {
-  if (getAttribute("NumDeriv").asBool()) {
+  const bool numericalDeriv = getAttribute("NumDeriv").asBool();
+  // Ties owned by the composite can make a parameter of one member depend on
+  // the parameters of another one, which only a derivative of the whole
+  // function accounts for
+  if (numericalDeriv && !m_ties.empty()) {
     calNumericalDeriv(domain, jacobian);
-  } else {
-    for (size_t iFun = 0; iFun < nFunctions(); ++iFun) {
+    return;
+  }
+
+  // Every member fills the columns of its own parameters, so the members can
+  // be differentiated independently and in parallel. A numerical derivative
+  // only needs to evaluate the member owning the perturbed parameter.
+  const int64_t nFun = static_cast<int64_t>(nFunctions());
+  const bool parallel =
+      nFun > 1 &&
+      nFunctions() * domain.size() >= MIN_PARALLEL_DERIVATIVE_SIZE;
+  std::vector<std::exception_ptr> errors(nFunctions());
+  PARALLEL_FOR_IF(parallel)
+  for (int64_t iFun = 0; iFun < nFun; ++iFun) {
+    try {
       PartialJacobian J(&jacobian, paramOffset(iFun));
-      getFunction(iFun)->functionDeriv(domain, J);
+      if (numericalDeriv) {
+        getFunction(iFun)->calNumericalDeriv(domain, J);
+      } else {
+        getFunction(iFun)->functionDeriv(domain, J);
+      }
+    } catch (...) {
+      errors[iFun] = std::current_exception();
     }
   }
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
 }
 
 /** Sets a new value to the i-th parameter.
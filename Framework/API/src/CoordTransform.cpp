@@ -6,6 +6,7 @@
 #include "MantidKernel/VMD.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
+#include <vector>
 
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
@@ -52,5 +53,29 @@ CoordTransform::applyVMD(const Mantid::Kernel::VMD &inputVector) const {
   return out;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the transformation to a block of points stored by dimension:
+ * coordinate d of point i is at inputColumns[d * stride + i].
+ * This default gathers each point and calls apply(in,out); subclasses
+ * override it with loops over the points that the compiler can vectorise.
+ *
+ * @param inputColumns :: inD columns of input coordinates
+ * @param outColumns :: outD columns, set to the transformed coordinates
+ * @param numPoints :: number of points to transform
+ * @param stride :: distance between the starts of two columns, >= numPoints
+ */
+void CoordTransform::applyToColumns(const coord_t *inputColumns,
+                                    coord_t *outColumns, const size_t numPoints,
+                                    const size_t stride) const {
+  std::vector<coord_t> in(inD), out(outD);
+  for (size_t i = 0; i < numPoints; ++i) {
+    for (size_t d = 0; d < inD; ++d)
+      in[d] = inputColumns[d * stride + i];
+    this->apply(in.data(), out.data());
+    for (size_t d = 0; d < outD; ++d)
+      outColumns[d * stride + i] = out[d];
+  }
+}
+
 } // namespace API
 } // namespace Mantid
@@ -5,6 +5,8 @@
 
 #include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/IFunction1D.h"
 #include "MantidAPI/IPeakFunction.h"
@@ -192,6 +194,41 @@ public:
   }
 };
 
+class CompositeFunctionTest_ThrowingDeriv : public ParamFunction,
+                                            public IFunction1D {
+public:
+  CompositeFunctionTest_ThrowingDeriv() { declareParameter("a"); }
+
+  std::string name() const override {
+    return "CompositeFunctionTest_ThrowingDeriv";
+  }
+
+  void function1D(double *out, const double *,
+                  const size_t nData) const override {
+    std::fill_n(out, nData, getParameter("a"));
+  }
+  void functionDeriv1D(Jacobian *, const double *, const size_t) override {
+    throw std::runtime_error("No derivatives");
+  }
+};
+
+class CompositeFunctionTest_Jacobian : public Jacobian {
+public:
+  CompositeFunctionTest_Jacobian(size_t ny, size_t np) : m_np(np) {
+    m_data.resize(ny * np);
+  }
+  void set(size_t iY, size_t iP, double value) override {
+    m_data[iY * m_np + iP] = value;
+  }
+  double get(size_t iY, size_t iP) override { return m_data[iY * m_np + iP]; }
+  void zero() override { m_data.assign(m_data.size(), 0.0); }
+  const std::vector<double> &data() const { return m_data; }
+
+private:
+  size_t m_np;
+  std::vector<double> m_data;
+};
+
 class CompositeFunctionTest : public CxxTest::TestSuite {
 public:
   static CompositeFunctionTest *createSuite() {
@@ -1206,6 +1243,74 @@ public:
     TS_ASSERT(!b);
   }
 
+  void test_numerical_derivative_differentiates_members_separately() {
+    auto fun = createLinearGaussCubic();
+    fun->setAttributeValue("NumDeriv", true);
+    FunctionDomain1DVector domain(-1.0, 1.0, 21);
+
+    CompositeFunctionTest_Jacobian jacobian(domain.size(), fun->nParams());
+    fun->functionDeriv(domain, jacobian);
+    CompositeFunctionTest_Jacobian expected(domain.size(), fun->nParams());
+    fun->calNumericalDeriv(domain, expected);
+
+    for (size_t i = 0; i < expected.data().size(); ++i) {
+      TS_ASSERT_DELTA(jacobian.data()[i], expected.data()[i],
+                      1e-8 * std::max(1.0, std::abs(expected.data()[i])));
+    }
+  }
+
+  void test_numerical_derivative_with_ties_between_members() {
+    auto fun = createLinearGaussCubic();
+    fun->setAttributeValue("NumDeriv", true);
+    fun->tie("f1.h", "2*f0.a");
+    FunctionDomain1DVector domain(-1.0, 1.0, 21);
+
+    CompositeFunctionTest_Jacobian jacobian(domain.size(), fun->nParams());
+    fun->functionDeriv(domain, jacobian);
+    CompositeFunctionTest_Jacobian expected(domain.size(), fun->nParams());
+    fun->calNumericalDeriv(domain, expected);
+
+    TS_ASSERT_EQUALS(jacobian.data(), expected.data());
+    // The derivative by f0.a includes the change of the tied peak height
+    TS_ASSERT_DIFFERS(jacobian.get(10, 0), 1.0);
+  }
+
+  void test_derivatives_do_not_depend_on_number_of_threads() {
+    auto fun = boost::make_shared<CompositeFunction>();
+    for (size_t i = 0; i < 8; ++i) {
+      auto peak = boost::make_shared<Gauss>();
+      peak->setParameter("c", -1.0 + 0.25 * static_cast<double>(i));
+      peak->setParameter("h", 1.0 + 0.1 * static_cast<double>(i));
+      peak->setParameter("s", 4.0);
+      fun->addFunction(peak);
+    }
+    // Large enough for the members to be differentiated in parallel
+    FunctionDomain1DVector domain(-2.0, 2.0, 2001);
+
+    for (auto numDeriv : {false, true}) {
+      fun->setAttributeValue("NumDeriv", numDeriv);
+      CompositeFunctionTest_Jacobian serial(domain.size(), fun->nParams());
+      CompositeFunctionTest_Jacobian parallel(domain.size(), fun->nParams());
+      FrameworkManager::Instance().setNumOMPThreads(1);
+      fun->functionDeriv(domain, serial);
+      FrameworkManager::Instance().setNumOMPThreads(4);
+      fun->functionDeriv(domain, parallel);
+      FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+      TS_ASSERT_EQUALS(parallel.data(), serial.data());
+    }
+  }
+
+  void test_error_in_member_derivative_is_rethrown() {
+    CompositeFunction fun;
+    fun.addFunction(boost::make_shared<Linear>());
+    fun.addFunction(boost::make_shared<CompositeFunctionTest_ThrowingDeriv>());
+    fun.addFunction(boost::make_shared<Linear>());
+    FunctionDomain1DVector domain(-1.0, 1.0, 11);
+    CompositeFunctionTest_Jacobian jacobian(domain.size(), fun.nParams());
+    TS_ASSERT_THROWS(fun.functionDeriv(domain, jacobian),
+                     const std::runtime_error &);
+  }
+
   void test_local_name() {
     std::string funStr = "name=Linear;(name=Linear;(name=Linear;name=Linear))";
     auto fun = boost::dynamic_pointer_cast<CompositeFunction>(
@@ -1230,6 +1335,66 @@ public:
     TS_ASSERT_EQUALS(fun->parameterLocalName(4, true), "a");
     TS_ASSERT_EQUALS(fun->parameterLocalName(6, true), "a");
   }
+
+private:
+  CompositeFunction_sptr createLinearGaussCubic() {
+    auto fun = boost::make_shared<CompositeFunction>();
+    auto linear = boost::make_shared<Linear>();
+    linear->setParameter("a", 0.5);
+    linear->setParameter("b", 0.2);
+    fun->addFunction(linear);
+    auto gauss = boost::make_shared<Gauss>();
+    gauss->setParameter("c", 0.1);
+    gauss->setParameter("h", 1.5);
+    gauss->setParameter("s", 3.0);
+    fun->addFunction(gauss);
+    auto cubic = boost::make_shared<Cubic>();
+    cubic->setParameter("c0", 0.1);
+    cubic->setParameter("c1", 0.2);
+    cubic->setParameter("c2", 0.3);
+    cubic->setParameter("c3", 0.4);
+    fun->addFunction(cubic);
+    return fun;
+  }
+};
+
+class CompositeFunctionTestPerformance : public CxxTest::TestSuite {
+public:
+  static CompositeFunctionTestPerformance *createSuite() {
+    return new CompositeFunctionTestPerformance();
+  }
+  static void destroySuite(CompositeFunctionTestPerformance *suite) {
+    delete suite;
+  }
+
+  CompositeFunctionTestPerformance()
+      : m_domain(0.0, 100.0, 20000),
+        m_fun(boost::make_shared<CompositeFunction>()) {
+    for (size_t i = 0; i < 200; ++i) {
+      auto peak = boost::make_shared<Gauss>();
+      peak->setParameter("c", 0.5 * static_cast<double>(i));
+      peak->setParameter("h", 1.0);
+      peak->setParameter("s", 10.0);
+      m_fun->addFunction(peak);
+    }
+    m_fun->setAttributeValue("NumDeriv", true);
+  }
+
+  void test_numerical_derivative_of_many_peaks() {
+    CompositeFunctionTest_Jacobian jacobian(m_domain.size(), m_fun->nParams());
+    m_fun->functionDeriv(m_domain, jacobian);
+  }
+
+  void test_numerical_derivative_of_many_peaks_single_thread() {
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    CompositeFunctionTest_Jacobian jacobian(m_domain.size(), m_fun->nParams());
+    m_fun->functionDeriv(m_domain, jacobian);
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  }
+
+private:
+  FunctionDomain1DVector m_domain;
+  CompositeFunction_sptr m_fun;
 };
 
 #endif /*COMPOSITEFUNCTIONTEST_H_*/
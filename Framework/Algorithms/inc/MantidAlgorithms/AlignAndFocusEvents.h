@@ -0,0 +1,63 @@
+#ifndef MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_
+#define MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/System.h"
+
+namespace Mantid {
+namespace Algorithms {
+
+/** AlignAndFocusEvents : Converts the events of an event workspace or file to
+  d-spacing, groups and histograms them in a single pass, producing the same
+  focused histograms as AlignDetectors, DiffractionFocussing and Rebin without
+  creating the intermediate event workspaces.
+
+  When reading from a file the banks are loaded on demand and freed again
+  once they have been histogrammed, so the memory use scales with the size of
+  the output rather than with the number of events.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport AlignAndFocusEvents : public API::Algorithm {
+public:
+  const std::string name() const override;
+  int version() const override;
+  const std::vector<std::string> seeAlso() const override {
+    return {"AlignDetectors", "DiffractionFocussing", "Rebin",
+            "AlignAndFocusPowder"};
+  }
+  const std::string category() const override;
+  const std::string summary() const override;
+  std::map<std::string, std::string> validateInputs() override;
+
+private:
+  void init() override;
+  void exec() override;
+
+  DataObjects::EventWorkspace_const_sptr getInputWorkspace();
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTS_H_ */
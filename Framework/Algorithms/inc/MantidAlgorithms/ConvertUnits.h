@@ -6,6 +6,9 @@
 #include "MantidKernel/Unit.h"
 
 namespace Mantid {
+namespace Geometry {
+class CompactParameterMap;
+}
 namespace Algorithms {
 /** Converts the units in which a workspace is represented.
     Only implemented for histogram data, so far.
@@ -121,9 +124,9 @@ protected:
   /// Internal function to gather detector specific L2, theta and efixed values
   bool getDetectorValues(const API::SpectrumInfo &spectrumInfo,
                          const Kernel::Unit &outputUnit, int emode,
-                         const API::MatrixWorkspace &ws, const bool signedTheta,
-                         int64_t wsIndex, double &efixed, double &l2,
-                         double &twoTheta);
+                         const Geometry::CompactParameterMap *parameters,
+                         const bool signedTheta, int64_t wsIndex,
+                         double &efixed, double &l2, double &twoTheta);
 
   /// Convert the workspace units using TOF as an intermediate step in the
   /// conversion
@@ -127,6 +127,12 @@ private:
   /// Filter events by splitters in format of vector
   void filterEventsByVectorSplitters(double progressamount);
 
+  /// Compile the splitters into sorted boundaries and output indices
+  void compileSortedSplitters();
+
+  /// Split the events of one spectrum with the compiled splitters
+  void splitSpectrumBySortedSplitters(const size_t wsIndex);
+
   /// Examine workspace
   void examineAndSortEventWS();
 
@@ -213,6 +219,13 @@ private:
   /// Vector for splitting grouip
   std::vector<int> m_vecSplitterGroup;
 
+  /// Sorted boundaries of the splitters for EventList::splitByFullTimeSorted
+  std::vector<int64_t> m_sortedSplitterTimes;
+  /// Index into m_sortedSplitterOutputs of each of the sorted splitters
+  std::vector<size_t> m_sortedSplitterTargets;
+  /// Output workspaces indexed by the sorted splitter targets
+  std::vector<DataObjects::EventWorkspace *> m_sortedSplitterOutputs;
+
   /// Flag to split sample logs
   bool m_splitSampleLogs;
 
@@ -111,9 +111,13 @@ private:
   /// suites of method to fit peaks
   std::vector<boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> fitPeaks();
 
+  /// create the Fit algorithm used for the peaks of one spectrum
+  API::IAlgorithm_sptr createPeakFitter();
+
   /// fit peaks in a same spectrum
   void fitSpectrumPeaks(
       size_t wi, const std::vector<double> &expected_peak_centers,
+      API::IAlgorithm_sptr peak_fitter,
       boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result);
 
   /// fit background
@@ -4,6 +4,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
 #include <tuple>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -25,6 +26,9 @@ class IBeamProfile;
   The error on all points is defined to be \f$\frac{1}{\sqrt{N}}\f$, where N is
   the number of events generated.
 
+  The correction can also be calculated for several wavelengths at once from
+  a single set of events, whose tracks are then generated only once.
+
   Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
   National Laboratory & European Spallation Source
 
@@ -55,6 +59,10 @@ public:
                                        const Kernel::V3D &finalPos,
                                        double lambdaBefore,
                                        double lambdaAfter) const;
+  std::vector<double> calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                                const Kernel::V3D &finalPos,
+                                const std::vector<double> &lambdasBefore,
+                                const std::vector<double> &lambdasAfter) const;
 
 private:
   const IBeamProfile &m_beamProfile;
@@ -0,0 +1,371 @@
+#include "MantidAlgorithms/AlignAndFocusEvents.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceUnitValidator.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/Diffraction.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RebinParamsValidator.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace API;
+using namespace DataObjects;
+using namespace Kernel;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(AlignAndFocusEvents)
+
+namespace {
+/// Diffractometer constants, TOF = DIFC * d + DIFA * d^2 + TZERO
+struct DiffConstants {
+  double difc{0.};
+  double difa{0.};
+  double tzero{0.};
+};
+
+/// @return the constants of each detector in the calibration table, DIFC is
+/// zero for detectors without a row
+std::vector<DiffConstants>
+constantsFromTable(const ITableWorkspace &table,
+                   const Geometry::DetectorInfo &detectorInfo) {
+  std::vector<DiffConstants> constants(detectorInfo.size());
+  ConstColumnVector<int> detIDs = table.getVector("detid");
+  auto difcCol = table.getColumn("difc");
+  auto difaCol = table.getColumn("difa");
+  auto tzeroCol = table.getColumn("tzero");
+  for (size_t row = 0; row < detIDs.size(); ++row) {
+    size_t index;
+    try {
+      index = detectorInfo.indexOf(detIDs[row]);
+    } catch (std::out_of_range &) {
+      continue; // not in this instrument
+    }
+    constants[index].difc = difcCol->toDouble(row);
+    constants[index].difa = difaCol->toDouble(row);
+    constants[index].tzero = tzeroCol->toDouble(row);
+  }
+  return constants;
+}
+
+/// @return the DIFC of each detector from the instrument geometry
+std::vector<DiffConstants>
+constantsFromGeometry(const Geometry::DetectorInfo &detectorInfo) {
+  std::vector<DiffConstants> constants(detectorInfo.size());
+  const double l1 = detectorInfo.l1();
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    if (detectorInfo.isMonitor(i))
+      continue;
+    // tofToDSpacingFactor gives 1/DIFC
+    constants[i].difc =
+        1. / Geometry::Conversion::tofToDSpacingFactor(
+                 l1, detectorInfo.l2(i), detectorInfo.twoTheta(i), 0.);
+  }
+  return constants;
+}
+} // namespace
+
+/// Algorithms name for identification. @see Algorithm::name
+const std::string AlignAndFocusEvents::name() const {
+  return "AlignAndFocusEvents";
+}
+
+/// Algorithm's version for identification. @see Algorithm::version
+int AlignAndFocusEvents::version() const { return 1; }
+
+/// Algorithm's category for identification. @see Algorithm::category
+const std::string AlignAndFocusEvents::category() const {
+  return "Diffraction\\Focussing";
+}
+
+/// Algorithm's summary for use in the GUI and help. @see Algorithm::summary
+const std::string AlignAndFocusEvents::summary() const {
+  return "Converts events to d-spacing, focuses and histograms them in a "
+         "single pass, reading one bank of a file at a time.";
+}
+
+//----------------------------------------------------------------------------------------------
+/** Initialize the algorithm's properties.
+ */
+void AlignAndFocusEvents::init() {
+  declareProperty(
+      make_unique<WorkspaceProperty<EventWorkspace>>(
+          "InputWorkspace", "", Direction::Input, PropertyMode::Optional,
+          boost::make_shared<WorkspaceUnitValidator>("TOF")),
+      "An event workspace with units of TOF. Specify either this or a "
+      "Filename.");
+  declareProperty(
+      make_unique<FileProperty>("Filename", "", FileProperty::OptionalLoad,
+                                std::vector<std::string>{"_event.nxs",
+                                                         ".nxs.h5", ".nxs"}),
+      "An event Nexus file, read one bank at a time. Specify either this or "
+      "an InputWorkspace.");
+  auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
+  mustBePositive->setLower(1);
+  declareProperty("MaxBanksInMemory", 1, mustBePositive,
+                  "The number of banks of the file to keep in memory.");
+  declareProperty(make_unique<WorkspaceProperty<ITableWorkspace>>(
+                      "CalibrationWorkspace", "", Direction::Input,
+                      PropertyMode::Optional),
+                  "A table with the columns detid, difc, difa and tzero. If "
+                  "not given, DIFC is calculated from the instrument "
+                  "geometry.");
+  declareProperty(make_unique<WorkspaceProperty<GroupingWorkspace>>(
+                      "GroupingWorkspace", "", Direction::Input),
+                  "The group of each detector; the output has one spectrum "
+                  "per group.");
+  declareProperty(
+      make_unique<ArrayProperty<double>>(
+          "Params", boost::make_shared<RebinParamsValidator>()),
+      "The d-spacing binning as in Rebin. The first and last values are "
+      "required as the range of the data is not known in advance.");
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The focused workspace in d-spacing.");
+}
+
+/// Cross-check properties with each other @see IAlgorithm::validateInputs
+std::map<std::string, std::string> AlignAndFocusEvents::validateInputs() {
+  std::map<std::string, std::string> result;
+
+  const bool haveWorkspace = !isDefault("InputWorkspace");
+  const bool haveFile = !isDefault("Filename");
+  if (haveWorkspace == haveFile) {
+    const std::string msg = "Specify either an InputWorkspace or a Filename";
+    result["InputWorkspace"] = msg;
+    result["Filename"] = msg;
+  }
+
+  const std::vector<double> params = getProperty("Params");
+  if (params.size() < 3)
+    result["Params"] = "The start and end of the binning are required";
+
+  return result;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Execute the algorithm.
+ */
+void AlignAndFocusEvents::exec() {
+  const auto inputWS = getInputWorkspace();
+  GroupingWorkspace_const_sptr groupingWS = getProperty("GroupingWorkspace");
+  ITableWorkspace_const_sptr calibrationWS =
+      getProperty("CalibrationWorkspace");
+
+  const std::vector<double> params = getProperty("Params");
+  std::vector<double> edges;
+  VectorHelper::createAxisFromRebinParams(params, edges);
+  const size_t numBins = edges.size() - 1;
+
+  const auto &detectorInfo = inputWS->detectorInfo();
+  const auto constants = calibrationWS
+                             ? constantsFromTable(*calibrationWS, detectorInfo)
+                             : constantsFromGeometry(detectorInfo);
+
+  std::vector<int> detIDToGroup;
+  int64_t maxGroup;
+  groupingWS->makeDetectorIDToGroupVector(detIDToGroup, maxGroup);
+  if (maxGroup <= 0)
+    throw std::runtime_error("No groups were specified.");
+
+  // Find the group and constants of each spectrum from the instrument only,
+  // accessing the events would load the banks.
+  const auto &spectrumInfo = inputWS->spectrumInfo();
+  const auto &detIDs = detectorInfo.detectorIDs();
+  const size_t numSpectra = inputWS->getNumberHistograms();
+  std::vector<int> groupOfSpectrum(numSpectra, 0);
+  std::vector<DiffConstants> spectrumConstants(numSpectra);
+  std::map<int, std::set<detid_t>> groupDetectors;
+  size_t numUncalibrated{0};
+  for (size_t i = 0; i < numSpectra; ++i) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i))
+      continue;
+    const auto &spectrumDefinition = spectrumInfo.spectrumDefinition(i);
+    const detid_t firstID = detIDs[spectrumDefinition[0].first];
+    if (firstID < 0 || static_cast<size_t>(firstID) >= detIDToGroup.size() ||
+        detIDToGroup[firstID] <= 0)
+      continue;
+
+    // Average the constants of the detectors, as AlignDetectors does
+    DiffConstants average;
+    size_t numCalibrated{0};
+    for (const auto &index : spectrumDefinition) {
+      const auto &detector = constants[index.first];
+      if (detector.difc == 0.)
+        continue;
+      average.difc += detector.difc;
+      average.difa += detector.difa;
+      average.tzero += detector.tzero;
+      ++numCalibrated;
+    }
+    if (numCalibrated == 0) {
+      ++numUncalibrated;
+      continue;
+    }
+    const double norm = 1. / static_cast<double>(numCalibrated);
+    average.difc *= norm;
+    average.difa *= norm;
+    average.tzero *= norm;
+
+    groupOfSpectrum[i] = detIDToGroup[firstID];
+    spectrumConstants[i] = average;
+    auto &dets = groupDetectors[groupOfSpectrum[i]];
+    for (const auto &index : spectrumDefinition)
+      dets.insert(detIDs[index.first]);
+  }
+  if (numUncalibrated > 0)
+    g_log.warning() << numUncalibrated
+                    << " spectra have no calibration and are skipped.\n";
+  if (groupDetectors.empty())
+    throw std::runtime_error("No calibrated spectra belong to any group.");
+
+  std::map<int, size_t> outputIndex;
+  for (const auto &group : groupDetectors)
+    outputIndex.emplace(group.first, outputIndex.size());
+  const size_t numGroups = outputIndex.size();
+
+  // Counts and squared errors of all groups, accumulated by each thread
+  const size_t numThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<double>> counts(
+      numThreads, std::vector<double>(numGroups * numBins, 0.));
+  std::vector<std::vector<double>> errorsSquared(counts);
+
+  size_t numNotMonotonic{0};
+  Progress progress(this, 0.1, 1.0, numSpectra);
+  const auto focus = [&](const size_t i, const EventList &events) {
+    const int group = groupOfSpectrum[i];
+    if (group > 0) {
+      // Histogram the events with the bin edges converted to TOF, which
+      // needs no conversion of the events themselves
+      const auto &c = spectrumConstants[i];
+      const auto toTof =
+          Diffraction::getDToTofConversionFunc(c.difc, c.difa, c.tzero);
+      MantidVec tofEdges(edges.size());
+      std::transform(edges.cbegin(), edges.cend(), tofEdges.begin(), toTof);
+      // Also catches NaN, e.g. beyond the turning point for negative DIFA
+      const auto notIncreasing = [](double a, double b) { return !(a < b); };
+      if (std::adjacent_find(tofEdges.cbegin(), tofEdges.cend(),
+                             notIncreasing) != tofEdges.cend()) {
+        PARALLEL_ATOMIC
+        ++numNotMonotonic;
+      } else {
+        MantidVec y, e;
+        events.generateHistogram(tofEdges, y, e);
+        const size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+        const size_t offset = outputIndex.at(group) * numBins;
+        auto &threadCounts = counts[thread];
+        auto &threadErrors = errorsSquared[thread];
+        for (size_t bin = 0; bin < numBins; ++bin) {
+          threadCounts[offset + bin] += y[bin];
+          threadErrors[offset + bin] += e[bin] * e[bin];
+        }
+      }
+    }
+    progress.report();
+  };
+
+  // While banks are loaded on demand, each bank is pinned in memory while its
+  // spectra are focused and can be freed again afterwards.
+  const size_t numBanks = inputWS->numLazyEventBanks();
+  for (size_t bank = 0; bank < numBanks; ++bank) {
+    const auto pin = inputWS->pinLazyEventBank(bank);
+    const auto &indices = inputWS->spectraOfLazyEventBank(bank);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t j = 0; j < static_cast<int64_t>(indices.size()); ++j) {
+      PARALLEL_START_INTERUPT_REGION
+      focus(indices[j], pin.spectrum(indices[j]));
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  }
+  if (numBanks > 0) {
+    // The spectra outside the banks are always in memory
+    for (const auto i :
+         inputWS->spectraOfLazyEventBank(LazyEventBanks::NO_BANK))
+      focus(i, inputWS->getSpectrum(i));
+  } else {
+    PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS))
+    for (int64_t i = 0; i < static_cast<int64_t>(numSpectra); ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      focus(static_cast<size_t>(i),
+            inputWS->getSpectrum(static_cast<size_t>(i)));
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  }
+  if (numNotMonotonic > 0)
+    g_log.warning() << numNotMonotonic
+                    << " spectra are skipped since their TOF is not "
+                       "monotonic in the d-spacing range.\n";
+
+  MatrixWorkspace_sptr outputWS = create<Workspace2D>(
+      *inputWS, numGroups, HistogramData::BinEdges(std::move(edges)));
+  for (const auto &group : outputIndex) {
+    const size_t index = group.second;
+    auto &spectrum = outputWS->getSpectrum(index);
+    spectrum.setSpectrumNo(group.first);
+    spectrum.setDetectorIDs(std::move(groupDetectors[group.first]));
+
+    auto &y = outputWS->mutableY(index);
+    auto &e = outputWS->mutableE(index);
+    for (size_t bin = 0; bin < numBins; ++bin) {
+      double count{0.};
+      double errorSquared{0.};
+      for (size_t thread = 0; thread < numThreads; ++thread) {
+        count += counts[thread][index * numBins + bin];
+        errorSquared += errorsSquared[thread][index * numBins + bin];
+      }
+      y[bin] = count;
+      e[bin] = std::sqrt(errorSquared);
+    }
+  }
+  outputWS->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+
+  setProperty("OutputWorkspace", outputWS);
+}
+
+/** Get the input workspace, or load the file with its banks loaded on demand
+ * so that only MaxBanksInMemory banks are held at a time.
+ * @return the event workspace
+ */
+EventWorkspace_const_sptr AlignAndFocusEvents::getInputWorkspace() {
+  EventWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  if (inputWS)
+    return inputWS;
+
+  const int maxBanksInMemory = getProperty("MaxBanksInMemory");
+  auto load = createChildAlgorithm("LoadEventNexus", 0., 0.1);
+  load->setPropertyValue("Filename", getPropertyValue("Filename"));
+  load->setProperty("LoadBanksOnDemand", true);
+  load->setProperty("MaxBanksInMemory", maxBanksInMemory);
+  load->setProperty("LoadMonitors", false);
+  load->executeAsChildAlg();
+  Workspace_sptr loaded = load->getProperty("OutputWorkspace");
+  auto eventWS = boost::dynamic_pointer_cast<const EventWorkspace>(loaded);
+  if (!eventWS)
+    throw std::runtime_error("The file did not contain a single event "
+                             "workspace.");
+  if (!eventWS->hasLazyEventBanks())
+    g_log.information() << "The banks of the file could not be loaded on "
+                           "demand, all events are held in memory.\n";
+  return eventWS;
+}
+
+} // namespace Algorithms
+} // namespace Mantid
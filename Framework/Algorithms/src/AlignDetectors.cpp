@@ -46,10 +46,34 @@ public:
 
   std::function<double(double)>
   getConversionFunc(const std::set<detid_t> &detIds) const {
+    double difc, difa, tzero;
+    getDiffConstants(detIds, difc, difa, tzero);
+    return Kernel::Diffraction::getTofToDConversionFunc(difc, difa, tzero);
+  }
+
+  /** Get the linear conversion d = factor * tof + offset, which is what
+   * getConversionFunc applies when there is no difa term.
+   * @return false if the conversion is not linear
+   */
+  bool getLinearConversion(const std::set<detid_t> &detIds, double &factor,
+                           double &offset) const {
+    double difc, difa, tzero;
+    getDiffConstants(detIds, difc, difa, tzero);
+    if (difa != 0. || difc == 0.)
+      return false;
+    factor = 1. / difc;
+    offset = -1. * tzero / difc;
+    return true;
+  }
+
+private:
+  /// Average the diffractometer constants of the detectors
+  void getDiffConstants(const std::set<detid_t> &detIds, double &difc,
+                        double &difa, double &tzero) const {
     const std::set<size_t> rows = this->getRow(detIds);
-    double difc = 0.;
-    double difa = 0.;
-    double tzero = 0.;
+    difc = 0.;
+    difa = 0.;
+    tzero = 0.;
     for (auto row : rows) {
       difc += m_difcCol->toDouble(row);
       difa += m_difaCol->toDouble(row);
@@ -61,11 +85,8 @@ public:
       difa = norm * difa;
       tzero = norm * tzero;
     }
-
-    return Kernel::Diffraction::getTofToDConversionFunc(difc, difa, tzero);
   }
 
-private:
   void generateDetidToRow(ITableWorkspace_const_sptr table) {
     ConstColumnVector<int> detIDs = table->getVector("detid");
     const size_t numDets = detIDs.size();
@@ -278,10 +299,16 @@ void AlignDetectors::align(const ConversionFactors &converter,
     try {
       // Get the input spectrum number at this workspace index
       auto &spec = outputWS.getSpectrum(size_t(i));
-      auto toDspacing = converter.getConversionFunc(spec.getDetectorIDs());
-
       auto &x = outputWS.mutableX(i);
-      std::transform(x.begin(), x.end(), x.begin(), toDspacing);
+      double factor, offset;
+      if (converter.getLinearConversion(spec.getDetectorIDs(), factor,
+                                        offset)) {
+        std::transform(x.begin(), x.end(), x.begin(),
+                       [=](double tof) { return factor * tof + offset; });
+      } else {
+        auto toDspacing = converter.getConversionFunc(spec.getDetectorIDs());
+        std::transform(x.begin(), x.end(), x.begin(), toDspacing);
+      }
     } catch (Exception::NotFoundError &) {
       // Zero the data in this case
       outputWS.setHistogram(i, BinEdges(outputWS.x(i).size()),
@@ -299,9 +326,14 @@ void AlignDetectors::align(const ConversionFactors &converter,
   for (int64_t i = 0; i < m_numberOfSpectra; ++i) {
     PARALLEL_START_INTERUPT_REGION
 
-    auto toDspacing = converter.getConversionFunc(
-        outputWS.getSpectrum(size_t(i)).getDetectorIDs());
-    outputWS.getSpectrum(i).convertTof(toDspacing);
+    auto &spec = outputWS.getSpectrum(size_t(i));
+    double factor, offset;
+    if (converter.getLinearConversion(spec.getDetectorIDs(), factor, offset)) {
+      // Avoids a call through std::function for every event
+      spec.convertTof(factor, offset);
+    } else {
+      spec.convertTof(converter.getConversionFunc(spec.getDetectorIDs()));
+    }
 
     progress.report();
     PARALLEL_END_INTERUPT_REGION
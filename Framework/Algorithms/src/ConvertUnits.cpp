@@ -9,11 +9,13 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/CompactParameterMap.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidParallel/Communicator.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
 #include <numeric>
 
@@ -393,7 +395,8 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
  * @param spectrumInfo :: SpectrumInfo of the workspace
  * @param outputUnit :: The output unit
  * @param emode :: The energy mode
- * @param ws :: The workspace
+ * @param parameters :: The instrument parameters to look up efixed in, only
+ * needed for an indirect instrument without a given efixed
  * @param signedTheta :: Return twotheta with sign or without
  * @param wsIndex :: The workspace index
  * @param efixed :: the returned fixed energy
@@ -401,12 +404,11 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
  * @param twoTheta :: the returned two theta angle
  * @returns true if lookup successful, false on error
  */
-bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
-                                     const Kernel::Unit &outputUnit, int emode,
-                                     const MatrixWorkspace &ws,
-                                     const bool signedTheta, int64_t wsIndex,
-                                     double &efixed, double &l2,
-                                     double &twoTheta) {
+bool ConvertUnits::getDetectorValues(
+    const API::SpectrumInfo &spectrumInfo, const Kernel::Unit &outputUnit,
+    int emode, const Geometry::CompactParameterMap *parameters,
+    const bool signedTheta, int64_t wsIndex, double &efixed, double &l2,
+    double &twoTheta) {
   if (!spectrumInfo.hasDetectors(wsIndex))
     return false;
 
@@ -419,15 +421,17 @@ bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
     else
       twoTheta = spectrumInfo.twoTheta(wsIndex);
     // If an indirect instrument, try getting Efixed from the geometry
-    if (emode == 2 && efixed == EMPTY_DBL()) // indirect
+    if (emode == 2 && efixed == EMPTY_DBL() && parameters) // indirect
     {
       if (spectrumInfo.hasUniqueDetector(wsIndex)) {
-        const auto &det = spectrumInfo.detector(wsIndex);
-        auto par = ws.constInstrumentParameters().getRecursive(&det, "Efixed");
+        // The component index of a detector is its detector index
+        const size_t detIndex =
+            spectrumInfo.spectrumDefinition(wsIndex)[0].first;
+        auto par = parameters->getRecursive(detIndex, "Efixed");
         if (par) {
           efixed = par->value<double>();
-          g_log.debug() << "Detector: " << det.getID() << " EFixed: " << efixed
-                        << "\n";
+          g_log.debug() << "Workspace index: " << wsIndex
+                        << " EFixed: " << efixed << "\n";
         }
       }
       // Non-unique detector (i.e., DetectorGroup): use single provided value
@@ -515,13 +519,20 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
   auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
 
+  // Snapshot of the parameters for looking up efixed of each detector
+  std::unique_ptr<const CompactParameterMap> efixedParameters;
+  if (emode == 2 && efixedProp == EMPTY_DBL())
+    efixedParameters = Kernel::make_unique<CompactParameterMap>(
+        inputWS->constInstrumentParameters(), inputWS->componentInfo());
+
   // Perform Sanity Validation before creating workspace
   double checkefixed = efixedProp;
   double checkl2;
   double checktwoTheta;
   size_t checkIndex = 0;
-  if (getDetectorValues(spectrumInfo, *outputUnit, emode, *inputWS, signedTheta,
-                        checkIndex, checkefixed, checkl2, checktwoTheta)) {
+  if (getDetectorValues(spectrumInfo, *outputUnit, emode,
+                        efixedParameters.get(), signedTheta, checkIndex,
+                        checkefixed, checkl2, checktwoTheta)) {
     const double checkdelta = 0.0;
     // copy the X values for the check
     auto checkXValues = inputWS->readX(checkIndex);
@@ -547,8 +558,9 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     // Now get the detector object for this histogram
     double l2;
     double twoTheta;
-    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
-                          signedTheta, i, efixed, l2, twoTheta)) {
+    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode,
+                          efixedParameters.get(), signedTheta, i, efixed, l2,
+                          twoTheta)) {
 
       /// @todo Don't yet consider hold-off (delta)
       const double delta = 0.0;
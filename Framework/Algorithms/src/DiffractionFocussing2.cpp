@@ -8,6 +8,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/EventWorkspaceHelpers.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidHistogramData/LogarithmicGenerator.h"
@@ -378,49 +379,28 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
+  const int nValidGroups = static_cast<int>(this->m_validGroups.size());
+  if (nValidGroups < PARALLEL_GET_MAX_THREADS) {
+    // ------ PARALLELIZE WITHIN GROUPS -------------------------
+    // Too few groups to keep all threads busy, so the spectra of each group
+    // are summed by all threads into partial lists that are then joined
+    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
+      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
+      EventWorkspaceHelpers::appendEventLists(*m_eventW, indices,
+                                              out->getSpectrum(iGroup));
+      prog->reportIncrement(indices.size(), "Appending Lists");
+
+      // When focussing in place, you can clear out old memory from the input
+      // one!
+      if (inPlace) {
+        auto inputWS = boost::const_pointer_cast<EventWorkspace>(m_eventW);
+        for (auto wi : indices)
+          inputWS->getSpectrum(wi).clear();
       }
-
-      PARALLEL_END_INTERUPT_REGION
+      interruption_point();
     }
-    PARALLEL_CHECK_INTERUPT_REGION
   } else {
     // ------ PARALLELIZE BY GROUPS -------------------------
-
-    int nValidGroups = static_cast<int>(this->m_validGroups.size());
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
     for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
       PARALLEL_START_INTERUPT_REGION
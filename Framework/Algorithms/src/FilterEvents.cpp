@@ -24,6 +24,8 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <sstream>
 
@@ -58,7 +60,9 @@ FilterEvents::FilterEvents()
       m_wsNames(), m_detTofOffsets(), m_detTofFactors(),
       m_filterByPulseTime(false), m_informationWS(), m_hasInfoWS(),
       m_progress(0.), m_outputWSNameBase(), m_toGroupWS(false),
-      m_vecSplitterTime(), m_vecSplitterGroup(), m_splitSampleLogs(false),
+      m_vecSplitterTime(), m_vecSplitterGroup(), m_sortedSplitterTimes(),
+      m_sortedSplitterTargets(), m_sortedSplitterOutputs(),
+      m_splitSampleLogs(false),
       m_useDBSpectrum(false), m_dbWSIndex(-1), m_tofCorrType(),
       m_specSkipType(), m_vecSkip(), m_isSplittersRelativeTime(false),
       m_filterStartTime(0), m_runStartTime(0) {}
@@ -1586,34 +1590,27 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
   g_log.debug() << "Number of spectra in input/source EventWorkspace = "
                 << numberOfSpectra << ".\n";
 
-  // FIXME - Turn on parallel:
+  if (!m_filterByPulseTime)
+    compileSortedSplitters();
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t iws = 0; iws < int64_t(numberOfSpectra); ++iws) {
     PARALLEL_START_INTERUPT_REGION
 
     // Filter the non-skipped
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      std::map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
+      if (m_filterByPulseTime) {
+        // Get the output event lists (should be empty) to be a map
+        std::map<int, DataObjects::EventList *> outputs;
         for (auto &ws : m_outputWorkspacesMap) {
           int index = ws.first;
           auto &output_el = ws.second->getSpectrum(iws);
           outputs.emplace(index, &output_el);
         }
-      }
-      // Get a holder on input workspace's event list of this spectrum
-      const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
-
-      // Perform the filtering (using the splitting function and just one
-      // output)
-      if (m_filterByPulseTime) {
+        const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
         input_el.splitByPulseTime(m_splitters, outputs);
-      } else if (m_tofCorrType != NoneCorrect) {
-        input_el.splitByFullTime(m_splitters, outputs, true,
-                                 m_detTofFactors[iws], m_detTofOffsets[iws]);
       } else {
-        input_el.splitByFullTime(m_splitters, outputs, false, 1.0, 0.0);
+        splitSpectrumBySortedSplitters(static_cast<size_t>(iws));
       }
     }
 
@@ -1659,43 +1656,26 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
                     "by pulse time.");
   }
 
+  compileSortedSplitters();
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t iws = 0; iws < int64_t(numberOfSpectra); ++iws) {
     PARALLEL_START_INTERUPT_REGION
 
     // Filter the non-skipped spectrum
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
-      }
-
-      // Get a holder on input workspace's event list of this spectrum
-      const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
-
-      bool printdetail = false;
-      if (m_useDBSpectrum)
-        printdetail = (iws == static_cast<int64_t>(m_dbWSIndex));
-
-      // Perform the filtering (using the splitting function and just one
-      // output)
-      std::string logmessage;
-      if (m_tofCorrType != NoneCorrect) {
-        logmessage = input_el.splitByFullTimeMatrixSplitter(
-            m_vecSplitterTime, m_vecSplitterGroup, outputs, true,
-            m_detTofFactors[iws], m_detTofOffsets[iws]);
-      } else {
-        logmessage = input_el.splitByFullTimeMatrixSplitter(
-            m_vecSplitterTime, m_vecSplitterGroup, outputs, false, 1.0, 0.0);
+      splitSpectrumBySortedSplitters(static_cast<size_t>(iws));
+
+      if (m_useDBSpectrum && iws == static_cast<int64_t>(m_dbWSIndex)) {
+        std::stringstream msgss;
+        msgss << "Spectrum " << iws << " with "
+              << m_eventWS->getSpectrum(iws).getNumberEvents()
+              << " events is split into";
+        for (const auto ws : m_sortedSplitterOutputs)
+          msgss << " " << ws->getSpectrum(iws).getNumberEvents();
+        msgss << " events.";
+        g_log.notice(msgss.str());
       }
-
-      if (printdetail)
-        g_log.notice(logmessage);
     }
 
     PARALLEL_END_INTERUPT_REGION
@@ -1723,6 +1703,87 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
   return;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Compile the splitters into one sorted array of boundaries and the index of
+ * the output workspace of each splitter, so that splitting a spectrum needs
+ * neither a map of its outputs nor a lookup per event.
+ * Every splitter is the half-open interval [start, stop).
+ * With a SplittersWorkspace, the events before and between the splitters go to
+ * the unfiltered workspace (-1) and those after the last splitter are
+ * discarded. Without any splitter, all the events go to the unfiltered
+ * workspace, as splitByFullTime() did. With the vector splitters, the events
+ * outside the splitters are discarded, and so are all the events if there is
+ * no splitter. Splitters whose target has no output workspace are discarded.
+ */
+void FilterEvents::compileSortedSplitters() {
+  m_sortedSplitterOutputs.clear();
+  std::map<int, size_t> outputIndex;
+  for (auto &ws : m_outputWorkspacesMap) {
+    outputIndex.emplace(ws.first, m_sortedSplitterOutputs.size());
+    m_sortedSplitterOutputs.push_back(ws.second.get());
+  }
+  const auto targetOf = [&outputIndex](const int group) {
+    auto it = outputIndex.find(group);
+    return it == outputIndex.end() ? outputIndex.size() : it->second;
+  };
+
+  m_sortedSplitterTimes.clear();
+  m_sortedSplitterTargets.clear();
+  if (m_useSplittersWorkspace) {
+    const size_t unfiltered = targetOf(-1);
+    m_sortedSplitterTimes.reserve(2 * m_splitters.size() + 2);
+    m_sortedSplitterTargets.reserve(2 * m_splitters.size() + 1);
+    m_sortedSplitterTimes.push_back(std::numeric_limits<int64_t>::min());
+    for (const auto &splitter : m_splitters) {
+      // Overlapping splitters start where the previous one stops
+      const int64_t start = std::max(splitter.start().totalNanoseconds(),
+                                     m_sortedSplitterTimes.back());
+      const int64_t stop = std::max(splitter.stop().totalNanoseconds(), start);
+      m_sortedSplitterTargets.push_back(unfiltered);
+      m_sortedSplitterTimes.push_back(start);
+      m_sortedSplitterTargets.push_back(targetOf(splitter.index()));
+      m_sortedSplitterTimes.push_back(stop);
+    }
+    if (m_splitters.empty()) {
+      // All events are unfiltered
+      m_sortedSplitterTargets.push_back(unfiltered);
+      m_sortedSplitterTimes.push_back(std::numeric_limits<int64_t>::max());
+    }
+  } else {
+    if (!std::is_sorted(m_vecSplitterTime.begin(), m_vecSplitterTime.end()))
+      throw runtime_error("The splitters are not sorted by time.");
+    m_sortedSplitterTimes = m_vecSplitterTime;
+    m_sortedSplitterTargets.reserve(m_vecSplitterGroup.size());
+    for (const auto group : m_vecSplitterGroup)
+      m_sortedSplitterTargets.push_back(targetOf(group));
+    if (m_sortedSplitterTimes.empty())
+      m_sortedSplitterTimes.push_back(0);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Split the events of one spectrum into the output workspaces with the
+ * splitters compiled by compileSortedSplitters()
+ * @param wsIndex :: workspace index of the spectrum
+ */
+void FilterEvents::splitSpectrumBySortedSplitters(const size_t wsIndex) {
+  std::vector<DataObjects::EventList *> outputs;
+  outputs.reserve(m_sortedSplitterOutputs.size());
+  for (const auto ws : m_sortedSplitterOutputs)
+    outputs.push_back(&ws->getSpectrum(wsIndex));
+
+  const DataObjects::EventList &input_el = m_eventWS->getSpectrum(wsIndex);
+  if (m_tofCorrType != NoneCorrect)
+    input_el.splitByFullTimeSorted(m_sortedSplitterTimes,
+                                   m_sortedSplitterTargets, outputs, true,
+                                   m_detTofFactors[wsIndex],
+                                   m_detTofOffsets[wsIndex]);
+  else
+    input_el.splitByFullTimeSorted(m_sortedSplitterTimes,
+                                   m_sortedSplitterTargets, outputs, false,
+                                   1.0, 0.0);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Generate a vector of integer time series property for each splitter
  * corresponding to each target (in integer)
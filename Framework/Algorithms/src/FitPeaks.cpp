@@ -816,6 +816,16 @@ FitPeaks::fitPeaks() {
   std::vector<boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult>>
       fit_result_vector(num_fit_result);
 
+  // Each thread owns a Fit algorithm, which is reused for all the spectra the
+  // thread fits. With a dynamic schedule any thread may pick up an iteration,
+  // so there is one per thread even if there are fewer spectra.
+  const size_t num_threads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<API::IAlgorithm_sptr> peak_fitters(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+    peak_fitters[i] = createPeakFitter();
+  const size_t numfuncparams =
+      m_peakFunction->nParams() + m_bkgdFunction->nParams();
+
   // cppcheck-suppress syntaxError
   PRAGMA_OMP(parallel for schedule(dynamic, 1) )
   for (int wi = static_cast<int>(m_startWorkspaceIndex);
@@ -828,14 +838,13 @@ FitPeaks::fitPeaks() {
         getExpectedPeakPositions(static_cast<size_t>(wi));
 
     // initialize output for this
-    size_t numfuncparams =
-        m_peakFunction->nParams() + m_bkgdFunction->nParams();
     boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result =
         boost::make_shared<FitPeaksAlgorithm::PeakFitResult>(m_numPeaksToFit,
                                                              numfuncparams);
 
+    const size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
     fitSpectrumPeaks(static_cast<size_t>(wi), expected_peak_centers,
-                     fit_result);
+                     peak_fitters[thread], fit_result);
 
     PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
       writeFitResult(static_cast<size_t>(wi), expected_peak_centers,
@@ -852,6 +861,28 @@ FitPeaks::fitPeaks() {
   return fit_result_vector;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Create the Fit algorithm fitting peak and background of one spectrum
+ */
+API::IAlgorithm_sptr FitPeaks::createPeakFitter() {
+  IAlgorithm_sptr peak_fitter; // both peak and background (combo)
+  try {
+    peak_fitter = createChildAlgorithm("Fit", -1, -1, false);
+  } catch (Exception::NotFoundError &) {
+    std::stringstream errss;
+    errss << "The FitPeak algorithm requires the CurveFitting library";
+    g_log.error(errss.str());
+    throw std::runtime_error(errss.str());
+  }
+
+  // set up properties of algorithm (reference) 'Fit'
+  peak_fitter->setProperty("Minimizer", m_minimizer);
+  peak_fitter->setProperty("CostFunction", m_costFunction);
+  peak_fitter->setProperty("CalcErrors", true);
+
+  return peak_fitter;
+}
+
 namespace {
 /// Supported peak profiles for observation
 std::vector<std::string> supported_peak_profiles{"Gaussian", "Lorentzian",
@@ -896,6 +927,7 @@ double numberCounts(const Histogram &histogram, const double xmin,
  */
 void FitPeaks::fitSpectrumPeaks(
     size_t wi, const std::vector<double> &expected_peak_centers,
+    API::IAlgorithm_sptr peak_fitter,
     boost::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result) {
   if (numberCounts(m_inputMatrixWS->histogram(wi)) <= m_minPeakHeight) {
     for (size_t i = 0; i < fit_result->getNumberPeaks(); ++i)
@@ -903,29 +935,14 @@ void FitPeaks::fitSpectrumPeaks(
     return; // don't do anything
   }
 
-  // Set up sub algorithm Fit for peak and background
-  IAlgorithm_sptr peak_fitter; // both peak and background (combo)
-  try {
-    peak_fitter = createChildAlgorithm("Fit", -1, -1, false);
-  } catch (Exception::NotFoundError &) {
-    std::stringstream errss;
-    errss << "The FitPeak algorithm requires the CurveFitting library";
-    g_log.error(errss.str());
-    throw std::runtime_error(errss.str());
-  }
-
-  // Clone the function
+  // Clone the functions so that values, errors, ties and constraints from
+  // the previous spectrum fitted by this thread are not carried over
   IPeakFunction_sptr peakfunction =
       boost::dynamic_pointer_cast<API::IPeakFunction>(m_peakFunction->clone());
   IBackgroundFunction_sptr bkgdfunction =
       boost::dynamic_pointer_cast<API::IBackgroundFunction>(
           m_bkgdFunction->clone());
 
-  // set up properties of algorithm (reference) 'Fit'
-  peak_fitter->setProperty("Minimizer", m_minimizer);
-  peak_fitter->setProperty("CostFunction", m_costFunction);
-  peak_fitter->setProperty("CalcErrors", true);
-
   // store the peak fit parameters once one works
   bool foundAnyPeak = false;
   std::vector<double> lastGoodPeakParameters(peakfunction->nParams(), 0.);
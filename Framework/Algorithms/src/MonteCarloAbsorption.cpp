@@ -105,6 +105,10 @@ void MonteCarloAbsorption::init() {
       "The number of \"neutron\" events to generate per simulated point");
   declareProperty("SeedValue", DEFAULT_SEED, positiveInt,
                   "Seed the random number generator with this value");
+  declareProperty("ResimulateTracksForDiffWavelength", true,
+                  "If true, new events are generated for every wavelength "
+                  "point. Otherwise the tracks of one set of events are used "
+                  "for all wavelength points of a spectrum, which is faster.");
 
   InterpolationOption interpolateOpt;
   declareProperty(interpolateOpt.property(), interpolateOpt.propertyDoc());
@@ -157,9 +161,12 @@ void MonteCarloAbsorption::exec() {
   interpolateOpt.set(getPropertyValue("Interpolation"));
   const bool useSparseInstrument = getProperty("SparseInstrument");
   const int maxScatterPtAttempts = getProperty("MaxScatterPtAttempts");
+  const bool resimulateTracks =
+      getProperty("ResimulateTracksForDiffWavelength");
   auto outputWS = doSimulation(*inputWS, static_cast<size_t>(nevents), nlambda,
                                seed, interpolateOpt, useSparseInstrument,
-                               static_cast<size_t>(maxScatterPtAttempts));
+                               static_cast<size_t>(maxScatterPtAttempts),
+                               resimulateTracks);
 
   setProperty("OutputWorkspace", std::move(outputWS));
 }
@@ -192,12 +199,15 @@ std::map<std::string, std::string> MonteCarloAbsorption::validateInputs() {
  * @param useSparseInstrument If true, use sparse instrument in simulation
  * @param maxScatterPtAttempts The maximum number of tries to generate a
  * scatter point within the object
+ * @param resimulateTracks If false, use the same events for all wavelength
+ * points of a spectrum
  * @return A new workspace containing the correction factors & errors
  */
 MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
     const MatrixWorkspace &inputWS, const size_t nevents, int nlambda,
     const int seed, const InterpolationOption &interpolateOpt,
-    const bool useSparseInstrument, const size_t maxScatterPtAttempts) {
+    const bool useSparseInstrument, const size_t maxScatterPtAttempts,
+    const bool resimulateTracks) {
   auto outputWS = createOutputWorkspace(inputWS);
   const auto inputNbins = static_cast<int>(inputWS.blocksize());
   if (isEmpty(nlambda) || nlambda > inputNbins) {
@@ -260,6 +270,8 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
 
     auto &outY = simulationWS.mutableY(i);
     const auto lambdas = simulationWS.points(i);
+    std::vector<int> simulatedBins;
+    std::vector<double> lambdasIn, lambdasOut;
     // Simulation for each requested wavelength point
     for (int j = 0; j < nbins; j += lambdaStepSize) {
       prog.report(reportMsg);
@@ -272,14 +284,27 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
       } else {
         // elastic case already initialized
       }
-      std::tie(outY[j], std::ignore) =
-          strategy.calculate(rng, detPos, lambdaIn, lambdaOut);
+      if (resimulateTracks) {
+        std::tie(outY[j], std::ignore) =
+            strategy.calculate(rng, detPos, lambdaIn, lambdaOut);
+      } else {
+        simulatedBins.push_back(j);
+        lambdasIn.push_back(lambdaIn);
+        lambdasOut.push_back(lambdaOut);
+      }
 
       // Ensure we have the last point for the interpolation
       if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
         j = nbins - lambdaStepSize - 1;
       }
     }
+    if (!resimulateTracks) {
+      const auto factors =
+          strategy.calculate(rng, detPos, lambdasIn, lambdasOut);
+      for (size_t k = 0; k < simulatedBins.size(); ++k) {
+        outY[simulatedBins[k]] = factors[k];
+      }
+    }
 
     // Interpolate through points not simulated
     if (!useSparseInstrument && lambdaStepSize > 1) {
@@ -230,8 +230,9 @@ void Plus::operateOnRun(const Run &lhs, const Run &rhs, Run &ans) const {
     // The output is either the same as the LHS workspace so needs to be set to
     // that run object
     // or it is a completely separate workspace meaning that it actually doesn't
-    // matter
-    ans = lhs;
+    // matter. Avoid copying all of the logs onto themselves when in place.
+    if (&lhs != &ans)
+      ans = lhs;
     ans += rhs;
   }
 }
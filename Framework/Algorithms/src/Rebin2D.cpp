@@ -129,33 +129,58 @@ void Rebin2D::exec() {
   m_progress = boost::shared_ptr<API::Progress>(
       new API::Progress(this, 0.0, 1.0, nreports));
 
+  // Each chunk of spectra is rebinned into its own partial output if the
+  // memory allows it, otherwise every spectrum is rebinned into the output
+  // workspace directly
+  auto partialOutputs =
+      FractionalRebinning::createPartialOutputs(*inputWS, *outputWS);
+  const size_t nChunks =
+      partialOutputs.empty() ? numYBins : partialOutputs.size();
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
-  for (int64_t i = 0; i < static_cast<int64_t>(numYBins);
-       ++i) // signed for openmp
+  for (int64_t chunk = 0; chunk < static_cast<int64_t>(nChunks);
+       ++chunk) // signed for openmp
   {
     PARALLEL_START_INTERUPT_REGION
 
-    m_progress->report("Computing polygon intersections");
-    const double vlo = oldYEdges[i];
-    const double vhi = oldYEdges[i + 1];
-    for (size_t j = 0; j < numXBins; ++j) {
-      // For each input polygon test where it intersects with
-      // the output grid and assign the appropriate weights of Y/E
-      const double x_j = oldXEdges[j];
-      const double x_jp1 = oldXEdges[j + 1];
-      Quadrilateral inputQ = Quadrilateral(x_j, x_jp1, vlo, vhi);
-      if (!useFractionalArea) {
-        FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, *outputWS,
-                                           newYBins.rawData());
-      } else {
-        FractionalRebinning::rebinToFractionalOutput(
-            inputQ, inputWS, i, j, *outputRB, newYBins.rawData(), inputHasFA);
+    const size_t chunkStart = static_cast<size_t>(chunk) * numYBins / nChunks;
+    const size_t chunkEnd = static_cast<size_t>(chunk + 1) * numYBins / nChunks;
+    for (size_t i = chunkStart; i < chunkEnd; ++i) {
+      m_progress->report("Computing polygon intersections");
+      const double vlo = oldYEdges[i];
+      const double vhi = oldYEdges[i + 1];
+      for (size_t j = 0; j < numXBins; ++j) {
+        // For each input polygon test where it intersects with
+        // the output grid and assign the appropriate weights of Y/E
+        const double x_j = oldXEdges[j];
+        const double x_jp1 = oldXEdges[j + 1];
+        Quadrilateral inputQ = Quadrilateral(x_j, x_jp1, vlo, vhi);
+        if (!partialOutputs.empty()) {
+          auto &partialOutput = partialOutputs[chunk];
+          if (!useFractionalArea) {
+            FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j,
+                                               partialOutput,
+                                               newYBins.rawData());
+          } else {
+            FractionalRebinning::rebinToFractionalOutput(
+                inputQ, inputWS, i, j, partialOutput, newYBins.rawData(),
+                inputHasFA);
+          }
+        } else if (!useFractionalArea) {
+          FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, *outputWS,
+                                             newYBins.rawData());
+        } else {
+          FractionalRebinning::rebinToFractionalOutput(
+              inputQ, inputWS, i, j, *outputRB, newYBins.rawData(),
+              inputHasFA);
+        }
       }
     }
 
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
+  FractionalRebinning::addPartialOutputs(partialOutputs, *outputWS);
   if (useFractionalArea) {
     outputRB->finalize(true, true);
   }
@@ -5,12 +5,76 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Mantid {
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+
+/// The path length through an object weighted by its number density
+struct Segment {
+  size_t object;
+  double densityLength;
+};
+
+/**
+ * Append the segments of a track to a list of segments
+ * @param path The track through the objects of the volume
+ * @param objects [InOut] The objects seen so far, extended with new ones
+ * @param materials [InOut] The materials of objects
+ * @param segments [InOut] Segments indexing into objects
+ */
+void appendSegments(const Geometry::Track &path,
+                    std::vector<const Geometry::IObject *> &objects,
+                    std::vector<Kernel::Material> &materials,
+                    std::vector<Segment> &segments) {
+  for (const auto &link : path) {
+    auto object = std::find(objects.cbegin(), objects.cend(), link.object);
+    if (object == objects.cend()) {
+      objects.push_back(link.object);
+      materials.push_back(link.object->material());
+      object = std::prev(objects.cend());
+    }
+    const auto index =
+        static_cast<size_t>(std::distance(objects.cbegin(), object));
+    segments.push_back(
+        {index, materials[index].numberDensity() * link.distInsideObject});
+  }
+}
+
+/**
+ * Compute the total cross section of each material at a wavelength
+ * @param materials The materials of the objects
+ * @param lambda Wavelength in \f$\\A\f$
+ * @param xsections [Out] Cross sections in barns
+ */
+void totalXSections(const std::vector<Kernel::Material> &materials,
+                    double lambda, std::vector<double> &xsections) {
+  xsections.resize(materials.size());
+  for (size_t i = 0; i < materials.size(); ++i) {
+    xsections[i] = materials[i].totalScatterXSection(lambda) +
+                   materials[i].absorbXSection(lambda);
+  }
+}
+
+/// The error raised when no valid track is found for an event
+std::runtime_error scatterPointError(size_t maxScatterAttempts) {
+  return std::runtime_error("Unable to generate valid track through "
+                            "sample interaction volume after " +
+                            std::to_string(maxScatterAttempts) +
+                            " attempts. Try increasing the maximum "
+                            "threshold or if this does not help then "
+                            "please check the defined shape.");
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -59,12 +123,7 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
         break;
       }
       if (attempts == m_maxScatterAttempts) {
-        throw std::runtime_error("Unable to generate valid track through "
-                                 "sample interaction volume after " +
-                                 std::to_string(m_maxScatterAttempts) +
-                                 " attempts. Try increasing the maximum "
-                                 "threshold or if this does not help then "
-                                 "please check the defined shape.");
+        throw scatterPointError(m_maxScatterAttempts);
       }
     } while (true);
   }
@@ -72,5 +131,86 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
   return make_tuple(factor / static_cast<double>(m_nevents), m_error);
 }
 
+/**
+ * Compute the corrections for a final position of the neutron and several
+ * pairs of wavelengths before and after scattering. The tracks of the events
+ * are generated once and used for all wavelengths, so the random numbers drawn
+ * are the same as for a single call of the single wavelength version, and the
+ * correction for each pair equals what that call would give from the same
+ * state of the generator.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdasBefore Wavelengths, in \f$\\A^-1\f$, before scattering
+ * @param lambdasAfter Wavelengths, in \f$\\A^-1\f$, after scattering. Must
+ * have the same size as lambdasBefore.
+ * @return The correction factor for each pair of wavelengths. The error on all
+ * of them is the same as for a single wavelength.
+ */
+std::vector<double> MCAbsorptionStrategy::calculate(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+    const std::vector<double> &lambdasBefore,
+    const std::vector<double> &lambdasAfter) const {
+  if (lambdasBefore.size() != lambdasAfter.size()) {
+    throw std::invalid_argument("MCAbsorptionStrategy::calculate() - The "
+                                "numbers of wavelengths before and after "
+                                "scattering differ.");
+  }
+  // Only the path lengths through each object are needed to compute the
+  // attenuation at any wavelength, so store those for all events
+  std::vector<const Geometry::IObject *> objects;
+  std::vector<Kernel::Material> materials;
+  std::vector<Segment> segmentsBefore, segmentsAfter;
+  std::vector<size_t> endBefore, endAfter;
+  endBefore.reserve(m_nevents);
+  endAfter.reserve(m_nevents);
+  const auto scatterBounds = m_scatterVol.getBoundingBox();
+  Geometry::Track beforeScatter, afterScatter;
+  for (size_t i = 0; i < m_nevents; ++i) {
+    size_t attempts(0);
+    do {
+      const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+      if (m_scatterVol.calculateBeforeAfterTrack(
+              rng, neutron.startPos, finalPos, beforeScatter, afterScatter)) {
+        appendSegments(beforeScatter, objects, materials, segmentsBefore);
+        appendSegments(afterScatter, objects, materials, segmentsAfter);
+        break;
+      }
+      ++attempts;
+      if (attempts == m_maxScatterAttempts) {
+        throw scatterPointError(m_maxScatterAttempts);
+      }
+    } while (true);
+    endBefore.push_back(segmentsBefore.size());
+    endAfter.push_back(segmentsAfter.size());
+  }
+
+  std::vector<double> factors(lambdasBefore.size());
+  std::vector<double> xsBefore, xsAfter;
+  for (size_t j = 0; j < lambdasBefore.size(); ++j) {
+    totalXSections(materials, lambdasBefore[j], xsBefore);
+    totalXSections(materials, lambdasAfter[j], xsAfter);
+    double factor(0.0);
+    auto before = segmentsBefore.cbegin();
+    auto after = segmentsAfter.cbegin();
+    for (size_t i = 0; i < m_nevents; ++i) {
+      // The number density is in A^-3, the cross sections in barns and the
+      // lengths in metres
+      double exponent(0.0);
+      for (const auto end = segmentsBefore.cbegin() + endBefore[i];
+           before != end; ++before) {
+        exponent += xsBefore[before->object] * before->densityLength;
+      }
+      for (const auto end = segmentsAfter.cbegin() + endAfter[i]; after != end;
+           ++after) {
+        exponent += xsAfter[after->object] * after->densityLength;
+      }
+      factor += std::exp(-100 * exponent);
+    }
+    factors[j] = factor / static_cast<double>(m_nevents);
+  }
+  return factors;
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -66,21 +66,23 @@ const Geometry::BoundingBox &MCInteractionVolume::getBoundingBox() const {
 }
 
 /**
- * Calculate the attenuation correction factor the volume given a start and
- * end point.
+ * Generate a scatter point in the volume and the tracks leading to it from the
+ * start point and away from it to the end point.
  * @param rng A reference to a PseudoRandomNumberGenerator producing
  * random number between [0,1]
  * @param startPos Origin of the initial track
  * @param endPos Final position of neutron after scattering (assumed to be
  * outside of the "volume")
- * @param lambdaBefore Wavelength, in \f$\\A^-1\f$, before scattering
- * @param lambdaAfter Wavelength, in \f$\\A^-1\f$, after scattering
- * @return The fraction of the beam that has been attenuated. A negative number
- * indicates the track was not valid.
+ * @param beforeScatter [Out] The track from the scatter point back towards
+ * the start point
+ * @param afterScatter [Out] The track from the scatter point to the end point
+ * @return False if the track before scattering does not cross any object, in
+ * which case the tracks are not valid.
  */
-double MCInteractionVolume::calculateAbsorption(
+bool MCInteractionVolume::calculateBeforeAfterTrack(
     Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
-    const Kernel::V3D &endPos, double lambdaBefore, double lambdaAfter) const {
+    const Kernel::V3D &endPos, Track &beforeScatter,
+    Track &afterScatter) const {
   // Generate scatter point. If there is an environment present then
   // first select whether the scattering occurs on the sample or the
   // environment. The attenuation for the path leading to the scatter point
@@ -97,7 +99,7 @@ double MCInteractionVolume::calculateAbsorption(
   }
   auto toStart = startPos - scatterPos;
   toStart.normalize();
-  Track beforeScatter(scatterPos, toStart);
+  beforeScatter = Track(scatterPos, toStart);
   int nlinks = m_sample->interceptSurface(beforeScatter);
   if (m_env) {
     nlinks += m_env->interceptSurfaces(beforeScatter);
@@ -105,6 +107,39 @@ double MCInteractionVolume::calculateAbsorption(
   // This should not happen but numerical precision means that it can
   // occasionally occur with tracks that are very close to the surface
   if (nlinks == 0) {
+    return false;
+  }
+
+  // Now track to final destination
+  V3D scatteredDirec = endPos - scatterPos;
+  scatteredDirec.normalize();
+  afterScatter = Track(scatterPos, scatteredDirec);
+  m_sample->interceptSurface(afterScatter);
+  if (m_env) {
+    m_env->interceptSurfaces(afterScatter);
+  }
+  return true;
+}
+
+/**
+ * Calculate the attenuation correction factor the volume given a start and
+ * end point.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @param startPos Origin of the initial track
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param lambdaBefore Wavelength, in \f$\\A^-1\f$, before scattering
+ * @param lambdaAfter Wavelength, in \f$\\A^-1\f$, after scattering
+ * @return The fraction of the beam that has been attenuated. A negative number
+ * indicates the track was not valid.
+ */
+double MCInteractionVolume::calculateAbsorption(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
+    const Kernel::V3D &endPos, double lambdaBefore, double lambdaAfter) const {
+  Track beforeScatter, afterScatter;
+  if (!calculateBeforeAfterTrack(rng, startPos, endPos, beforeScatter,
+                                 afterScatter)) {
     return -1.0;
   }
 
@@ -123,14 +158,6 @@ double MCInteractionVolume::calculateAbsorption(
     return factor;
   };
 
-  // Now track to final destination
-  V3D scatteredDirec = endPos - scatterPos;
-  scatteredDirec.normalize();
-  Track afterScatter(scatterPos, scatteredDirec);
-  m_sample->interceptSurface(afterScatter);
-  if (m_env) {
-    m_env->interceptSurfaces(afterScatter);
-  }
   return calculateAttenuation(beforeScatter, lambdaBefore) *
          calculateAttenuation(afterScatter, lambdaAfter);
 }
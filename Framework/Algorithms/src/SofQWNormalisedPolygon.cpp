@@ -99,77 +99,115 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
+  // Each chunk of spectra is rebinned into its own partial output if the
+  // memory allows it, otherwise every spectrum is rebinned into the output
+  // workspace directly
+  auto partialOutputs =
+      FractionalRebinning::createPartialOutputs(*inputWS, *outputWS);
+  const size_t nChunks =
+      partialOutputs.empty() ? nHistos : partialOutputs.size();
+  // The detectors added to the spectrum-detector mapping are collected next
+  // to each partial output, or by each thread if there are none, and merged
+  // after the loop. The merged mapping does not depend on the order.
+  std::vector<std::vector<SpectrumDefinition>> partialMappings(
+      partialOutputs.empty() ? static_cast<size_t>(PARALLEL_GET_MAX_THREADS)
+                             : nChunks);
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
-  for (int64_t i = 0; i < static_cast<int64_t>(nHistos);
-       ++i) // signed for openmp
+  for (int64_t chunk = 0; chunk < static_cast<int64_t>(nChunks);
+       ++chunk) // signed for openmp
   {
     PARALLEL_START_INTERUPT_REGION
 
-    if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
-      continue;
-    }
-    const auto *det =
-        m_EmodeProperties.m_emode == 1 ? nullptr : &spectrumInfo.detector(i);
-
-    const double theta = this->m_theta[i];
-    const double phi = this->m_phi[i];
-    const double thetaWidth = this->m_thetaWidths[i];
-    const double phiWidth = this->m_phiWidths[i];
-
-    // Compute polygon points
-    const double thetaHalfWidth = 0.5 * thetaWidth;
-
-    const double thetaLower = theta - thetaHalfWidth;
-    const double thetaUpper = theta + thetaHalfWidth;
-
-    const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
-    std::stringstream logStream;
-    for (size_t j = 0; j < nEnergyBins; ++j) {
-      m_progress->report("Computing polygon intersections");
-      // For each input polygon test where it intersects with
-      // the output grid and assign the appropriate weights of Y/E
-      const double dE_j = X[j];
-      const double dE_jp1 = X[j + 1];
-
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
-
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
-      const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
-      if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
-        logStream << "Spectrum=" << specNo << ", theta=" << theta
-                  << ",thetaWidth=" << thetaWidth << ", phi=" << phi
-                  << ", phiWidth=" << phiWidth << ". QE polygon: ll=" << ll
-                  << ", lr=" << lr << ", ur=" << ur << ", ul=" << ul << "\n";
+    const size_t chunkStart = static_cast<size_t>(chunk) * nHistos / nChunks;
+    const size_t chunkEnd = static_cast<size_t>(chunk + 1) * nHistos / nChunks;
+    auto &partialMapping =
+        partialMappings[partialOutputs.empty()
+                            ? static_cast<size_t>(PARALLEL_THREAD_NUMBER)
+                            : static_cast<size_t>(chunk)];
+    for (size_t i = chunkStart; i < chunkEnd; ++i) {
+      if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
+        continue;
       }
+      const auto *det = m_EmodeProperties.m_emode == 1
+                            ? nullptr
+                            : &spectrumInfo.detector(i);
+
+      const double theta = this->m_theta[i];
+      const double phi = this->m_phi[i];
+      const double thetaWidth = this->m_thetaWidths[i];
+      const double phiWidth = this->m_phiWidths[i];
+
+      // Compute polygon points
+      const double thetaHalfWidth = 0.5 * thetaWidth;
+
+      const double thetaLower = theta - thetaHalfWidth;
+      const double thetaUpper = theta + thetaHalfWidth;
+
+      const auto specNo =
+          static_cast<specnum_t>(inputIndices.spectrumNumber(i));
+      std::stringstream logStream;
+      for (size_t j = 0; j < nEnergyBins; ++j) {
+        m_progress->report("Computing polygon intersections");
+        // For each input polygon test where it intersects with
+        // the output grid and assign the appropriate weights of Y/E
+        const double dE_j = X[j];
+        const double dE_jp1 = X[j + 1];
+
+        const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+
+        const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+        const V2D lr(dE_jp1, lrQ);
+        const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
+        const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+        if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+          logStream << "Spectrum=" << specNo << ", theta=" << theta
+                    << ",thetaWidth=" << thetaWidth << ", phi=" << phi
+                    << ", phiWidth=" << phiWidth << ". QE polygon: ll=" << ll
+                    << ", lr=" << lr << ", ur=" << ur << ", ul=" << ul
+                    << "\n";
+        }
+
+        Quadrilateral inputQ = Quadrilateral(ll, lr, ur, ul);
+
+        if (partialOutputs.empty()) {
+          FractionalRebinning::rebinToFractionalOutput(inputQ, inputWS, i, j,
+                                                       *outputWS, m_Qout);
+        } else {
+          FractionalRebinning::rebinToFractionalOutput(
+              inputQ, inputWS, i, j, partialOutputs[chunk], m_Qout);
+        }
 
-      Quadrilateral inputQ = Quadrilateral(ll, lr, ur, ul);
-
-      FractionalRebinning::rebinToFractionalOutput(inputQ, inputWS, i, j,
-                                                   *outputWS, m_Qout);
-
-      // Find which q bin this point lies in
-      const MantidVec::difference_type qIndex =
-          std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
-      if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
+        // Find which q bin this point lies in
+        const MantidVec::difference_type qIndex =
+            std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) -
+            m_Qout.begin();
+        if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
+          // Add this spectra-detector pair to the mapping
+          if (partialMapping.empty())
+            partialMapping.resize(detIDMapping.size());
+          // Could do a more complete merge of spectrum definitions here,
+          // but historically only the ID of the first detector in the
+          // spectrum is used, so I am keeping that for now.
+          partialMapping[qIndex - 1].add(
               spectrumInfo.spectrumDefinition(i)[0].first);
         }
       }
-    }
-    if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
-      g_log.debug(logStream.str());
+      if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
+        g_log.debug(logStream.str());
+      }
     }
 
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
+  FractionalRebinning::addPartialOutputs(partialOutputs, *outputWS);
+  for (const auto &partialMapping : partialMappings) {
+    for (size_t qIndex = 0; qIndex < partialMapping.size(); ++qIndex) {
+      for (const auto &index : partialMapping[qIndex])
+        detIDMapping[qIndex].add(index.first, index.second);
+    }
+  }
 
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress);
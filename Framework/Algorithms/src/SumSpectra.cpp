@@ -5,6 +5,7 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/EventWorkspaceHelpers.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
@@ -557,6 +558,8 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
   outputEL.clearDetectorIDs();
 
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
+  std::vector<size_t> indicesToSum;
+  indicesToSum.reserve(m_indices.size());
   // Loop over spectra
   for (const auto i : m_indices) {
     if (spectrumInfo.hasDetectors(i)) {
@@ -571,15 +574,16 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
     }
     numSpectra++;
 
-    // Add the event lists with the operator
-    const EventList &inputEL = inputWorkspace->getSpectrum(i);
-    if (inputEL.empty()) {
+    if (inputWorkspace->getSpectrum(i).empty()) {
       ++numZeros;
     }
-    outputEL += inputEL;
-
-    progress.report();
+    indicesToSum.push_back(i);
   }
+
+  // Add the event lists, in parallel for many spectra
+  EventWorkspaceHelpers::appendEventLists(*inputWorkspace, indicesToSum,
+                                          outputEL);
+  progress.reportIncrement(m_indices.size());
 }
 
 } // namespace Algorithms
@@ -0,0 +1,224 @@
+#ifndef MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_
+#define MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidAlgorithms/AlignAndFocusEvents.h"
+#include "MantidAlgorithms/AlignDetectors.h"
+#include "MantidAlgorithms/DiffractionFocussing2.h"
+#include "MantidAlgorithms/Rebin.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/TableWorkspace.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/Unit.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <numeric>
+
+using Mantid::Algorithms::AlignAndFocusEvents;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+class AlignAndFocusEventsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlignAndFocusEventsTest *createSuite() {
+    return new AlignAndFocusEventsTest();
+  }
+  static void destroySuite(AlignAndFocusEventsTest *suite) { delete suite; }
+
+  void setUp() override {
+    // 2 banks of 2x2 pixels
+    m_inputWS = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+        2, 2, false);
+    m_inputWS->getAxis(0)->setUnit("TOF");
+
+    const auto &detIDs = m_inputWS->detectorInfo().detectorIDs();
+    m_calibration = boost::make_shared<TableWorkspace>();
+    m_calibration->addColumn("int", "detid");
+    m_calibration->addColumn("double", "difc");
+    m_calibration->addColumn("double", "difa");
+    m_calibration->addColumn("double", "tzero");
+    m_grouping = boost::make_shared<GroupingWorkspace>(
+        m_inputWS->getInstrument());
+    for (size_t i = 0; i < detIDs.size(); ++i) {
+      const bool firstBank = i < detIDs.size() / 2;
+      TableRow row = m_calibration->appendRow();
+      row << detIDs[i] << (firstBank ? 1.0 : 2.0) << 0.0
+          << (firstBank ? 0.0 : 3.0);
+      m_grouping->setValue(detIDs[i], firstBank ? 1 : 2);
+    }
+  }
+
+  void test_Init() {
+    AlignAndFocusEvents alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_requires_workspace_or_file() {
+    AlignAndFocusEvents alg;
+    alg.initialize();
+    alg.setProperty("GroupingWorkspace", m_grouping);
+    alg.setPropertyValue("Params", "0,1,50");
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    auto errors = alg.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("InputWorkspace"), 1);
+    TS_ASSERT_EQUALS(errors.count("Filename"), 1);
+  }
+
+  void test_requires_binning_range() {
+    AlignAndFocusEvents alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", m_inputWS);
+    alg.setPropertyValue("Params", "1");
+    auto errors = alg.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("Params"), 1);
+  }
+
+  void test_same_as_align_focus_and_rebin() {
+    const std::string params = "0,2,100";
+    auto output = runAlignAndFocus(params);
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(output->getAxis(0)->unit()->unitID(), "dSpacing");
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getSpectrumNo(), 1);
+    TS_ASSERT_EQUALS(output->getSpectrum(1).getSpectrumNo(), 2);
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getDetectorIDs().size(), 4);
+
+    auto expected = runSeparateSteps(params);
+    TS_ASSERT_EQUALS(expected->getNumberHistograms(), 2);
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_EQUALS(output->x(i).rawData(), expected->x(i).rawData());
+      for (size_t bin = 0; bin < output->y(i).size(); ++bin) {
+        TS_ASSERT_DELTA(output->y(i)[bin], expected->y(i)[bin], 1e-10);
+        TS_ASSERT_DELTA(output->e(i)[bin], expected->e(i)[bin], 1e-10);
+      }
+    }
+    // All events of the first bank are within range
+    const auto &y = output->y(0);
+    TS_ASSERT_DELTA(std::accumulate(y.begin(), y.end(), 0.),
+                    static_cast<double>(m_inputWS->getNumberEvents() / 2),
+                    1e-10);
+  }
+
+  void test_ungrouped_detectors_are_skipped() {
+    const auto &detIDs = m_inputWS->detectorInfo().detectorIDs();
+    for (size_t i = detIDs.size() / 2; i < detIDs.size(); ++i)
+      m_grouping->setValue(detIDs[i], 0);
+    auto output = runAlignAndFocus("0,2,100");
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getSpectrumNo(), 1);
+  }
+
+  void test_file_with_banks_loaded_on_demand() {
+    const std::string filename("CNCS_7860_event.nxs");
+    FrameworkManager::Instance().exec("LoadEventNexus", 6, "Filename",
+                                      filename.c_str(), "LoadMonitors", "0",
+                                      "OutputWorkspace",
+                                      "AlignAndFocusEventsTest_cncs");
+    FrameworkManager::Instance().exec(
+        "CreateGroupingWorkspace", 6, "InputWorkspace",
+        "AlignAndFocusEventsTest_cncs", "GroupDetectorsBy", "All",
+        "OutputWorkspace", "AlignAndFocusEventsTest_group");
+    auto &ads = AnalysisDataService::Instance();
+    auto inputWS =
+        ads.retrieveWS<EventWorkspace>("AlignAndFocusEventsTest_cncs");
+    auto grouping =
+        ads.retrieveWS<GroupingWorkspace>("AlignAndFocusEventsTest_group");
+    const std::string params = "0.1,-0.01,100";
+
+    AlignAndFocusEvents fromWorkspace;
+    fromWorkspace.setChild(true);
+    fromWorkspace.initialize();
+    fromWorkspace.setProperty("InputWorkspace", inputWS);
+    fromWorkspace.setProperty("GroupingWorkspace", grouping);
+    fromWorkspace.setPropertyValue("Params", params);
+    fromWorkspace.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(fromWorkspace.execute());
+    MatrixWorkspace_sptr expected =
+        fromWorkspace.getProperty("OutputWorkspace");
+
+    AlignAndFocusEvents fromFile;
+    fromFile.setChild(true);
+    fromFile.initialize();
+    fromFile.setPropertyValue("Filename", filename);
+    fromFile.setProperty("MaxBanksInMemory", 2);
+    fromFile.setProperty("GroupingWorkspace", grouping);
+    fromFile.setPropertyValue("Params", params);
+    fromFile.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(fromFile.execute());
+    TS_ASSERT(fromFile.isExecuted());
+    MatrixWorkspace_sptr output = fromFile.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(output->x(0).rawData(), expected->x(0).rawData());
+    const auto &y = output->y(0);
+    TS_ASSERT_DIFFERS(std::accumulate(y.begin(), y.end(), 0.), 0.);
+    for (size_t bin = 0; bin < y.size(); ++bin) {
+      TS_ASSERT_DELTA(y[bin], expected->y(0)[bin], 1e-10);
+      TS_ASSERT_DELTA(output->e(0)[bin], expected->e(0)[bin], 1e-10);
+    }
+
+    ads.remove("AlignAndFocusEventsTest_cncs");
+    ads.remove("AlignAndFocusEventsTest_group");
+  }
+
+private:
+  MatrixWorkspace_sptr runAlignAndFocus(const std::string &params) {
+    AlignAndFocusEvents alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", m_inputWS);
+    alg.setProperty("CalibrationWorkspace",
+                    boost::static_pointer_cast<ITableWorkspace>(m_calibration));
+    alg.setProperty("GroupingWorkspace", m_grouping);
+    alg.setPropertyValue("Params", params);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  MatrixWorkspace_sptr runSeparateSteps(const std::string &params) {
+    Mantid::Algorithms::AlignDetectors align;
+    align.setChild(true);
+    align.initialize();
+    align.setProperty("InputWorkspace",
+                      MatrixWorkspace_sptr(m_inputWS->clone()));
+    align.setProperty("CalibrationWorkspace",
+                      boost::static_pointer_cast<ITableWorkspace>(m_calibration));
+    align.setPropertyValue("OutputWorkspace", "unused");
+    align.execute();
+    MatrixWorkspace_sptr aligned = align.getProperty("OutputWorkspace");
+
+    Mantid::Algorithms::DiffractionFocussing2 focus;
+    focus.setChild(true);
+    focus.initialize();
+    focus.setProperty("InputWorkspace", aligned);
+    focus.setProperty("GroupingWorkspace", m_grouping);
+    focus.setPropertyValue("OutputWorkspace", "unused");
+    focus.execute();
+    MatrixWorkspace_sptr focused = focus.getProperty("OutputWorkspace");
+
+    Mantid::Algorithms::Rebin rebin;
+    rebin.setChild(true);
+    rebin.initialize();
+    rebin.setProperty("InputWorkspace", focused);
+    rebin.setPropertyValue("Params", params);
+    rebin.setProperty("PreserveEvents", false);
+    rebin.setPropertyValue("OutputWorkspace", "unused");
+    rebin.execute();
+    return rebin.getProperty("OutputWorkspace");
+  }
+
+  EventWorkspace_sptr m_inputWS;
+  TableWorkspace_sptr m_calibration;
+  GroupingWorkspace_sptr m_grouping;
+};
+
+#endif /* MANTID_ALGORITHMS_ALIGNANDFOCUSEVENTSTEST_H_ */
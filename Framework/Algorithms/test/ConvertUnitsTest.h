@@ -848,6 +848,7 @@ public:
     AnalysisDataService::Instance().remove("hist_");
     AnalysisDataService::Instance().remove("event_wave");
     AnalysisDataService::Instance().remove("event_");
+    AnalysisDataService::Instance().remove("event_energy");
   }
 
   void test_points_workspace() {
@@ -885,6 +886,14 @@ public:
     TS_ASSERT(alg->isExecuted());
   }
 
+  void test_event_workspace_energy() {
+    IAlgorithm *alg;
+    alg = FrameworkManager::Instance().exec(
+        "ConvertUnits", "InputWorkspace=event_tof;OutputWorkspace=event_"
+                        "energy;Target=Energy");
+    TS_ASSERT(alg->isExecuted());
+  }
+
 private:
   MatrixWorkspace_sptr histWS;
   MatrixWorkspace_sptr eventWS;
@@ -96,6 +96,28 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_Result_Does_Not_Depend_On_Number_Of_Threads() {
+    for (const size_t numgroups : {1, 2}) {
+      FrameworkManager::Instance().setNumOMPThreads(1);
+      auto serial = focusEvents(numgroups);
+      FrameworkManager::Instance().setNumOMPThreads(4);
+      auto parallel = focusEvents(numgroups);
+      FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+
+      TS_ASSERT_EQUALS(serial->getNumberHistograms(), numgroups);
+      TS_ASSERT_EQUALS(parallel->getNumberHistograms(), numgroups);
+      for (size_t wi = 0; wi < serial->getNumberHistograms(); ++wi) {
+        const auto &serialEvents = serial->getSpectrum(wi);
+        const auto &parallelEvents = parallel->getSpectrum(wi);
+        TS_ASSERT_EQUALS(serialEvents.getNumberEvents(),
+                         parallelEvents.getNumberEvents());
+        TS_ASSERT(serialEvents.getEvents() == parallelEvents.getEvents());
+        TS_ASSERT_EQUALS(serialEvents.getDetectorIDs(),
+                         parallelEvents.getDetectorIDs());
+      }
+    }
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
@@ -239,6 +261,36 @@ public:
   }
 
 private:
+  /// Focus banks of 256 pixels with a few events each into one or two groups
+  EventWorkspace_sptr focusEvents(size_t numgroups) {
+    auto inputW =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(3, 16);
+    inputW->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+    for (size_t pix = 0; pix < inputW->getNumberHistograms(); pix++) {
+      auto &events = inputW->getSpectrum(pix);
+      for (size_t i = 0; i < pix % 5; i++)
+        events.addEventQuickly(TofEvent(static_cast<double>(pix + i)));
+    }
+    AnalysisDataService::Instance().addOrReplace("focus_threads_in", inputW);
+    FrameworkManager::Instance().exec(
+        "CreateGroupingWorkspace", 6, "InputWorkspace", "focus_threads_in",
+        "GroupNames", numgroups == 1 ? "bank3" : "bank2,bank3",
+        "OutputWorkspace", "focus_threads_group");
+
+    DiffractionFocussing2 alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", "focus_threads_in");
+    alg.setPropertyValue("GroupingWorkspace", "focus_threads_group");
+    alg.setPropertyValue("OutputWorkspace", "focus_threads_out");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    auto output = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        "focus_threads_out");
+    AnalysisDataService::Instance().remove("focus_threads_in");
+    AnalysisDataService::Instance().remove("focus_threads_group");
+    AnalysisDataService::Instance().remove("focus_threads_out");
+    return output;
+  }
+
   DiffractionFocussing2 focus;
 };
 
@@ -323,6 +375,12 @@ public:
     AnalysisDataService::Instance().remove("SNAP_focus");
   }
 
+  void test_SNAP_event_one_group_single_thread() {
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    test_SNAP_event_one_group();
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  }
+
   void test_SNAP_event_six_groups() {
     IAlgorithm_sptr alg =
         AlgorithmFactory::Instance().create("DiffractionFocussing", 2);
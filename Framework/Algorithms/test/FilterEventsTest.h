@@ -1097,6 +1097,111 @@ public:
     return;
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Test that all the events go to the unfiltered workspace if the
+   * SplittersWorkspace has no splitter
+   */
+  void test_emptySplittersWorkspace() {
+    int64_t runstart_i64 = 20000000000;
+    int64_t pulsedt = 100 * 1000 * 1000;
+    int64_t tofdt = 10 * 1000 * 1000;
+    size_t numpulses = 5;
+
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(runstart_i64, pulsedt, tofdt, numpulses);
+    AnalysisDataService::Instance().addOrReplace("Test14", inpWS);
+
+    SplittersWorkspace_sptr splws =
+        boost::shared_ptr<SplittersWorkspace>(new SplittersWorkspace);
+    AnalysisDataService::Instance().addOrReplace("Splitter14", splws);
+
+    FilterEvents filter;
+    filter.initialize();
+    filter.setProperty("InputWorkspace", "Test14");
+    filter.setProperty("OutputWorkspaceBaseName", "FilteredWS14");
+    filter.setProperty("SplitterWorkspace", "Splitter14");
+    filter.setProperty("OutputWorkspaceIndexedFrom1", false);
+
+    TS_ASSERT_THROWS_NOTHING(filter.execute());
+    TS_ASSERT(filter.isExecuted());
+
+    EventWorkspace_sptr unfilteredws =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "FilteredWS14_unfiltered");
+    TS_ASSERT(unfilteredws);
+    for (size_t i = 0; i < unfilteredws->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(unfilteredws->getSpectrum(i).getNumberEvents(), 50);
+
+    AnalysisDataService::Instance().remove("Test14");
+    AnalysisDataService::Instance().remove("Splitter14");
+    std::vector<std::string> outputwsnames =
+        filter.getProperty("OutputWorkspaceNames");
+    for (const auto &outputwsname : outputwsnames)
+      AnalysisDataService::Instance().remove(outputwsname);
+  }
+
+  //----------------------------------------------------------------------------------------------
+  /** Test matrix splitters with more splitters than events in each spectrum.
+   * Every splitter is [start, stop) and covers one event, the targets
+   * alternate between 0 and 1, and the first event, which comes before the
+   * first splitter, is discarded.
+   */
+  void test_FilterMoreMatrixSplittersThanEvents() {
+    int64_t runstart_i64 = 20000000000;
+    int64_t pulsedt = 100 * 1000 * 1000;
+    int64_t tofdt = 10 * 1000 * 1000;
+    size_t numpulses = 5;
+
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(runstart_i64, pulsedt, tofdt, numpulses);
+    AnalysisDataService::Instance().addOrReplace("Test15", inpWS);
+
+    // 60 splitters from 0.5 to 60.5 event intervals after the run start
+    const size_t numsplitters = 60;
+    MatrixWorkspace_sptr splws = WorkspaceFactory::Instance().create(
+        "Workspace2D", 1, numsplitters + 1, numsplitters);
+    for (size_t i = 0; i <= numsplitters; ++i)
+      splws->mutableX(0)[i] =
+          (static_cast<double>(i) + 0.5) * static_cast<double>(tofdt) * 1.E-9;
+    for (size_t i = 0; i < numsplitters; ++i)
+      splws->mutableY(0)[i] = static_cast<double>(i % 2);
+    AnalysisDataService::Instance().addOrReplace("Splitter15", splws);
+
+    FilterEvents filter;
+    filter.initialize();
+    filter.setProperty("InputWorkspace", "Test15");
+    filter.setProperty("OutputWorkspaceBaseName", "FilteredWS15");
+    filter.setProperty("SplitterWorkspace", "Splitter15");
+    filter.setProperty("RelativeTime", true);
+    filter.setProperty("OutputWorkspaceIndexedFrom1", false);
+
+    TS_ASSERT_THROWS_NOTHING(filter.execute());
+    TS_ASSERT(filter.isExecuted());
+
+    int numsplittedws = filter.getProperty("NumberOutputWS");
+    TS_ASSERT_EQUALS(numsplittedws, 2);
+
+    EventWorkspace_sptr filteredws0 =
+        boost::dynamic_pointer_cast<EventWorkspace>(
+            AnalysisDataService::Instance().retrieve("FilteredWS15_0"));
+    TS_ASSERT(filteredws0);
+    EventWorkspace_sptr filteredws1 =
+        boost::dynamic_pointer_cast<EventWorkspace>(
+            AnalysisDataService::Instance().retrieve("FilteredWS15_1"));
+    TS_ASSERT(filteredws1);
+    for (size_t i = 0; i < inpWS->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(filteredws0->getSpectrum(i).getNumberEvents(), 25);
+      TS_ASSERT_EQUALS(filteredws1->getSpectrum(i).getNumberEvents(), 24);
+    }
+
+    AnalysisDataService::Instance().remove("Test15");
+    AnalysisDataService::Instance().remove("Splitter15");
+    std::vector<std::string> outputwsnames =
+        filter.getProperty("OutputWorkspaceNames");
+    for (const auto &outputwsname : outputwsnames)
+      AnalysisDataService::Instance().remove(outputwsname);
+  }
+
   /** test for the case that the input workspace name is same as output base
    * workspace name
    * @brief test_ThrowSameName
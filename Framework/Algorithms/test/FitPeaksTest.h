@@ -28,6 +28,50 @@ using Mantid::HistogramData::CountStandardDeviations;
 using Mantid::HistogramData::Counts;
 using Mantid::HistogramData::Points;
 
+namespace {
+/// Create a workspace of spectra with two Gaussian peaks near 5 and 10
+MatrixWorkspace_sptr createGaussianPeaksWorkspace(const size_t numSpectra) {
+  MatrixWorkspace_sptr ws =
+      WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(
+          static_cast<int>(numSpectra), 300);
+  ws->getAxis(0)->unit() =
+      Mantid::Kernel::UnitFactory::Instance().create("dSpacing");
+  for (size_t i = 0; i < numSpectra; ++i) {
+    ws->mutableX(i) *= 0.05;
+    const double shift = 0.01 * static_cast<double>(i % 5);
+    const double width = 0.1 + 0.01 * static_cast<double>(i % 7);
+    const auto &xvals = ws->points(i);
+    std::transform(xvals.cbegin(), xvals.cend(), ws->mutableY(i).begin(),
+                   [shift, width](const double x) {
+                     return 3. * exp(-0.5 * pow((x - 10 - shift) / width, 2)) +
+                            2. * exp(-0.5 * pow((x - 5 + shift) / width, 2)) +
+                            1.E-10;
+                   });
+    const auto &yvals = ws->y(i);
+    std::transform(yvals.cbegin(), yvals.cend(), ws->mutableE(i).begin(),
+                   [](const double y) { return sqrt(y); });
+  }
+  return ws;
+}
+
+/// Fit the peaks near 5 and 10 in all spectra of a workspace
+void fitGaussianPeaks(const std::string &inputName,
+                      const std::string &outputName) {
+  FitPeaks fitpeaks;
+  fitpeaks.initialize();
+  fitpeaks.setProperty("InputWorkspace", inputName);
+  fitpeaks.setProperty("PeakCenters", "5.0, 10.0");
+  fitpeaks.setProperty("FitWindowBoundaryList", "2.5, 6.5, 8.0, 12.0");
+  fitpeaks.setProperty("PeakParameterNames", "Sigma");
+  fitpeaks.setProperty("PeakParameterValues", "0.1");
+  fitpeaks.setProperty("HighBackground", false);
+  fitpeaks.setProperty("OutputWorkspace", outputName);
+  fitpeaks.setProperty("OutputPeakParametersWorkspace", outputName + "_param");
+  fitpeaks.execute();
+  TS_ASSERT(fitpeaks.isExecuted());
+}
+} // namespace
+
 class FitPeaksTest : public CxxTest::TestSuite {
 private:
   std::string m_inputWorkspaceName{"FitPeaksTest_workspace"};
@@ -649,6 +693,48 @@ public:
     return;
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Test that the spectra fitted in parallel get the same results as those
+   * fitted one after the other
+   */
+  void test_resultsDoNotDependOnNumberOfThreads() {
+    AnalysisDataService::Instance().addOrReplace(
+        m_inputWorkspaceName, createGaussianPeaksWorkspace(24));
+
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    fitGaussianPeaks(m_inputWorkspaceName, "SerialPeakPositionsWS");
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+    fitGaussianPeaks(m_inputWorkspaceName, "ParallelPeakPositionsWS");
+
+    auto &ads = AnalysisDataService::Instance();
+    auto serial = ads.retrieveWS<MatrixWorkspace>("SerialPeakPositionsWS");
+    auto parallel = ads.retrieveWS<MatrixWorkspace>("ParallelPeakPositionsWS");
+    TS_ASSERT_EQUALS(parallel->getNumberHistograms(), 24);
+    for (size_t i = 0; i < parallel->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(parallel->y(i).rawData(), serial->y(i).rawData());
+      TS_ASSERT_EQUALS(parallel->e(i).rawData(), serial->e(i).rawData());
+      // the fitted peak positions are good
+      TS_ASSERT(parallel->y(i)[0] > 0.);
+      TS_ASSERT(parallel->y(i)[1] > 0.);
+    }
+
+    auto serialParams =
+        ads.retrieveWS<ITableWorkspace>("SerialPeakPositionsWS_param");
+    auto parallelParams =
+        ads.retrieveWS<ITableWorkspace>("ParallelPeakPositionsWS_param");
+    TS_ASSERT_EQUALS(parallelParams->rowCount(), 2 * 24);
+    for (size_t row = 0; row < parallelParams->rowCount(); ++row)
+      for (size_t col = 2; col < parallelParams->columnCount(); ++col)
+        TS_ASSERT_EQUALS(parallelParams->cell<double>(row, col),
+                         serialParams->cell<double>(row, col));
+
+    ads.remove(m_inputWorkspaceName);
+    ads.remove("SerialPeakPositionsWS");
+    ads.remove("SerialPeakPositionsWS_param");
+    ads.remove("ParallelPeakPositionsWS");
+    ads.remove("ParallelPeakPositionsWS_param");
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Generate peak parameters for Back-to-back exponential convoluted by
    * Gaussian
@@ -861,4 +947,41 @@ public:
   }
 };
 
+class FitPeaksTestPerformance : public CxxTest::TestSuite {
+public:
+  static FitPeaksTestPerformance *createSuite() {
+    API::FrameworkManager::Instance();
+    return new FitPeaksTestPerformance();
+  }
+  static void destroySuite(FitPeaksTestPerformance *suite) { delete suite; }
+
+  void setUp() override {
+    AnalysisDataService::Instance().addOrReplace(
+        "FitPeaksTestPerformance_input", createGaussianPeaksWorkspace(2000));
+  }
+
+  void tearDown() override {
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_fit_1_thread() { fitWithThreads(1); }
+
+  void test_fit_2_threads() { fitWithThreads(2); }
+
+  void test_fit_4_threads() { fitWithThreads(4); }
+
+  void test_fit_all_threads() {
+    fitGaussianPeaks("FitPeaksTestPerformance_input",
+                     "FitPeaksTestPerformance_output");
+  }
+
+private:
+  void fitWithThreads(const int numThreads) {
+    FrameworkManager::Instance().setNumOMPThreads(numThreads);
+    fitGaussianPeaks("FitPeaksTestPerformance_input",
+                     "FitPeaksTestPerformance_output");
+  }
+};
+
 #endif /* MANTID_ALGORITHMS_FITPEAKSTEST_H_ */
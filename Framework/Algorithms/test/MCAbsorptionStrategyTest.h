@@ -7,6 +7,7 @@
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidKernel/MersenneTwister.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MonteCarloTesting.h"
 
@@ -57,6 +58,34 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Multiple_Wavelengths_Match_Separate_Simulations() {
+    using Mantid::Kernel::MersenneTwister;
+    using Mantid::Kernel::V3D;
+
+    auto sampleAndContainer = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SamplePlusContainer);
+    const auto beamProfile = createBeamProfile();
+    const size_t nevents(50), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(beamProfile, sampleAndContainer, nevents,
+                                  maxTries);
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore{1.0, 2.5, 4.0};
+    const std::vector<double> lambdasAfter{1.5, 3.5, 4.0};
+
+    MersenneTwister rng(1);
+    const auto factors =
+        mcabsorb.calculate(rng, endPos, lambdasBefore, lambdasAfter);
+    TS_ASSERT_EQUALS(lambdasBefore.size(), factors.size());
+    for (size_t i = 0; i < factors.size(); ++i) {
+      // The same random numbers give the same tracks
+      MersenneTwister singleRng(1);
+      double factor(0.0);
+      std::tie(factor, std::ignore) = mcabsorb.calculate(
+          singleRng, endPos, lambdasBefore[i], lambdasAfter[i]);
+      TS_ASSERT_DELTA(factor, factors[i], 1e-12);
+    }
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -83,7 +112,29 @@ public:
                      std::runtime_error)
   }
 
+  void test_Different_Numbers_Of_Wavelengths_Are_Not_Accepted() {
+    using Mantid::Kernel::MersenneTwister;
+    using Mantid::Kernel::V3D;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    const auto beamProfile = createBeamProfile();
+    MCAbsorptionStrategy mcabsorb(beamProfile, testSampleSphere, 10, 100);
+    MersenneTwister rng(1);
+    TS_ASSERT_THROWS(mcabsorb.calculate(rng, V3D(0.7, 0.7, 1.4),
+                                        std::vector<double>{1.0, 2.0},
+                                        std::vector<double>{1.0}),
+                     std::invalid_argument)
+  }
+
 private:
+  static Mantid::Algorithms::RectangularBeamProfile createBeamProfile() {
+    using namespace Mantid::Geometry;
+    using Mantid::Kernel::V3D;
+    return Mantid::Algorithms::RectangularBeamProfile(
+        ReferenceFrame(Z, X, Right, "source"), V3D(-2, 0, 0), 0.01, 0.05);
+  }
+
   class MockBeamProfile final : public Mantid::Algorithms::IBeamProfile {
   public:
     using Mantid::Algorithms::IBeamProfile::Ray;
@@ -99,4 +150,50 @@ private:
   };
 };
 
+class MCAbsorptionStrategyTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MCAbsorptionStrategyTestPerformance *createSuite() {
+    return new MCAbsorptionStrategyTestPerformance();
+  }
+  static void destroySuite(MCAbsorptionStrategyTestPerformance *suite) {
+    delete suite;
+  }
+
+  MCAbsorptionStrategyTestPerformance()
+      : m_sample(MonteCarloTesting::createTestSample(
+            MonteCarloTesting::TestSampleType::SamplePlusContainer)),
+        m_beamProfile(Mantid::Geometry::ReferenceFrame(
+                          Mantid::Geometry::Z, Mantid::Geometry::X,
+                          Mantid::Geometry::Right, "source"),
+                      Mantid::Kernel::V3D(-2, 0, 0), 0.01, 0.05),
+        m_endPos(0.7, 0.7, 1.4), m_lambdas(100) {
+    for (size_t i = 0; i < m_lambdas.size(); ++i) {
+      m_lambdas[i] = 0.5 + 0.05 * static_cast<double>(i);
+    }
+  }
+
+  void test_Wavelengths_Simulated_Separately() {
+    MCAbsorptionStrategy mcabsorb(m_beamProfile, m_sample, m_nevents, 100);
+    Mantid::Kernel::MersenneTwister rng(1);
+    for (const auto lambda : m_lambdas) {
+      mcabsorb.calculate(rng, m_endPos, lambda, lambda);
+    }
+  }
+
+  void test_Wavelengths_Simulated_Together() {
+    MCAbsorptionStrategy mcabsorb(m_beamProfile, m_sample, m_nevents, 100);
+    Mantid::Kernel::MersenneTwister rng(1);
+    mcabsorb.calculate(rng, m_endPos, m_lambdas, m_lambdas);
+  }
+
+private:
+  const size_t m_nevents = 10000;
+  Mantid::API::Sample m_sample;
+  Mantid::Algorithms::RectangularBeamProfile m_beamProfile;
+  const Mantid::Kernel::V3D m_endPos;
+  std::vector<double> m_lambdas;
+};
+
 #endif /* MANTID_ALGORITHMS_MCABSORPTIONSTRATEGYTEST_H_ */
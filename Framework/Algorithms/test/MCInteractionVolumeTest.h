@@ -4,6 +4,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
+#include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/MersenneTwister.h"
 #include "MonteCarloTesting.h"
 
@@ -54,6 +55,37 @@ public:
     TS_ASSERT_DELTA(0.0028357258, factor, 1e-8);
   }
 
+  void test_Tracks_Lead_From_Scatter_Point_To_Start_And_End() {
+    using Mantid::Geometry::Track;
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    const V3D startPos(-2.0, 0.0, 0.0), endPos(0.7, 0.7, 1.4);
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(3))
+        .WillRepeatedly(Return(0.25));
+
+    auto sample = createTestSample(TestSampleType::SolidSphere);
+    MCInteractionVolume interactor(sample, sample.getShape().getBoundingBox());
+    Track beforeScatter, afterScatter;
+    TS_ASSERT(interactor.calculateBeforeAfterTrack(
+        rng, startPos, endPos, beforeScatter, afterScatter));
+
+    const V3D scatterPos = beforeScatter.startPoint();
+    TS_ASSERT(sample.getShape().isValid(scatterPos));
+    TS_ASSERT_EQUALS(scatterPos, afterScatter.startPoint());
+    V3D toStart = startPos - scatterPos;
+    toStart.normalize();
+    V3D toEnd = endPos - scatterPos;
+    toEnd.normalize();
+    TS_ASSERT_EQUALS(toStart, beforeScatter.direction());
+    TS_ASSERT_EQUALS(toEnd, afterScatter.direction());
+    TS_ASSERT_EQUALS(1, beforeScatter.count());
+    TS_ASSERT_EQUALS(1, afterScatter.count());
+  }
+
   void test_Absorption_In_Sample_With_Hole_Container_Scatter_In_All_Segments() {
     using Mantid::Kernel::V3D;
     using namespace MonteCarloTesting;
@@ -216,6 +216,28 @@ public:
     TS_ASSERT_DELTA(0.000438, outputWS->y(0).back(), delta);
   }
 
+  void test_Reused_Tracks_Give_Smooth_Curve() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {
+        1, 10, Environment::SampleOnly, DeltaEMode::Elastic, -1, -1};
+    auto mcabs = createAlgorithm();
+    mcabs->setProperty("InputWorkspace", setUpWS(wsProps));
+    mcabs->setProperty("ResimulateTracksForDiffWavelength", false);
+    mcabs->execute();
+    auto outputWS = getOutputWorkspace(mcabs);
+
+    verifyDimensions(wsProps, outputWS);
+    // The first point is simulated with the same events either way
+    const double delta(1e-05);
+    TS_ASSERT_DELTA(0.006335, outputWS->y(0).front(), delta);
+    // Absorption grows with wavelength, so with the same tracks for all
+    // points the correction cannot increase
+    const auto &y = outputWS->y(0);
+    for (size_t i = 1; i < y.size(); ++i) {
+      TS_ASSERT_LESS_THAN_EQUALS(y[i], y[i - 1]);
+    }
+  }
+
   //---------------------------------------------------------------------------
   // Failure cases
   //---------------------------------------------------------------------------
@@ -422,6 +444,15 @@ public:
     alg.execute();
   }
 
+  void test_exec_sample_elastic_reusing_tracks() {
+    Mantid::Algorithms::MonteCarloAbsorption alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputElastic);
+    alg.setProperty("ResimulateTracksForDiffWavelength", false);
+    alg.setPropertyValue("OutputWorkspace", "__unused_on_child");
+    alg.execute();
+  }
+
 private:
   Mantid::API::Workspace_sptr inputElastic;
   Mantid::API::Workspace_sptr inputDirect;
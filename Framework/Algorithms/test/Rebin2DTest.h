@@ -1,6 +1,7 @@
 #ifndef MANTID_ALGORITHMS_REBIN2DTEST_H_
 #define MANTID_ALGORITHMS_REBIN2DTEST_H_
 
+#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidAlgorithms/Rebin2D.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
@@ -77,6 +78,33 @@ MatrixWorkspace_sptr runAlgorithm(MatrixWorkspace_sptr inputWS,
   TS_ASSERT(outputWS);
   return outputWS;
 }
+/// Return an input workspace of many small bins, which is rebinned in
+/// parallel into a partial output per thread
+MatrixWorkspace_sptr makeFineInputWS(const size_t nhist, const size_t nbins) {
+  MatrixWorkspace_sptr ws = WorkspaceCreationHelper::create2DWorkspaceBinned(
+      int(nhist), int(nbins), 0., 1.);
+  NumericAxis *const thetaAxis = new NumericAxis(nhist + 1);
+  for (size_t i = 0; i < nhist + 1; ++i) {
+    thetaAxis->setValue(i, -0.5 + static_cast<double>(i));
+  }
+  ws->replaceAxis(1, thetaAxis);
+  for (size_t i = 0; i < nhist; ++i) {
+    auto &y = ws->mutableY(i);
+    for (size_t j = 0; j < nbins; ++j)
+      y[j] = static_cast<double>((i * 7 + j * 3) % 11);
+  }
+  return ws;
+}
+
+MatrixWorkspace_sptr runAlgorithmWithThreads(MatrixWorkspace_sptr inputWS,
+                                             const std::string &axis1Params,
+                                             const std::string &axis2Params,
+                                             const int nThreads) {
+  FrameworkManager::Instance().setNumOMPThreads(nThreads);
+  auto outputWS = runAlgorithm(inputWS, axis1Params, axis2Params);
+  FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  return outputWS;
+}
 } // namespace
 
 class Rebin2DTest : public CxxTest::TestSuite {
@@ -121,6 +149,32 @@ public:
     checkData(outputWS, 6, 10, false, true, true);
   }
 
+  void test_Parallel_Rebin_Matches_Serial_Rebin() {
+    MatrixWorkspace_sptr inputWS = makeFineInputWS(100, 100);
+    // one thread adds to the output workspace directly, two threads each
+    // fill a partial output
+    MatrixWorkspace_sptr serialWS = runAlgorithmWithThreads(
+        inputWS, "0.,7.5,100.", "-0.5,9.5,99.5", 1)->clone();
+    MatrixWorkspace_sptr parallelWS = runAlgorithmWithThreads(
+        inputWS, "0.,7.5,100.", "-0.5,9.5,99.5", 2);
+
+    TS_ASSERT_EQUALS(parallelWS->getNumberHistograms(),
+                     serialWS->getNumberHistograms());
+    double total(0.);
+    for (size_t i = 0; i < parallelWS->getNumberHistograms(); ++i) {
+      const auto &y = parallelWS->y(i);
+      const auto &e = parallelWS->e(i);
+      TS_ASSERT_EQUALS(y.size(), serialWS->y(i).size());
+      for (size_t j = 0; j < y.size(); ++j) {
+        TS_ASSERT_DELTA(y[j], serialWS->y(i)[j], 1e-10);
+        TS_ASSERT_DELTA(e[j], serialWS->e(i)[j], 1e-10);
+        total += y[j];
+      }
+    }
+    TS_ASSERT(total > 0.);
+    AnalysisDataService::Instance().remove(parallelWS->getName());
+  }
+
   void test_BothAxes() {
     // 5,6,7,8,9,10,11,12,12,14,15
     MatrixWorkspace_sptr inputWS =
@@ -231,6 +285,18 @@ public:
     runAlgorithm(m_inputWS, "100,200,41000", "-0.5,2,499.5");
   }
 
+  void test_Coarse_Rebin_1_Thread() {
+    runAlgorithmWithThreads(m_inputWS, "100,1000,40100", "-0.5,10,499.5", 1);
+  }
+
+  void test_Coarse_Rebin_4_Threads() {
+    runAlgorithmWithThreads(m_inputWS, "100,1000,40100", "-0.5,10,499.5", 4);
+  }
+
+  void test_Coarse_Rebin_All_Threads() {
+    runAlgorithm(m_inputWS, "100,1000,40100", "-0.5,10,499.5");
+  }
+
 private:
   MatrixWorkspace_sptr m_inputWS;
 
@@ -3,8 +3,10 @@
 
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/FrameworkManager.h"
 #include "MantidAlgorithms/SofQWNormalisedPolygon.h"
 #include "MantidKernel/Unit.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include <cxxtest/TestSuite.h>
 
 #include "SofQWTest.h"
@@ -210,10 +212,54 @@ public:
     delete suite;
   }
 
+  SofQWNormalisedPolygonTestPerformance() {
+    // A direct geometry workspace the size of MAPS or MERLIN
+    const size_t nDetectors(70000);
+    std::vector<double> L2(nDetectors, 2.5);
+    std::vector<double> polar(nDetectors);
+    std::vector<double> azimuthal(nDetectors);
+    for (size_t i = 0; i < nDetectors; ++i) {
+      polar[i] = (3. + 132. * static_cast<double>(i) /
+                           static_cast<double>(nDetectors)) *
+                 M_PI / 180.;
+      azimuthal[i] = static_cast<double>(i % 100) * 2. * M_PI / 100.;
+    }
+    m_directWS = WorkspaceCreationHelper::createProcessedInelasticWS(
+        L2, polar, azimuthal, 400, -10., 55., 60.);
+  }
+
   void testExec() {
     auto result =
         SofQWTest::runSQW<Mantid::Algorithms::SofQWNormalisedPolygon>();
   }
+
+  void test_70k_Spectra_Direct_1_Thread() { runDirectWithThreads(1); }
+
+  void test_70k_Spectra_Direct_4_Threads() { runDirectWithThreads(4); }
+
+  void test_70k_Spectra_Direct_All_Threads() { runDirectWithThreads(0); }
+
+private:
+  /// Run on the direct geometry workspace with the given number of threads,
+  /// or with the configured number if it is 0
+  void runDirectWithThreads(const int nThreads) {
+    if (nThreads > 0)
+      FrameworkManager::Instance().setNumOMPThreads(nThreads);
+    SofQWNormalisedPolygon alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.setProperty("InputWorkspace", m_directWS);
+    alg.setPropertyValue("OutputWorkspace", "_unused");
+    alg.setPropertyValue("EMode", "Direct");
+    alg.setProperty("EFixed", 60.);
+    alg.setPropertyValue("QAxisBinning", "0,0.05,10");
+    alg.setPropertyValue("EAxisBinning", "-10,0.5,55");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  }
+
+  MatrixWorkspace_sptr m_directWS;
 };
 
 #endif /* MANTID_ALGORITHMS_SOFQW2TEST_H_ */
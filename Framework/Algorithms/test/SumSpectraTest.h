@@ -2,6 +2,7 @@
 #define SUMSPECTRATEST_H_
 
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAlgorithms/SumSpectra.h"
@@ -273,6 +274,22 @@ public:
                      std::runtime_error);
   }
 
+  void testExecEvent_result_does_not_depend_on_number_of_threads() {
+    auto input = WorkspaceCreationHelper::createEventWorkspace(1000, 10, 10);
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    auto serial = sumEvents(input);
+    FrameworkManager::Instance().setNumOMPThreads(4);
+    auto parallel = sumEvents(input);
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+
+    TS_ASSERT_EQUALS(serial->getNumberEvents(), input->getNumberEvents());
+    TS_ASSERT_EQUALS(parallel->getNumberEvents(), input->getNumberEvents());
+    TS_ASSERT(serial->getSpectrum(0).getEvents() ==
+              parallel->getSpectrum(0).getEvents());
+    TS_ASSERT_EQUALS(serial->getSpectrum(0).getDetectorIDs(),
+                     parallel->getSpectrum(0).getDetectorIDs());
+  }
+
   void dotestExecEvent(std::string inName, std::string outName,
                        std::string indices_list) {
     int numPixels = 100;
@@ -592,6 +609,17 @@ public:
   }
 
 private:
+  EventWorkspace_sptr sumEvents(EventWorkspace_sptr input) {
+    Mantid::Algorithms::SumSpectra alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.execute();
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+    return boost::dynamic_pointer_cast<EventWorkspace>(output);
+  }
+
   int nTestHist;
   Mantid::Algorithms::SumSpectra alg; // Test with range limits
   MatrixWorkspace_sptr inputSpace;
@@ -613,6 +641,9 @@ public:
     input = WorkspaceCreationHelper::create2DWorkspaceBinned(40000, 10000);
     inputEvent =
         WorkspaceCreationHelper::createEventWorkspace(20000, 1000, 2000);
+    // As many pixels as a large powder diffractometer
+    inputManyPixels =
+        WorkspaceCreationHelper::createEventWorkspace(400000, 10, 20);
   }
 
   void testExec2D() {
@@ -633,9 +664,24 @@ public:
     alg.execute();
   }
 
+  void testExecEventManyPixels() {
+    Algorithms::SumSpectra alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputManyPixels);
+    alg.setPropertyValue("OutputWorkspace", "SumSpectraEventOut");
+    alg.execute();
+  }
+
+  void testExecEventManyPixelsSingleThread() {
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    testExecEventManyPixels();
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  }
+
 private:
   MatrixWorkspace_sptr input;
   EventWorkspace_sptr inputEvent;
+  EventWorkspace_sptr inputManyPixels;
 };
 
 #endif /*SUMSPECTRATEST_H_*/
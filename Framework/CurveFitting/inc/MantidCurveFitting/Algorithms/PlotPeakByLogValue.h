@@ -78,6 +78,16 @@ class DLLExport PlotPeakByLogValue : public API::Algorithm {
     std::vector<int> indx; ///< a list of ws indices to fit if i and spec < 0
   };
 
+  /** A spectrum to fit and where its results go
+   */
+  struct SpectrumFit {
+    size_t source;     ///< Index of the InputData the spectrum comes from
+    int wsIndex;       ///< Workspace index of the spectrum
+    double logValue;   ///< Value to plot the fitted parameters against
+    std::string minimizer;  ///< Minimizer string with the names filled in
+    std::string outputName; ///< Base name of the output of Fit, if any
+  };
+
 public:
   /// Algorithm's name for identification overriding a virtual method
   const std::string name() const override { return "PlotPeakByLogValue"; }
@@ -106,6 +116,12 @@ private:
   /// Create a list of input workspace names
   std::vector<InputData> makeNames() const;
 
+  /// Create a Fit algorithm with the options common to all spectra
+  API::IAlgorithm_sptr createFitAlgorithm() const;
+  /// Fit one spectrum, returning the chi squared over degrees of freedom
+  double fitSpectrum(API::IAlgorithm &fit, const API::IFunction_sptr &fun,
+                     const API::MatrixWorkspace_sptr &ws,
+                     const SpectrumFit &spectrum) const;
   /// Create a minimizer string based on template string provided
   std::string getMinimizerString(const std::string &wsName,
                                  const std::string &wsIndex);
@@ -140,8 +140,8 @@ public:
   /// Set up the function for a fit.
   void setUpForFit() override;
 
-  /// Deletes and zeroes pointer m_resolution forsing function(...) to
-  /// recalculate the resolution function
+  /// Deletes m_resolution forcing function(...) to recalculate the
+  /// resolution function
   void refreshResolution() const;
 
 protected:
@@ -153,6 +153,11 @@ private:
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// The domain and resolution parameters m_resolution was calculated for
+  mutable std::vector<double> m_resolutionKey;
+  /// Check if m_resolution is valid for a domain and the current resolution
+  bool isResolutionCached(bool fftMode, const double *xValues, size_t nData,
+                          size_t resolutionSize) const;
 };
 
 } // namespace Functions
@@ -8,6 +8,7 @@
 #include "MantidAPI/IFunctionWithLocation.h"
 #include "MantidAPI/IPeakFunction.h"
 #include <cmath>
+#include <vector>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -83,6 +84,13 @@ private:
   /// Bin width
   double m_eps;
   double m_minEps, m_maxEps;
+
+  /// Tables of the static and dynamic KT computed by the last call of getDKT
+  struct DKTCache {
+    double G = -1., F = -1., v = -1., eps = -1.;
+    std::vector<double> gStat, gDyn;
+  };
+  mutable DKTCache m_cache;
 };
 
 } // namespace Functions
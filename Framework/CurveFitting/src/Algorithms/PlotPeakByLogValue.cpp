@@ -166,15 +166,11 @@ void PlotPeakByLogValue::exec() {
   // Create a list of the input workspace
   const std::vector<InputData> wsNames = makeNames();
 
-  const std::vector<double> exclude = getProperty("Exclude");
   std::string fun = getPropertyValue("Function");
   // int wi = getProperty("WorkspaceIndex");
   std::string logName = getProperty("LogValue");
   bool individual = getPropertyValue("FitType") == "Individual";
-  bool passWSIndexToFunction = getProperty("PassWSIndexToFunction");
   bool createFitOutput = getProperty("CreateOutput");
-  bool outputCompositeMembers = getProperty("OutputCompositeMembers");
-  bool outputConvolvedMembers = getProperty("ConvolveMembers");
   m_baseName = getPropertyValue("OutputWorkspace");
 
   bool isDataName = false; // if true first output column is of type string and
@@ -198,14 +194,6 @@ void PlotPeakByLogValue::exec() {
     throw std::invalid_argument("Fitting function failed to initialize");
   }
 
-  // for inidividual fittings store the initial parameters
-  std::vector<double> initialParams(ifun->nParams());
-  if (individual) {
-    for (size_t i = 0; i < initialParams.size(); ++i) {
-      initialParams[i] = ifun->getParameter(i);
-    }
-  }
-
   for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
     result->addColumn("double", ifun->parameterName(iPar));
     result->addColumn("double", ifun->parameterName(iPar) + "_Err");
@@ -214,23 +202,21 @@ void PlotPeakByLogValue::exec() {
 
   setProperty("OutputWorkspace", result);
 
-  std::vector<std::string> covariance_workspaces;
-  std::vector<std::string> fit_workspaces;
-  std::vector<std::string> parameter_workspaces;
-
-  double dProg = 1. / static_cast<double>(wsNames.size());
-  double Prog = 0.;
-  for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
-    InputData data = getWorkspace(wsNames[i]);
+  // Collect the spectra to fit with the values to plot their parameters
+  // against, and the workspaces they come from
+  std::vector<InputData> inputs;
+  std::vector<SpectrumFit> spectra;
+  for (const auto &wsName : wsNames) {
+    InputData data = getWorkspace(wsName);
 
     if (!data.ws) {
-      g_log.warning() << "Cannot access workspace " << wsNames[i].name << '\n';
+      g_log.warning() << "Cannot access workspace " << wsName.name << '\n';
       continue;
     }
 
     if (data.i < 0 && data.indx.empty()) {
       g_log.warning() << "Zero spectra selected for fitting in workspace "
-                      << wsNames[i].name << '\n';
+                      << wsName.name << '\n';
       continue;
     }
 
@@ -243,13 +229,6 @@ void PlotPeakByLogValue::exec() {
       jend = data.indx.back() + 1;
     }
 
-    if (createFitOutput) {
-      covariance_workspaces.reserve(covariance_workspaces.size() + jend);
-      fit_workspaces.reserve(fit_workspaces.size() + jend);
-      parameter_workspaces.reserve(parameter_workspaces.size() + jend);
-    }
-
-    dProg /= abs(jend - j);
     for (; j < jend; ++j) {
 
       // Find the log value: it is either a log-file value or simply the
@@ -278,102 +257,107 @@ void PlotPeakByLogValue::exec() {
         logValue = logp->lastValue();
       }
 
-      double chi2;
-
-      try {
-        if (passWSIndexToFunction) {
-          setWorkspaceIndexAttribute(ifun, j);
-        }
-
-        g_log.debug() << "Fitting " << data.ws->getName() << " index " << j
-                      << " with \n";
-        g_log.debug() << ifun->asString() << '\n';
-
-        const std::string spectrum_index = std::to_string(j);
-        std::string wsBaseName;
-
-        if (createFitOutput)
-          wsBaseName = wsNames[i].name + "_" + spectrum_index;
-
-        bool histogramFit = getPropertyValue("EvaluationType") == "Histogram";
-        bool ignoreInvalidData = getProperty("IgnoreInvalidData");
-
-        // Fit the function
-        API::IAlgorithm_sptr fit =
-            AlgorithmManager::Instance().createUnmanaged("Fit");
-        fit->initialize();
-        fit->setPropertyValue("EvaluationType",
-                              getPropertyValue("EvaluationType"));
-        fit->setProperty("Function", ifun);
-        fit->setProperty("InputWorkspace", data.ws);
-        fit->setProperty("WorkspaceIndex", j);
-        fit->setPropertyValue("StartX", getPropertyValue("StartX"));
-        fit->setPropertyValue("EndX", getPropertyValue("EndX"));
-        fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
-        fit->setPropertyValue(
-            "Minimizer", getMinimizerString(wsNames[i].name, spectrum_index));
-        fit->setPropertyValue("CostFunction", getPropertyValue("CostFunction"));
-        fit->setPropertyValue("MaxIterations",
-                              getPropertyValue("MaxIterations"));
-        fit->setPropertyValue("PeakRadius", getPropertyValue("PeakRadius"));
-        fit->setProperty("CalcErrors", true);
-        fit->setProperty("CreateOutput", createFitOutput);
-        if (!histogramFit) {
-          fit->setProperty("OutputCompositeMembers", outputCompositeMembers);
-          fit->setProperty("ConvolveMembers", outputConvolvedMembers);
-          fit->setProperty("Exclude", exclude);
-        }
-        fit->setProperty("Output", wsBaseName);
-        fit->execute();
-
-        if (!fit->isExecuted()) {
-          throw std::runtime_error("Fit child algorithm failed: " +
-                                   data.ws->getName());
-        }
-
-        ifun = fit->getProperty("Function");
-        chi2 = fit->getProperty("OutputChi2overDoF");
-
-        if (createFitOutput) {
-          covariance_workspaces.push_back(wsBaseName +
-                                          "_NormalisedCovarianceMatrix");
-          parameter_workspaces.push_back(wsBaseName + "_Parameters");
-          fit_workspaces.push_back(wsBaseName + "_Workspace");
-        }
-
-        g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus")
-                      << ' ' << chi2 << '\n';
+      const std::string spectrum_index = std::to_string(j);
+      SpectrumFit spectrum;
+      spectrum.source = inputs.size();
+      spectrum.wsIndex = j;
+      spectrum.logValue = logValue;
+      spectrum.minimizer = getMinimizerString(wsName.name, spectrum_index);
+      if (createFitOutput)
+        spectrum.outputName = wsName.name + "_" + spectrum_index;
+      spectra.push_back(std::move(spectrum));
+    }
+    inputs.push_back(std::move(data));
+  }
 
-      } catch (...) {
-        g_log.error("Error in Fit ChildAlgorithm");
-        throw;
-      }
+  // The fitted parameters, their errors and chi squared of every spectrum
+  const size_t nSpectra = spectra.size();
+  const size_t nParams = ifun->nParams();
+  std::vector<double> params(nSpectra * nParams);
+  std::vector<double> errors(nSpectra * nParams);
+  std::vector<double> chi2s(nSpectra);
+  auto storeResult = [&](size_t iSpec, const IFunction &fitted, double chi2) {
+    for (size_t iPar = 0; iPar < nParams; ++iPar) {
+      params[iSpec * nParams + iPar] = fitted.getParameter(iPar);
+      errors[iSpec * nParams + iPar] = fitted.getError(iPar);
+    }
+    chi2s[iSpec] = chi2;
+  };
 
-      // Extract the fitted parameters and put them into the result table
-      TableRow row = result->appendRow();
-      if (isDataName) {
-        row << wsNames[i].name;
-      } else {
-        row << logValue;
-      }
+  Progress prog(this, 0.0, 1.0, nSpectra);
+  // Fit declares its output properties on execution, so it can only be run
+  // again when it does not create output
+  const bool reuseFit = !createFitOutput;
+  if (individual) {
+    // Individual fits do not depend on each other: fit them in parallel, each
+    // thread with its own Fit algorithm. Every spectrum starts from a fresh
+    // copy of the initial function, with its errors, ties and constraints.
+    bool threadSafe = true;
+    for (const auto &data : inputs)
+      threadSafe = threadSafe && Kernel::threadSafe(*data.ws);
+    std::vector<IAlgorithm_sptr> fits(
+        static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+    if (reuseFit) {
+      for (auto &fit : fits)
+        fit = createFitAlgorithm();
+    }
 
-      for (size_t iPar = 0; iPar < ifun->nParams(); ++iPar) {
-        row << ifun->getParameter(iPar) << ifun->getError(iPar);
-      }
-      row << chi2;
+    PARALLEL_FOR_IF(threadSafe)
+    for (int64_t iSpec = 0; iSpec < static_cast<int64_t>(nSpectra); ++iSpec) {
+      PARALLEL_START_INTERUPT_REGION
+      const size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+      const auto &spectrum = spectra[iSpec];
+      auto fun = ifun->clone();
+      auto fit = reuseFit ? fits[thread] : createFitAlgorithm();
+      const double chi2 =
+          fitSpectrum(*fit, fun, inputs[spectrum.source].ws, spectrum);
+      storeResult(iSpec, *fun, chi2);
+      prog.report("Fitting Workspace: (" + std::to_string(spectrum.source) +
+                  ") - ");
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  } else {
+    // Sequential fits start from the result of the previous spectrum
+    auto fit = createFitAlgorithm();
+    for (size_t iSpec = 0; iSpec < nSpectra; ++iSpec) {
+      const auto &spectrum = spectra[iSpec];
+      if (!reuseFit)
+        fit = createFitAlgorithm();
+      const double chi2 =
+          fitSpectrum(*fit, ifun, inputs[spectrum.source].ws, spectrum);
+      ifun = fit->getProperty("Function");
+      storeResult(iSpec, *ifun, chi2);
+      prog.report("Fitting Workspace: (" + std::to_string(spectrum.source) +
+                  ") - ");
+    }
+  }
 
-      Prog += dProg;
-      std::string current = std::to_string(i);
-      progress(Prog, ("Fitting Workspace: (" + current + ") - "));
-      interruption_point();
+  // Put the fitted parameters into the result table in the order of the
+  // spectra
+  std::vector<std::string> covariance_workspaces;
+  std::vector<std::string> fit_workspaces;
+  std::vector<std::string> parameter_workspaces;
+  for (size_t iSpec = 0; iSpec < nSpectra; ++iSpec) {
+    const auto &spectrum = spectra[iSpec];
+    TableRow row = result->appendRow();
+    if (isDataName) {
+      row << inputs[spectrum.source].name;
+    } else {
+      row << spectrum.logValue;
+    }
 
-      if (individual) {
-        for (size_t i = 0; i < initialParams.size(); ++i) {
-          ifun->setParameter(i, initialParams[i]);
-        }
-      }
+    for (size_t iPar = 0; iPar < nParams; ++iPar) {
+      row << params[iSpec * nParams + iPar] << errors[iSpec * nParams + iPar];
+    }
+    row << chi2s[iSpec];
 
-    } // for(;j < jend;++j)
+    if (createFitOutput) {
+      covariance_workspaces.push_back(spectrum.outputName +
+                                      "_NormalisedCovarianceMatrix");
+      parameter_workspaces.push_back(spectrum.outputName + "_Parameters");
+      fit_workspaces.push_back(spectrum.outputName + "_Workspace");
+    }
   }
 
   if (createFitOutput) {
@@ -410,6 +394,81 @@ void PlotPeakByLogValue::exec() {
   }
 }
 
+/**
+ * Create a Fit algorithm and set the options which are the same for all the
+ * spectra.
+ * @return The initialized Fit algorithm.
+ */
+API::IAlgorithm_sptr PlotPeakByLogValue::createFitAlgorithm() const {
+  API::IAlgorithm_sptr fit =
+      AlgorithmManager::Instance().createUnmanaged("Fit");
+  fit->initialize();
+  fit->setPropertyValue("EvaluationType", getPropertyValue("EvaluationType"));
+  fit->setPropertyValue("CostFunction", getPropertyValue("CostFunction"));
+  fit->setPropertyValue("MaxIterations", getPropertyValue("MaxIterations"));
+  fit->setPropertyValue("PeakRadius", getPropertyValue("PeakRadius"));
+  fit->setProperty("CalcErrors", true);
+  fit->setProperty("CreateOutput",
+                   static_cast<bool>(getProperty("CreateOutput")));
+  return fit;
+}
+
+/**
+ * Fit a spectrum. The fitted parameters are left in the function.
+ * @param fit :: A Fit algorithm made by createFitAlgorithm.
+ * @param fun :: The function to fit, starting from its current parameters.
+ * @param ws :: The workspace containing the spectrum.
+ * @param spectrum :: The spectrum to fit.
+ * @return The chi squared over the degrees of freedom of the fit.
+ */
+double PlotPeakByLogValue::fitSpectrum(API::IAlgorithm &fit,
+                                       const API::IFunction_sptr &fun,
+                                       const API::MatrixWorkspace_sptr &ws,
+                                       const SpectrumFit &spectrum) const {
+  try {
+    const bool passWSIndexToFunction = getProperty("PassWSIndexToFunction");
+    if (passWSIndexToFunction) {
+      setWorkspaceIndexAttribute(fun, spectrum.wsIndex);
+    }
+
+    g_log.debug() << "Fitting " << ws->getName() << " index "
+                  << spectrum.wsIndex << " with \n";
+    g_log.debug() << fun->asString() << '\n';
+
+    // The data set properties are declared by Fit once the workspace is set
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws);
+    fit.setProperty("WorkspaceIndex", spectrum.wsIndex);
+    fit.setPropertyValue("StartX", getPropertyValue("StartX"));
+    fit.setPropertyValue("EndX", getPropertyValue("EndX"));
+    fit.setProperty("IgnoreInvalidData",
+                    static_cast<bool>(getProperty("IgnoreInvalidData")));
+    fit.setPropertyValue("Minimizer", spectrum.minimizer);
+    if (getPropertyValue("EvaluationType") != "Histogram") {
+      fit.setProperty("OutputCompositeMembers",
+                      static_cast<bool>(getProperty("OutputCompositeMembers")));
+      fit.setProperty("ConvolveMembers",
+                      static_cast<bool>(getProperty("ConvolveMembers")));
+      const std::vector<double> exclude = getProperty("Exclude");
+      fit.setProperty("Exclude", exclude);
+    }
+    fit.setProperty("Output", spectrum.outputName);
+    fit.execute();
+
+    if (!fit.isExecuted()) {
+      throw std::runtime_error("Fit child algorithm failed: " + ws->getName());
+    }
+
+    const double chi2 = fit.getProperty("OutputChi2overDoF");
+    g_log.debug() << "Fit result " << fit.getPropertyValue("OutputStatus")
+                  << ' ' << chi2 << '\n';
+    return chi2;
+  } catch (...) {
+    g_log.error("Error in Fit ChildAlgorithm");
+    throw;
+  }
+}
+
 /** Get a workspace identified by an InputData structure.
  * @param data :: InputData with name and either spec or i fields defined.
  * @return InputData structure with the ws field set if everything was OK.
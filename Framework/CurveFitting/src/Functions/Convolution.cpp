@@ -8,9 +8,13 @@
 #include "MantidAPI/IFunction1D.h"
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
 
+#include <boost/make_shared.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <map>
+#include <mutex>
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft_halfcomplex.h>
@@ -69,18 +73,72 @@ void Convolution::setAttribute(const std::string &attName,
 namespace {
 // anonymous namespace for local definitions
 
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
+// The wavetables of the real and half-complex transforms of one size. They
+// are only read by the transforms, so one plan is shared by all threads.
+struct RealFFTPlan {
+  explicit RealFFTPlan(size_t nData)
+      : wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        wavetableInverse(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  ~RealFFTPlan() {
+    gsl_fft_halfcomplex_wavetable_free(wavetableInverse);
     gsl_fft_real_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
   }
-  gsl_fft_real_workspace *workspace;
+  RealFFTPlan(const RealFFTPlan &) = delete;
+  RealFFTPlan &operator=(const RealFFTPlan &) = delete;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *wavetableInverse;
 };
+
+/// Get the plan for transforms of nData values, creating it on first use
+boost::shared_ptr<const RealFFTPlan> getFFTPlan(size_t nData) {
+  // Fits use a handful of sizes, the limit only guards against many sizes
+  constexpr size_t maxPlans = 64;
+  static std::mutex mutex;
+  static std::map<size_t, boost::shared_ptr<const RealFFTPlan>> plans;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = plans.find(nData);
+  if (found != plans.end())
+    return found->second;
+  if (plans.size() >= maxPlans)
+    plans.clear();
+  auto plan = boost::make_shared<const RealFFTPlan>(nData);
+  plans.emplace(nData, plan);
+  return plan;
+}
+
+// The scratch space of a real fft, which cannot be shared between threads
+struct RealFFTWorkspace {
+  explicit RealFFTWorkspace(size_t nData)
+      : workspace(gsl_fft_real_workspace_alloc(nData)) {}
+  ~RealFFTWorkspace() { gsl_fft_real_workspace_free(workspace); }
+  RealFFTWorkspace(const RealFFTWorkspace &) = delete;
+  RealFFTWorkspace &operator=(const RealFFTWorkspace &) = delete;
+  gsl_fft_real_workspace *workspace;
+};
+
+/// True if GSL has specialised transforms for all the prime factors of n
+bool isFastFFTSize(size_t n) {
+  for (size_t factor : {2, 3, 5, 7}) {
+    while (n % factor == 0)
+      n /= factor;
+  }
+  return n == 1;
+}
+
+/**
+ * The size of the transforms computing a circular convolution of nData
+ * values. Transforms of sizes with a large prime factor take a time
+ * proportional to that factor, so such sizes are zero-padded to a fast size
+ * long enough for the padding to keep the convolution circular in nData.
+ */
+size_t convolutionFFTSize(size_t nData) {
+  if (nData < 2 || isFastFFTSize(nData))
+    return nData;
+  size_t size = 2 * nData - 1;
+  while (!isFastFFTSize(size))
+    ++size;
+  return size;
+}
 } // namespace
 
 /**
@@ -128,12 +186,16 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
-  refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  // When called with only the resolution its transform is returned, which
+  // must have the size of the domain
+  const size_t fftSize =
+      nFunctions() == 1 ? nData : convolutionFFTSize(nData);
+  const auto plan = getFFTPlan(fftSize);
+  RealFFTWorkspace workspace(fftSize);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
-  if (m_resolution.empty()) {
-    m_resolution.resize(nData);
+  if (!isResolutionCached(true, xValues, nData, fftSize)) {
+    std::vector<double> resolution(nData);
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
     std::vector<double> xr(nData);
@@ -156,24 +218,34 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     if (!fun) {
       throw std::runtime_error("Convolution can work only with IFunction1D");
     }
-    fun->function1D(m_resolution.data(), xr.data(), nData);
+    fun->function1D(resolution.data(), xr.data(), nData);
 
     // rotate the data to produce the right transform
     if (odd) {
-      double tmp = m_resolution[nData - 1];
+      double tmp = resolution[nData - 1];
       for (int i = n2 - 1; i >= 0; i--) {
-        m_resolution[n2 + i + 1] = m_resolution[i];
-        m_resolution[i] = m_resolution[n2 + i];
+        resolution[n2 + i + 1] = resolution[i];
+        resolution[i] = resolution[n2 + i];
       }
-      m_resolution[n2] = tmp;
+      resolution[n2] = tmp;
     } else {
       for (int i = 0; i < n2; i++) {
-        double tmp = m_resolution[i];
-        m_resolution[i] = m_resolution[n2 + i];
-        m_resolution[n2 + i] = tmp;
+        double tmp = resolution[i];
+        resolution[i] = resolution[n2 + i];
+        resolution[n2 + i] = tmp;
+      }
+    }
+
+    // In a longer transform the values at negative offsets are repeated at
+    // the end, with zeros between them and the ones at positive offsets
+    m_resolution.assign(fftSize, 0.0);
+    std::copy(resolution.begin(), resolution.end(), m_resolution.begin());
+    if (fftSize > nData) {
+      for (size_t i = 1; i < nData; ++i) {
+        m_resolution[fftSize - i] = resolution[nData - i];
       }
     }
-    gsl_fft_real_transform(m_resolution.data(), 1, nData, workspace.wavetable,
+    gsl_fft_real_transform(m_resolution.data(), 1, fftSize, plan->wavetable,
                            workspace.workspace);
     std::transform(m_resolution.begin(), m_resolution.end(),
                    m_resolution.begin(),
@@ -232,21 +304,28 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   double *out = values.getPointerToCalculated(0);
 
   if (!deltaFunctionsOnly) {
-    // Transform the model function
+    // Transform the model function, zero-padded to the size of the transform
     getFunction(1)->function(domain, values);
-    gsl_fft_real_transform(out, 1, nData, workspace.wavetable,
+    std::vector<double> padded;
+    double *model = out;
+    if (fftSize > nData) {
+      padded.assign(fftSize, 0.0);
+      std::copy(out, out + nData, padded.begin());
+      model = padded.data();
+    }
+    gsl_fft_real_transform(model, 1, fftSize, plan->wavetable,
                            workspace.workspace);
 
     // Fourier transform is integration - multiply by the step in the
     // integration variable
     double dx = nData > 1 ? xValues[1] - xValues[0] : 1.;
-    std::transform(out, out + nData, out,
+    std::transform(model, model + fftSize, model,
                    std::bind2nd(std::multiplies<double>(), dx));
 
-    // now out contains fourier transform of the model function
+    // now model contains fourier transform of the model function
 
-    HalfComplex res(m_resolution.data(), nData);
-    HalfComplex fun(out, nData);
+    HalfComplex res(m_resolution.data(), fftSize);
+    HalfComplex fun(model, fftSize);
 
     // Multiply transforms of the resolution and model functions
     // Result is stored in fun
@@ -260,16 +339,13 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
+    gsl_fft_halfcomplex_inverse(model, 1, fftSize, plan->wavetableInverse,
                                 workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
     dx = nData > 1 ? 1. / (xValues[1] - xValues[0]) : 1.;
-    std::transform(out, out + nData, out,
+    std::transform(model, model + nData, out,
                    std::bind2nd(std::multiplies<double>(), dx));
   } else {
     values.zeroCalculated();
@@ -320,8 +396,6 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
                                                            // x-values
   auto ixN = nData - ixP - 1; // negative x-values (ixP+ixN=nData-1)
 
-  refreshResolution();
-
   // double the domain where to evaluate the convolution. Guarantees complete
   // overlap betwen convolution and signal in the original range.
   const size_t mData = nData + ixN + ixP; // equal to 2*nData-1
@@ -341,13 +415,13 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
   if (!resolution) {
     throw std::runtime_error("Convolution can work only with IFunction1D");
   }
-  if (m_resolution.empty()) {
+  if (!isResolutionCached(false, xValues, nData, nData)) {
     m_resolution.resize(nData);
-  }
-  resolution->function1D(m_resolution.data(), xValues, nData);
+    resolution->function1D(m_resolution.data(), xValues, nData);
 
-  // Reverse the axis of the resolution data
-  std::reverse(m_resolution.begin(), m_resolution.end());
+    // Reverse the axis of the resolution data
+    std::reverse(m_resolution.begin(), m_resolution.end());
+  }
 
   // check for delta functions
   std::vector<boost::shared_ptr<DeltaFunction>> dltFuns;
@@ -474,27 +548,42 @@ size_t Convolution::addFunction(IFunction_sptr f) {
  * Make sure that the resolution is updated if this function is reused in
  * several Fits.
  */
-void Convolution::setUpForFit() { m_resolution.clear(); }
+void Convolution::setUpForFit() { refreshResolution(); }
 
-/// Deletes and zeroes pointer m_resolution forsing function(...) to recalculate
-/// the resolution function
+/// Deletes m_resolution forcing function(...) to recalculate the resolution
+/// function
 void Convolution::refreshResolution() const {
-  // refresh when calculation for the first time
-  bool needRefreshing = m_resolution.empty();
-  if (!needRefreshing) {
-    // if resolution has active parameters always refresh
-    IFunction &res = *getFunction(0);
-    for (size_t i = 0; i < res.nParams(); ++i) {
-      if (res.isActive(i)) {
-        needRefreshing = true;
-        break;
-      }
-    }
+  m_resolution.clear();
+  m_resolutionKey.clear();
+}
+
+/**
+ * Check if m_resolution holds the resolution for a domain and the current
+ * parameters of the resolution function. If not, remember them as the ones
+ * the caller is about to calculate m_resolution for.
+ * @param fftMode :: True for the transform used in FFT mode, false for the
+ * inverted resolution of direct mode.
+ * @param xValues :: The domain.
+ * @param nData :: The size of the domain.
+ * @param resolutionSize :: The size of m_resolution.
+ * @return True if m_resolution can be used as it is.
+ */
+bool Convolution::isResolutionCached(bool fftMode, const double *xValues,
+                                     size_t nData,
+                                     size_t resolutionSize) const {
+  const IFunction &res = *getFunction(0);
+  std::vector<double> key{fftMode ? 1.0 : 0.0, static_cast<double>(nData),
+                          static_cast<double>(resolutionSize), xValues[0],
+                          xValues[nData - 1]};
+  key.reserve(key.size() + res.nParams());
+  for (size_t i = 0; i < res.nParams(); ++i) {
+    key.push_back(res.getParameter(i));
   }
-  if (!needRefreshing)
-    return;
-  // delete fourier transform of the resolution to force its recalculation
+  if (!m_resolution.empty() && key == m_resolutionKey)
+    return true;
   m_resolution.clear();
+  m_resolutionKey = std::move(key);
+  return false;
 }
 
 } // namespace Functions
@@ -30,14 +30,12 @@ void DynamicKuboToyabe::init() {
 //--------------------------------------------------------------------------------------------------------------------------------------
 // From Numerical Recipes
 
-// Midpoint method
+// Midpoint method, refining the estimate s of the previous stage n - 1
 double midpnt(double func(const double, const double, const double),
               const double a, const double b, const int n, const double g,
-              const double w0) {
+              const double w0, double s) {
   // quote & modified from numerical recipe 2nd edtion (page147)
 
-  static double s;
-
   if (n == 1) {
     s = (b - a) * func(0.5 * (a + b), g, w0);
     return (s);
@@ -111,8 +109,9 @@ double integral(double func(const double, const double, const double),
   double h[JMAXP + 1], s[JMAXP];
 
   h[1] = 1.0;
+  s[0] = 0.0;
   for (j = 1; j <= JMAX; j++) {
-    s[j] = midpnt(func, a, b, j, g, w0);
+    s[j] = midpnt(func, a, b, j, g, w0, s[j - 1]);
     if (j >= K) {
       polint(&h[j - K], &s[j - K], K, 0.0, ss, dss);
       if (fabs(dss) <= fabs(ss))
@@ -187,10 +186,16 @@ double DynamicKuboToyabe::getDKT(double t, double G, double F, double v,
 
   const int tsmax = static_cast<int>(std::ceil(32.768 / eps));
 
-  static double oldG = -1., oldV = -1., oldF = -1., oldEps = -1.;
-
-  const int maxTsmax = static_cast<int>(std::ceil(32.768 / m_minEps));
-  static std::vector<double> gStat(maxTsmax), gDyn(maxTsmax);
+  // The tables are kept by each instance, so that functions can be
+  // evaluated in parallel
+  double &oldG = m_cache.G, &oldV = m_cache.v, &oldF = m_cache.F,
+         &oldEps = m_cache.eps;
+  std::vector<double> &gStat = m_cache.gStat, &gDyn = m_cache.gDyn;
+  if (gStat.empty()) {
+    const int maxTsmax = static_cast<int>(std::ceil(32.768 / m_minEps));
+    gStat.resize(maxTsmax);
+    gDyn.resize(maxTsmax);
+  }
 
   if ((G != oldG) || (v != oldV) || (F != oldF) || (eps != oldEps)) {
 
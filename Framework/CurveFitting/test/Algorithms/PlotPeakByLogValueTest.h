@@ -91,6 +91,15 @@ private:
   const int m_ws;
 };
 
+/// A peak on a flat background, moving and broadening with the spectrum
+struct PlotPeak_ShiftingPeak {
+  double operator()(double x, int spec) {
+    const double c = 3. + 0.1 * spec;
+    const double s = 0.2 + 0.005 * spec;
+    return 0.5 + 10. * exp(-0.5 * (x - c) * (x - c) / (s * s));
+  }
+};
+
 class PlotPeakByLogValueTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -613,9 +622,59 @@ public:
     AnalysisDataService::Instance().remove("InputWS");
   }
 
+  void test_individual_fits_do_not_depend_on_number_of_threads() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceFromFunction(
+        PlotPeak_ShiftingPeak(), 12, 0, 10, 0.01);
+    AnalysisDataService::Instance().addOrReplace("PlotPeakShifting", ws);
+
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    auto serial = fitShiftingPeaks("PlotPeakSerial", false);
+    FrameworkManager::Instance().setNumOMPThreads(4);
+    auto parallel = fitShiftingPeaks("PlotPeakParallel", true);
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+
+    TS_ASSERT_EQUALS(serial->rowCount(), 12);
+    TS_ASSERT_EQUALS(parallel->rowCount(), serial->rowCount());
+    TS_ASSERT_EQUALS(parallel->columnCount(), serial->columnCount());
+    for (size_t row = 0; row < serial->rowCount(); ++row) {
+      TS_ASSERT_DELTA(serial->Double(row, 5), 3. + 0.1 * row, 1e-3);
+      for (size_t col = 0; col < serial->columnCount(); ++col) {
+        TS_ASSERT_EQUALS(parallel->Double(row, col), serial->Double(row, col));
+      }
+    }
+
+    // The output of Fit is grouped in the order of the spectra
+    auto parameters =
+        AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>(
+            "PlotPeakParallel_Parameters");
+    TS_ASSERT_EQUALS(parameters->size(), 12);
+    TS_ASSERT_EQUALS(parameters->getItem(0)->getName(),
+                     "PlotPeakShifting_0_Parameters");
+    TS_ASSERT_EQUALS(parameters->getItem(11)->getName(),
+                     "PlotPeakShifting_11_Parameters");
+
+    AnalysisDataService::Instance().clear();
+  }
+
 private:
   WorkspaceGroup_sptr m_wsg;
 
+  TWS_type fitShiftingPeaks(const std::string &outputName,
+                            bool createOutput) {
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakShifting,v");
+    alg.setPropertyValue("OutputWorkspace", outputName);
+    alg.setPropertyValue("FitType", "Individual");
+    alg.setProperty("CreateOutput", createOutput);
+    alg.setPropertyValue("Function", "name=FlatBackground,A0=0.5;name="
+                                     "Gaussian,PeakCentre=3.5,Height=10,"
+                                     "Sigma=0.25");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return WorkspaceCreationHelper::getWS<TableWorkspace>(outputName);
+  }
+
   void createData(bool hist = false) {
     m_wsg.reset(new WorkspaceGroup);
     AnalysisDataService::Instance().add("PlotPeakGroup", m_wsg);
@@ -708,4 +767,48 @@ private:
   }
 };
 
+class PlotPeakByLogValueTestPerformance : public CxxTest::TestSuite {
+public:
+  static PlotPeakByLogValueTestPerformance *createSuite() {
+    return new PlotPeakByLogValueTestPerformance();
+  }
+  static void destroySuite(PlotPeakByLogValueTestPerformance *suite) {
+    delete suite;
+  }
+
+  PlotPeakByLogValueTestPerformance() {
+    FrameworkManager::Instance();
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceFromFunction(
+        PlotPeak_ShiftingPeak(), 1000, 0, 10, 0.01);
+    AnalysisDataService::Instance().addOrReplace("PlotPeakPerformance", ws);
+  }
+
+  ~PlotPeakByLogValueTestPerformance() override {
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_individual_fits() { fit("Individual"); }
+
+  void test_individual_fits_single_thread() {
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    fit("Individual");
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+  }
+
+  void test_sequential_fits() { fit("Sequential"); }
+
+private:
+  void fit(const std::string &fitType) {
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakPerformance,v");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakPerformanceResult");
+    alg.setPropertyValue("FitType", fitType);
+    alg.setPropertyValue("Function", "name=FlatBackground,A0=0.5;name="
+                                     "Gaussian,PeakCentre=3.5,Height=10,"
+                                     "Sigma=0.25");
+    alg.execute();
+  }
+};
+
 #endif /*PLOTPEAKBYLOGVALUETEST_H_*/
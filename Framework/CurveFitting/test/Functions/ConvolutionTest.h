@@ -6,7 +6,9 @@
 #include "MantidCurveFitting/Functions/Convolution.h"
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
 
+#include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/FunctionValues.h"
 #include "MantidDataObjects/TableWorkspace.h"
 
 using namespace Mantid;
@@ -396,12 +398,153 @@ public:
     }
   }
 
+  void test_convolution_with_domain_of_prime_size() {
+    // Transformed with zero padding to a fast size
+    checkConvolutionOfGaussians(113);
+  }
+
+  void test_convolution_with_domain_of_fast_size() {
+    checkConvolutionOfGaussians(120);
+  }
+
+  void test_resolution_is_recalculated_when_its_parameters_change() {
+    Convolution conv;
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("h", 1.0);
+    res->setParameter("s", 2.0);
+    conv.addFunction(res);
+    auto fun = boost::make_shared<ConvolutionTest_Lorentz>();
+    fun->setParameter("c", 0.5);
+    fun->setParameter("w", 0.3);
+    conv.addFunction(fun);
+
+    FunctionDomain1DVector domain(-5.0, 5.0, 101);
+    FunctionValues values(domain);
+    conv.function(domain, values);
+    // The resolution is fixed, but a new value must still be used
+    res->setParameter("s", 0.5);
+    conv.function(domain, values);
+
+    auto expected = evaluateNewConvolution(conv, domain);
+    for (size_t i = 0; i < domain.size(); ++i) {
+      TS_ASSERT_EQUALS(values.getCalculated(i), expected.getCalculated(i));
+    }
+  }
+
+  void test_resolution_is_recalculated_for_a_new_domain() {
+    Convolution conv;
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("h", 1.0);
+    res->setParameter("s", 2.0);
+    conv.addFunction(res);
+    auto fun = boost::make_shared<ConvolutionTest_Lorentz>();
+    fun->setParameter("w", 0.3);
+    conv.addFunction(fun);
+
+    FunctionDomain1DVector domain(-5.0, 5.0, 101);
+    FunctionValues values(domain);
+    conv.function(domain, values);
+
+    FunctionDomain1DVector otherDomain(-4.0, 4.0, 64);
+    FunctionValues otherValues(otherDomain);
+    conv.function(otherDomain, otherValues);
+
+    auto expected = evaluateNewConvolution(conv, otherDomain);
+    for (size_t i = 0; i < otherDomain.size(); ++i) {
+      TS_ASSERT_EQUALS(otherValues.getCalculated(i),
+                       expected.getCalculated(i));
+    }
+  }
+
   void testForCategories() {
     Convolution forCat;
     const std::vector<std::string> categories = forCat.categories();
     TS_ASSERT(categories.size() == 1);
     TS_ASSERT(categories[0] == "General");
   }
+
+private:
+  /// Check the convolution of two gaussians on a domain of N points
+  void checkConvolutionOfGaussians(const int N) {
+    Convolution conv;
+    const double pi = acos(0.) * 2;
+    const double h1 = 3, s1 = pi / 2;
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.0);
+    res->setParameter("h", h1);
+    res->setParameter("s", s1);
+    conv.addFunction(res);
+
+    const double dx = 0.13;
+    const double c2 = dx * N / 2, h2 = 10., s2 = pi / 3;
+    auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("c", c2);
+    fun->setParameter("h", h2);
+    fun->setParameter("s", s2);
+    conv.addFunction(fun);
+
+    FunctionDomain1DVector domain(0.0, dx * (N - 1), N);
+    FunctionValues out(domain);
+    conv.function(domain, out);
+
+    // a convolution of two gaussians is a gaussian with h == hp and s == sp
+    const double sp = s1 * s2 / (s1 + s2);
+    const double hp = h1 * h2 * sqrt(pi / (s1 + s2));
+    for (size_t i = 0; i < domain.size(); i++) {
+      const double xi = domain[i] - c2;
+      TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-10);
+    }
+  }
+
+  /// Evaluate a copy of a convolution, which has not cached anything
+  FunctionValues evaluateNewConvolution(const Convolution &conv,
+                                        const FunctionDomain1D &domain) {
+    auto copy = conv.clone();
+    // a clone is created from a string, set the exact parameters
+    for (size_t i = 0; i < conv.nParams(); ++i) {
+      copy->setParameter(i, conv.getParameter(i));
+    }
+    FunctionValues values(domain);
+    copy->function(domain, values);
+    return values;
+  }
+};
+
+class ConvolutionTestPerformance : public CxxTest::TestSuite {
+public:
+  static ConvolutionTestPerformance *createSuite() {
+    return new ConvolutionTestPerformance();
+  }
+  static void destroySuite(ConvolutionTestPerformance *suite) {
+    delete suite;
+  }
+
+  ConvolutionTestPerformance() {
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("h", 1.0);
+    res->setParameter("s", 50.0);
+    m_conv.addFunction(res);
+    auto fun = boost::make_shared<ConvolutionTest_Lorentz>();
+    fun->setParameter("c", 0.01);
+    fun->setParameter("h", 2.0);
+    fun->setParameter("w", 0.05);
+    m_conv.addFunction(fun);
+  }
+
+  void test_evaluation_on_domain_of_prime_size() { evaluate(2003); }
+
+  void test_evaluation_on_domain_of_fast_size() { evaluate(2000); }
+
+private:
+  void evaluate(size_t nData) {
+    FunctionDomain1DVector domain(-0.5, 0.5, nData);
+    FunctionValues values(domain);
+    for (size_t i = 0; i < 2000; ++i) {
+      m_conv.function(domain, values);
+    }
+  }
+
+  Convolution m_conv;
 };
 
 #endif /*CONVOLUTIONTEST_H_*/
@@ -166,6 +166,9 @@ public:
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
 
+  /// True if the events of each bank are loaded when first accessed
+  bool m_banksOnDemand{false};
+
   /// Pulse times for ALL banks, taken from proton_charge log.
   boost::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
 
@@ -188,6 +191,12 @@ private:
   bool canUseParallelLoader(const bool haveWeights,
                             const bool oldNeXusFileNames,
                             const std::string &classType) const;
+  bool canLoadBanksOnDemand(const bool haveWeights,
+                            const bool oldNeXusFileNames,
+                            const std::string &classType) const;
+  bool supportsParallelEventLoader(const bool haveWeights,
+                                   const bool oldNeXusFileNames,
+                                   const std::string &classType) const;
 
   DataObjects::EventWorkspace_sptr createEmptyEventWorkspace();
 
@@ -197,6 +206,8 @@ private:
       const std::vector<std::string> &bankNames = std::vector<std::string>());
   void deleteBanks(EventWorkspaceCollection_sptr workspace,
                    std::vector<std::string> bankNames);
+  void readTofRange(const std::vector<std::string> &bankNames,
+                    const std::string &classType);
   bool hasEventMonitors();
   void runLoadMonitors();
   /// Set the filters on TOF.
@@ -208,6 +219,9 @@ private:
 
   template <typename T> void filterDuringPause(T workspace);
 
+  /// Store the loaded events as columns
+  void switchToColumnarStorage();
+
   /// Set the top entry field name
   void setTopEntryName();
 
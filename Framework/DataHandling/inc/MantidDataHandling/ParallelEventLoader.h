@@ -47,6 +47,12 @@ public:
                    const std::string &groupName,
                    const std::vector<std::string> &bankNames,
                    const bool eventIDIsSpectrumNumber);
+  static void loadOnDemand(DataObjects::EventWorkspace &ws,
+                           const std::string &filename,
+                           const std::string &groupName,
+                           const std::vector<std::string> &bankNames,
+                           const size_t maxBanksInMemory,
+                           const bool columnarStorage);
 };
 
 } // namespace DataHandling
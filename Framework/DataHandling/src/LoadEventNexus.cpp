@@ -22,6 +22,7 @@
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <algorithm>
 #include <boost/function.hpp>
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
@@ -159,6 +160,14 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  declareProperty(make_unique<PropertyWithValue<bool>>(
+                      "ColumnarEventStorage", false, Direction::Input),
+                  "Store the events of each spectrum as separate arrays of "
+                  "time-of-flight, pulse time and weight (optional, default "
+                  "False). This speeds up algorithms that only use the "
+                  "time-of-flight, e.g. unit conversion and rebinning. Other "
+                  "algorithms convert the events back as needed.");
+
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -173,9 +182,29 @@ void LoadEventNexus::init() {
   setPropertySettings("TotalChunks", make_unique<VisibleWhenProperty>(
                                          "ChunkNumber", IS_NOT_DEFAULT));
 
+  declareProperty(
+      make_unique<PropertyWithValue<bool>>("LoadBanksOnDemand", false,
+                                           Direction::Input),
+      "Load the events of a bank only when a spectrum of the bank is first "
+      "used (optional, default False). Falls back to loading all events if "
+      "the file or the other options do not allow it.");
+  declareProperty("MaxBanksInMemory", EMPTY_INT(), mustBePositive,
+                  "When loading banks on demand, the number of banks read "
+                  "one at a time by operations over all spectra to keep in "
+                  "memory. The least recently used bank is freed and loaded "
+                  "again when needed. Banks whose spectra were accessed "
+                  "individually are always kept. Leave blank to keep all "
+                  "banks.");
+  setPropertySettings("MaxBanksInMemory",
+                      make_unique<VisibleWhenProperty>("LoadBanksOnDemand",
+                                                       IS_EQUAL_TO, "1"));
+
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("ColumnarEventStorage", grp3);
+  setPropertyGroup("LoadBanksOnDemand", grp3);
+  setPropertyGroup("MaxBanksInMemory", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -367,6 +396,11 @@ void LoadEventNexus::exec() {
   // think)
   filterDuringPause(m_ws->getSingleHeldWorkspace());
 
+  // Banks loaded on demand are switched when they are loaded
+  const bool columnarStorage = getProperty("ColumnarEventStorage");
+  if (columnarStorage && !m_banksOnDemand)
+    switchToColumnarStorage();
+
   // add filename
   m_ws->mutableRun().addProperty("Filename", m_filename);
   // Save output
@@ -383,6 +417,22 @@ void LoadEventNexus::exec() {
   }
 }
 
+/**
+ * Store the events of every spectrum, in all periods, as columns.
+ */
+void LoadEventNexus::switchToColumnarStorage() {
+  const auto numHistograms = static_cast<int64_t>(m_ws->getNumberHistograms());
+  for (size_t period = 0; period < m_ws->nPeriods(); ++period) {
+    PARALLEL_FOR_IF(Kernel::threadSafe(*m_ws))
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      m_ws->getSpectrum(i, period).switchToColumnarStorage();
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  }
+}
+
 /**
  * Get the number of events in the currently opened group.
  *
@@ -790,7 +840,33 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   longest_tof = 0.;
 
   bool loaded{false};
-  if (canUseParallelLoader(haveWeights, oldNeXusFileNames, classType)) {
+  m_banksOnDemand = false;
+  if (!monitors &&
+      canLoadBanksOnDemand(haveWeights, oldNeXusFileNames, classType)) {
+    const int maxBanksInMemory = getProperty("MaxBanksInMemory");
+    const bool columnarStorage = getProperty("ColumnarEventStorage");
+    m_file->close();
+    try {
+      ParallelEventLoader::loadOnDemand(
+          *m_ws->getSingleHeldWorkspace(), m_filename, m_top_entry_name,
+          bankNames,
+          isEmpty(maxBanksInMemory) ? 0
+                                    : static_cast<size_t>(maxBanksInMemory),
+          columnarStorage);
+      g_log.information() << "Events will be loaded on demand.\n";
+      loaded = true;
+      m_banksOnDemand = true;
+    } catch (const std::invalid_argument &e) {
+      g_log.warning() << "Cannot load banks on demand (" << e.what()
+                      << "), loading all events.\n";
+    }
+    safeOpenFile(m_filename);
+    // Give the spectra the same X axis as when loading all events
+    if (m_banksOnDemand)
+      readTofRange(bankNames, classType);
+  }
+  if (!loaded &&
+      canUseParallelLoader(haveWeights, oldNeXusFileNames, classType)) {
     auto ws = m_ws->getSingleHeldWorkspace();
     m_file->close();
     try {
@@ -816,12 +892,14 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
                              totalChunks);
   }
 
-  // Info reporting
-  const std::size_t eventsLoaded = m_ws->getNumberEvents();
-  g_log.information() << "Read " << eventsLoaded << " events"
-                      << ". Shortest TOF: " << shortest_tof
-                      << " microsec; longest TOF: " << longest_tof
-                      << " microsec.\n";
+  // Info reporting, counting the events would load all banks
+  const std::size_t eventsLoaded =
+      m_banksOnDemand ? 0 : m_ws->getNumberEvents();
+  if (!m_banksOnDemand)
+    g_log.information() << "Read " << eventsLoaded << " events"
+                        << ". Shortest TOF: " << shortest_tof
+                        << " microsec; longest TOF: " << longest_tof
+                        << " microsec.\n";
 
   if (shortest_tof < 0)
     g_log.warning() << "The shortest TOF was negative! At least 1 event has an "
@@ -856,7 +934,7 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     }
   }
   // Now, create a default X-vector for histogramming, with just 2 bins.
-  if (eventsLoaded > 0)
+  if (eventsLoaded > 0 || (m_banksOnDemand && shortest_tof <= longest_tof))
     m_ws->setAllX(HistogramData::BinEdges{shortest_tof - 1, longest_tof + 1});
   else
     m_ws->setAllX(HistogramData::BinEdges{0.0, 1.0});
@@ -1329,12 +1407,68 @@ bool LoadEventNexus::canUseParallelLoader(const bool haveWeights,
   // Actually the parallel loader would work also in non-MPI builds but it is
   // likely to be slower than the default loader and may also exhibit unusual
   // behavior for non-standard Nexus files.
+  UNUSED_ARG(haveWeights);
+  UNUSED_ARG(oldNeXusFileNames);
+  UNUSED_ARG(classType);
   return false;
 #else
   bool useParallelLoader = getProperty("UseParallelLoader");
   if (!useParallelLoader)
     return false;
+  return supportsParallelEventLoader(haveWeights, oldNeXusFileNames, classType);
 #endif
+}
+
+/// Loading banks on demand uses the parallel loader for each bank, so it has
+/// the same restrictions. In addition, event IDs must be detector IDs and no
+/// T0 offset can be applied.
+bool LoadEventNexus::canLoadBanksOnDemand(const bool haveWeights,
+                                          const bool oldNeXusFileNames,
+                                          const std::string &classType) const {
+  const bool banksOnDemand = getProperty("LoadBanksOnDemand");
+  if (!banksOnDemand)
+    return false;
+  if (event_id_is_spec)
+    return false;
+  if (m_ws->getInstrument()->hasParameter("T0"))
+    return false;
+  if (!supportsParallelEventLoader(haveWeights, oldNeXusFileNames, classType)) {
+    g_log.warning() << "LoadBanksOnDemand is not supported with the given "
+                       "options or file, loading all events.\n";
+    return false;
+  }
+  return true;
+}
+
+/** Find the shortest and longest TOF of the events in the given banks. The
+ * TOFs are read one bank at a time and not kept, so that banks loaded on
+ * demand get the X axis of the loaded events without holding them.
+ * @param bankNames :: the event data groups to read
+ * @param classType :: the Nexus class of the groups
+ */
+void LoadEventNexus::readTofRange(const std::vector<std::string> &bankNames,
+                                  const std::string &classType) {
+  m_file->openPath("/" + m_top_entry_name);
+  std::vector<double> tofs;
+  for (const auto &bankName : bankNames) {
+    m_file->openGroup(bankName, classType);
+    m_file->openData("event_time_offset");
+    m_file->getDataCoerce(tofs);
+    m_file->closeData();
+    m_file->closeGroup();
+    if (tofs.empty())
+      continue;
+    const auto range = std::minmax_element(tofs.cbegin(), tofs.cend());
+    shortest_tof = std::min(shortest_tof, *range.first);
+    longest_tof = std::max(longest_tof, *range.second);
+  }
+  m_file->closeGroup();
+}
+
+/// Checks the special cases ParallelEventLoader does not support.
+bool LoadEventNexus::supportsParallelEventLoader(
+    const bool haveWeights, const bool oldNeXusFileNames,
+    const std::string &classType) const {
   if (m_ws->nPeriods() != 1)
     return false;
   if (haveWeights)
@@ -1293,6 +1293,11 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   }
 
   int blocksize = 8;
+  if (!m_interval && !m_list) {
+    // Read whole workspaces a compressed chunk of SaveNexusProcessed at a
+    // time, so that each chunk is decompressed once
+    blocksize = std::max(blocksize, rowsPerNexusChunk(nspectra, nchannels));
+  }
   // const int fullblocks = nspectra / blocksize;
   // size of the workspace
   // have to cast down to int as later functions require ints
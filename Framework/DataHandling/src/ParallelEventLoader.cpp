@@ -1,11 +1,18 @@
 #include "MantidDataHandling/ParallelEventLoader.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/LazyEventBanks.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/make_unique.h"
+#include "MantidParallel/Communicator.h"
 #include "MantidParallel/IO/EventLoader.h"
 #include "MantidTypes/Event/TofEvent.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <stdexcept>
+
 namespace Mantid {
 namespace DataHandling {
 
@@ -74,6 +81,113 @@ std::vector<int32_t> bankOffsetsSpectrumNumbers(
   return bankOffsets;
 }
 
+namespace {
+/// Loads the events of one bank at a time with Parallel::IO::EventLoader.
+class NexusEventBanks : public DataObjects::LazyEventBanks {
+public:
+  NexusEventBanks(std::vector<size_t> bankOfSpectrum,
+                  const size_t maxBanksInMemory,
+                  const Parallel::Communicator &communicator,
+                  const std::string &filename, const std::string &groupName,
+                  const std::vector<std::string> &bankNames,
+                  std::vector<int32_t> offsets,
+                  std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+                  const bool columnarStorage)
+      : LazyEventBanks(std::move(bankOfSpectrum), bankNames.size(),
+                       maxBanksInMemory),
+        m_communicator(communicator), m_filename(filename),
+        m_groupName(groupName), m_bankNames(bankNames),
+        m_offsets(std::move(offsets)), m_eventLists(std::move(eventLists)),
+        m_columnarStorage(columnarStorage) {}
+
+protected:
+  void loadBank(const std::vector<DataObjects::EventList *> &spectra,
+                const size_t bank) override {
+    Parallel::IO::EventLoader::load(m_communicator, m_filename, m_groupName,
+                                    {m_bankNames[bank]}, {m_offsets[bank]},
+                                    m_eventLists);
+    for (const auto index : spectraOfBank(bank)) {
+      // Events are stored in the file in the order of their pulse
+      spectra[index]->setSortOrder(DataObjects::PULSETIME_SORT);
+      if (m_columnarStorage)
+        spectra[index]->switchToColumnarStorage();
+    }
+  }
+
+private:
+  Parallel::Communicator m_communicator;
+  const std::string m_filename;
+  const std::string m_groupName;
+  const std::vector<std::string> m_bankNames;
+  const std::vector<int32_t> m_offsets;
+  /// Event vectors of all spectra, obtained while the lists were TOF events
+  const std::vector<std::vector<Types::Event::TofEvent> *> m_eventLists;
+  const bool m_columnarStorage;
+};
+
+/** Return the bank index of each spectrum, assuming the events in the Nexus
+ * group "<name>_events" belong to the detectors of instrument component
+ * "<name>", as for SNS files. The assumption is checked with an event ID read
+ * from each bank, and all detectors of a spectrum must be in the same bank.
+ * @throws std::invalid_argument if the banks do not match the instrument
+ */
+std::vector<size_t> bankOfSpectrum(const API::MatrixWorkspace &ws,
+                                   const std::string &filename,
+                                   const std::string &groupName,
+                                   const std::vector<std::string> &bankNames) {
+  const auto &componentInfo = ws.componentInfo();
+  const auto &detectorInfo = ws.detectorInfo();
+  std::vector<size_t> bankOfDetector(detectorInfo.size(),
+                                     DataObjects::LazyEventBanks::NO_BANK);
+  const std::string suffix("_events");
+  for (size_t bank = 0; bank < bankNames.size(); ++bank) {
+    const auto &name = bankNames[bank];
+    if (name.size() <= suffix.size() ||
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+      throw std::invalid_argument("bank " + name + " is not named after an "
+                                  "instrument component");
+    // Throws std::invalid_argument if there is no such component
+    const auto componentIndex =
+        componentInfo.indexOfAny(name.substr(0, name.size() - suffix.size()));
+    for (const auto detector :
+         componentInfo.detectorsInSubtree(componentIndex))
+      bankOfDetector[detector] = bank;
+  }
+
+  const auto &idToBank = Parallel::IO::EventLoader::makeAnyEventIdToBankMap(
+      filename, groupName, bankNames);
+  for (const auto &idAndBank : idToBank) {
+    size_t detector;
+    try {
+      detector = detectorInfo.indexOf(idAndBank.first);
+    } catch (std::out_of_range &) {
+      detector = DataObjects::LazyEventBanks::NO_BANK;
+    }
+    if (detector == DataObjects::LazyEventBanks::NO_BANK ||
+        bankOfDetector[detector] != idAndBank.second)
+      throw std::invalid_argument(
+          "the events of bank " + bankNames[idAndBank.second] +
+          " are not from the detectors of its instrument component");
+  }
+
+  const auto &spectrumInfo = ws.spectrumInfo();
+  std::vector<size_t> banks(ws.getNumberHistograms(),
+                            DataObjects::LazyEventBanks::NO_BANK);
+  for (size_t i = 0; i < banks.size(); ++i) {
+    const auto &definition = spectrumInfo.spectrumDefinition(i);
+    if (definition.size() == 0)
+      continue;
+    banks[i] = bankOfDetector[definition[0].first];
+    for (const auto &index : definition)
+      if (bankOfDetector[index.first] != banks[i])
+        throw std::invalid_argument(
+            "spectrum " + std::to_string(i) +
+            " has detectors of different banks or outside of the banks");
+  }
+  return banks;
+}
+} // namespace
+
 /// Load events from given banks into given EventWorkspace.
 void ParallelEventLoader::load(DataObjects::EventWorkspace &ws,
                                const std::string &filename,
@@ -94,5 +208,33 @@ void ParallelEventLoader::load(DataObjects::EventWorkspace &ws,
                                   std::move(eventLists));
 }
 
+/** Set up the given EventWorkspace to load the events of each bank only when
+ * a spectrum of the bank is first accessed. Event IDs must be detector IDs.
+ * @param ws :: the workspace, with empty event lists
+ * @param filename :: the Nexus file
+ * @param groupName :: the entry containing the banks
+ * @param bankNames :: the event data groups, "<component name>_events"
+ * @param maxBanksInMemory :: the number of banks that have only been read to
+ * keep in memory before evicting the least recently used one, 0 for no limit
+ * @param columnarStorage :: store the events of each bank as columns
+ * @throws std::invalid_argument if the banks do not match the instrument
+ */
+void ParallelEventLoader::loadOnDemand(
+    DataObjects::EventWorkspace &ws, const std::string &filename,
+    const std::string &groupName, const std::vector<std::string> &bankNames,
+    const size_t maxBanksInMemory, const bool columnarStorage) {
+  auto banks = bankOfSpectrum(ws, filename, groupName, bankNames);
+  const size_t size = ws.getNumberHistograms();
+  std::vector<std::vector<Types::Event::TofEvent> *> eventLists(size, nullptr);
+  for (size_t i = 0; i < size; ++i)
+    DataObjects::getEventsFrom(ws.getSpectrum(i), eventLists[i]);
+  auto offsets = bankOffsets(ws, filename, groupName, bankNames);
+
+  ws.setLazyEventBanks(Kernel::make_unique<NexusEventBanks>(
+      std::move(banks), maxBanksInMemory, ws.indexInfo().communicator(),
+      filename, groupName, bankNames, std::move(offsets), std::move(eventLists),
+      columnarStorage));
+}
+
 } // namespace DataHandling
 } // namespace Mantid
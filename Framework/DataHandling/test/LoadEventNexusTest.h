@@ -519,6 +519,66 @@ public:
     }
   }
 
+  void test_Load_ColumnarEventStorage() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_columnar";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setProperty<bool>("ColumnarEventStorage", true);
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    EventWorkspace_sptr WS;
+    TS_ASSERT_THROWS_NOTHING(
+        WS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            outws_name));
+    TS_ASSERT(WS);
+    TS_ASSERT_EQUALS(WS->getNumberHistograms(), 51200);
+    TS_ASSERT_EQUALS(WS->getNumberEvents(), 112266);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++)
+      TS_ASSERT(WS->getSpectrum(wi).hasColumnarStorage());
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
+  void test_Load_BanksOnDemand() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_on_demand";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setProperty<bool>("LoadBanksOnDemand", true);
+    ld.setProperty<int>("MaxBanksInMemory", 2);
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    EventWorkspace_sptr WS;
+    TS_ASSERT_THROWS_NOTHING(
+        WS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            outws_name));
+    TS_ASSERT(WS);
+    TS_ASSERT(WS->hasLazyEventBanks());
+    TS_ASSERT(WS->threadSafe());
+    TS_ASSERT_EQUALS(WS->getNumberHistograms(), 51200);
+
+    // Compare a few spectra with the default loader
+    auto reference = load_reference_workspace("CNCS_7860_event.nxs");
+    const EventWorkspace &constWS = *WS;
+    for (size_t wi : {0, 1024, 25000, 51199}) {
+      TS_ASSERT_EQUALS(constWS.getSpectrum(wi).getNumberEvents(),
+                       reference->getSpectrum(wi).getNumberEvents());
+      // The X axis covers the events although they were not all loaded
+      TS_ASSERT_DELTA(constWS.x(wi).front(), reference->x(wi).front(), 1e-6);
+      TS_ASSERT_DELTA(constWS.x(wi).back(), reference->x(wi).back(), 1e-6);
+    }
+    TS_ASSERT_EQUALS(WS->getNumberEvents(), 112266);
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
   void test_Monitors() {
     // Uses the workspace loaded in the last test to save a load execution
     std::string mon_outws_name = "cncs_compressed_monitors";
@@ -925,6 +925,62 @@ public:
     doTestLoadAndSaveHistogramWS(true, false, true);
   }
 
+  void test_SaveAndLoadOnHistogramWSSpanningSeveralChunks() {
+    // 1000 bins of doubles make chunks of 131 spectra, so the last chunk is
+    // only partly filled
+    const size_t nSpectra = 300;
+    const size_t nBins = 1000;
+    MatrixWorkspace_sptr inputWs =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(nSpectra, nBins);
+    for (size_t i = 0; i < nSpectra; ++i) {
+      auto &y = inputWs->mutableY(i);
+      auto &e = inputWs->mutableE(i);
+      for (size_t j = 0; j < nBins; ++j) {
+        y[j] = static_cast<double>(i * nBins + j);
+        e[j] = static_cast<double>(j);
+      }
+    }
+    const std::string filename = "TestSaveAndLoadNexusProcessedChunks.nxs";
+    IAlgorithm_sptr save =
+        AlgorithmManager::Instance().create("SaveNexusProcessed");
+    save->initialize();
+    save->setProperty("InputWorkspace", inputWs);
+    save->setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(save->execute());
+    const std::string filePath = save->getPropertyValue("Filename");
+
+    // The values are stored in chunks of whole spectra
+    auto fid = H5Fopen(filePath.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    auto values_id =
+        H5Dopen(fid, "mantid_workspace_1/workspace/values", H5P_DEFAULT);
+    auto plist_id = H5Dget_create_plist(values_id);
+    hsize_t chunk[2] = {0, 0};
+    TS_ASSERT_EQUALS(H5Pget_chunk(plist_id, 2, chunk), 2);
+    TS_ASSERT_EQUALS(chunk[0], 131);
+    TS_ASSERT_EQUALS(chunk[1], nBins);
+    H5Pclose(plist_id);
+    H5Dclose(values_id);
+    H5Fclose(fid);
+
+    IAlgorithm_sptr load =
+        AlgorithmManager::Instance().create("LoadNexusProcessed");
+    load->initialize();
+    load->setPropertyValue("Filename", filename);
+    load->setPropertyValue("OutputWorkspace", "output");
+    TS_ASSERT_THROWS_NOTHING(load->execute());
+
+    MatrixWorkspace_sptr outputWs =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("output");
+    TS_ASSERT_EQUALS(outputWs->getNumberHistograms(), nSpectra);
+    for (size_t i = 0; i < nSpectra; ++i) {
+      TS_ASSERT_EQUALS(inputWs->y(i), outputWs->y(i));
+      TS_ASSERT_EQUALS(inputWs->e(i), outputWs->e(i));
+    }
+
+    AnalysisDataService::Instance().remove("output");
+    Poco::File(filePath).remove();
+  }
+
   void test_SaveAndLoadOnPointLikeWS() { doTestLoadAndSavePointWS(false); }
 
   void test_SaveAndLoadOnPointLikeWSWithXErrors() {
@@ -1447,6 +1503,16 @@ public:
     TS_ASSERT(loader.execute());
   }
 
+  void testSaveAndLoadHistogramWorkspace() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(10000, 1000);
+    doSaveAndLoad(ws, "LoadNexusProcessedTestPerformance_histogram.nxs");
+  }
+
+  void testSaveAndLoadEventWorkspace() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(10000, 100, 1000);
+    doSaveAndLoad(ws, "LoadNexusProcessedTestPerformance_event.nxs");
+  }
+
   void testPeaksWorkspace() {
     LoadNexusProcessed loader;
     loader.initialize();
@@ -1454,6 +1520,26 @@ public:
     loader.setPropertyValue("OutputWorkspace", "peaks");
     TS_ASSERT(loader.execute());
   }
+
+private:
+  void doSaveAndLoad(const MatrixWorkspace_sptr &ws,
+                     const std::string &filename) {
+    SaveNexusProcessed saver;
+    saver.initialize();
+    saver.setProperty("InputWorkspace", ws);
+    saver.setPropertyValue("Filename", filename);
+    TS_ASSERT(saver.execute());
+    const std::string filePath = saver.getPropertyValue("Filename");
+
+    LoadNexusProcessed loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", filePath);
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    TS_ASSERT(loader.execute());
+
+    AnalysisDataService::Instance().remove("ws");
+    Poco::File(filePath).remove();
+  }
 };
 
 #endif /*LOADNEXUSPROCESSEDTESTRAW_H_*/
@@ -6,7 +6,10 @@
 #include "MantidKernel/DiskBuffer.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
 
 namespace Mantid {
 namespace DataObjects {
@@ -15,6 +18,10 @@ namespace DataObjects {
 /** The class responsible for saving events into nexus file using generic box
   controller interface
   * Expected to provide thread-safe file access.
+  *
+  * Blocks requested with prefetchBlock are read by a background thread and
+  * kept until they are loaded, so that reading the file overlaps with the
+  * processing of the blocks loaded before.
 
     @date March 15, 2013
 
@@ -41,6 +48,18 @@ namespace DataObjects {
 */
 class DLLExport BoxControllerNeXusIO : public API::IBoxControllerIO {
 public:
+  /// Counters of the blocks read ahead in the background
+  struct PrefetchStatistics {
+    /// blocks loaded from the data read in the background
+    size_t hits = 0;
+    /// blocks loaded directly from the file
+    size_t misses = 0;
+    /// blocks read in the background
+    size_t prefetched = 0;
+    /// blocks read in the background but never loaded
+    size_t discarded = 0;
+  };
+
   BoxControllerNeXusIO(API::BoxController *const bc);
 
   ///@return true if the file to write events is opened and false otherwise
@@ -63,6 +82,11 @@ public:
                  const uint64_t /*blockPosition*/,
                  const size_t /*BlockSize*/) const override;
 
+  void prefetchBlock(const uint64_t blockPosition,
+                     const size_t nPoints) const override;
+  void cancelPrefetch(const uint64_t blockPosition) const override;
+  PrefetchStatistics getPrefetchStatistics() const;
+
   void flushData() const override;
   void closeFile() override;
 
@@ -106,6 +130,29 @@ private:
   /// lock Nexus file operations as Nexus is not thread safe
   mutable std::mutex m_fileMutex;
 
+  /// A data block read ahead, in the format of the data in the file
+  struct PrefetchedBlock {
+    size_t nPoints = 0;
+    std::vector<float> floatData;
+    std::vector<double> doubleData;
+  };
+  /// lock the prefetch queue and the blocks read ahead
+  mutable std::mutex m_prefetchMutex;
+  /// signals new requests to the prefetch thread and new blocks to readers
+  mutable std::condition_variable m_prefetchCondition;
+  /// blocks (position and number of points) waiting to be read ahead
+  mutable std::deque<std::pair<uint64_t, size_t>> m_prefetchQueue;
+  /// blocks read ahead by their position in the file
+  mutable std::map<uint64_t, PrefetchedBlock> m_prefetched;
+  /// the thread reading ahead, started on the first request
+  mutable std::thread m_prefetchThread;
+  /// position of the block the prefetch thread is reading, if any
+  mutable uint64_t m_prefetchInProgress;
+  /// tells the prefetch thread to finish
+  mutable bool m_stopPrefetch;
+  /// counters of the blocks read ahead
+  mutable PrefetchStatistics m_prefetchStatistics;
+
   // Mainly static information which may be split into different IO classes
   // selected through chein of responsibility.
   /// number of bytes in the event coorinates (coord_t length). Set by
@@ -161,6 +208,17 @@ private:
   template <typename Type>
   void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition,
                         const size_t nPoints) const;
+
+  void prefetchLoop() const;
+  void stopPrefetching();
+  void discardPrefetched(const uint64_t blockPosition,
+                         const size_t nPoints) const;
+  bool takePrefetched(const uint64_t blockPosition, const size_t nPoints,
+                      PrefetchedBlock &block) const;
+  template <typename Type>
+  bool loadPrefetchedBlock(std::vector<Type> &Block,
+                           const uint64_t blockPosition,
+                           const size_t nPoints) const;
 };
 } // namespace DataObjects
 } // namespace Mantid
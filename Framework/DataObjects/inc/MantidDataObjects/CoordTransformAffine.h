@@ -48,6 +48,9 @@ public:
                           const Mantid::Kernel::VMD &scaling);
 
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyToColumns(const coord_t *inputColumns, coord_t *outColumns,
+                      const size_t numPoints,
+                      const size_t stride) const override;
 
   static CoordTransformAffine *combineTransformations(CoordTransform *first,
                                                       CoordTransform *second);
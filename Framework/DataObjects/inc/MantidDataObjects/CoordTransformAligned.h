@@ -66,6 +66,9 @@ public:
   std::string toXMLString() const override;
   std::string id() const override;
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyToColumns(const coord_t *inputColumns, coord_t *outColumns,
+                      const size_t numPoints,
+                      const size_t stride) const override;
   Mantid::Kernel::Matrix<coord_t> makeAffineMatrix() const override;
 
 protected:
@@ -0,0 +1,78 @@
+#ifndef MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+#define MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+
+#include "MantidDataObjects/Events.h"
+#include "MantidKernel/System.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventColumns : The events of an EventList stored as a structure of arrays,
+ * with one array per event field, instead of an array of TofEvent,
+ * WeightedEvent or WeightedEventNoTime.
+ *
+ * Operations that only need the time-of-flight then stream through a dense
+ * array of doubles. Columns that the event type does not carry are left
+ * empty: TofEvent has no weight or error, WeightedEventNoTime has no pulse
+ * time.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport EventColumns {
+public:
+  void assign(const std::vector<Types::Event::TofEvent> &events);
+  void assign(const std::vector<WeightedEvent> &events);
+  void assign(const std::vector<WeightedEventNoTime> &events);
+
+  void copyTo(std::vector<Types::Event::TofEvent> &events) const;
+  void copyTo(std::vector<WeightedEvent> &events) const;
+  void copyTo(std::vector<WeightedEventNoTime> &events) const;
+
+  /// @return the number of events
+  size_t size() const { return tof.size(); }
+  /// @return true if there are no events
+  bool empty() const { return tof.empty(); }
+
+  void clear();
+  size_t getMemorySize() const;
+
+  void sortByTof();
+  void reverse();
+  void convertTof(const double factor, const double offset);
+
+  /// Time-of-flight of each event
+  std::vector<double> tof;
+  /// Pulse time of each event, in nanoseconds; empty for WeightedEventNoTime
+  std::vector<int64_t> pulseTime;
+  /// Weight of each event; empty for TofEvent
+  std::vector<float> weight;
+  /// Squared error of each event; empty for TofEvent
+  std::vector<float> errorSquared;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTCOLUMNS_H_ */
@@ -2,11 +2,14 @@
 #define MANTID_DATAOBJECTS_EVENTLIST_H_ 1
 
 #include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/EventColumns.h"
 #include "MantidDataObjects/Events.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
+#include <atomic>
 #include <iosfwd>
+#include <memory>
 #include <vector>
 
 namespace Mantid {
@@ -119,6 +122,8 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
+    if (m_columnar)
+      switchToRowStorage();
     this->events.push_back(event);
     this->order = UNSORTED;
   }
@@ -129,6 +134,8 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
+    if (m_columnar)
+      switchToRowStorage();
     this->weightedEvents.push_back(event);
     this->order = UNSORTED;
   }
@@ -139,6 +146,8 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
+    if (m_columnar)
+      switchToRowStorage();
     this->weightedEventsNoTime.push_back(event);
     this->order = UNSORTED;
   }
@@ -147,6 +156,10 @@ public:
 
   void switchTo(Mantid::API::EventType newType) override;
 
+  void switchToColumnarStorage();
+  void switchToRowStorage() const;
+  bool hasColumnarStorage() const;
+
   WeightedEvent getEvent(size_t event_number);
 
   std::vector<Types::Event::TofEvent> &getEvents();
@@ -316,6 +329,13 @@ public:
                                 bool docorrection, double toffactor,
                                 double tofshift) const;
 
+  /// Split events by full time with splitters compiled into sorted arrays
+  void splitByFullTimeSorted(const std::vector<int64_t> &boundaries,
+                             const std::vector<size_t> &targets,
+                             const std::vector<EventList *> &outputs,
+                             bool docorrection, double toffactor,
+                             double tofshift) const;
+
   /// Split events by pulse time
   void splitByPulseTime(Kernel::TimeSplitterType &splitter,
                         std::map<int, EventList *> outputs) const;
@@ -389,6 +409,15 @@ private:
   /// List of WeightedEvent's
   mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
 
+  /// The events as columns, used instead of the vectors above if m_columnar.
+  /// Only allocated while in use, to keep row-stored lists small.
+  mutable std::unique_ptr<EventColumns> m_columns;
+
+  /// True if the events are held in m_columns. May be read without holding
+  /// m_sortMutex, but m_columns must only be read while holding it, since a
+  /// const switchToRowStorage may free the columns from another thread.
+  mutable std::atomic<bool> m_columnar;
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
@@ -414,6 +443,12 @@ private:
 
   void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
 
+  bool generateHistogramDirectIndex(const MantidVec &X, MantidVec &Y,
+                                    MantidVec &E, bool skipError) const;
+
+  void generateHistogramColumnar(const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                 bool skipError) const;
+
   void generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &Y) const;
 
   void generateCountsHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
@@ -534,6 +569,13 @@ private:
       std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
       bool docorrection, double toffactor, double tofshift) const;
 
+  template <class T>
+  void splitByFullTimeSortedHelper(const std::vector<int64_t> &boundaries,
+                                   const std::vector<size_t> &targets,
+                                   const std::vector<EventList *> &outputs,
+                                   const std::vector<T> &events,
+                                   double toffactor, double tofshift) const;
+
   template <class T>
   static void multiplyHelper(std::vector<T> &events, const double value,
                              const double error = 0.0);
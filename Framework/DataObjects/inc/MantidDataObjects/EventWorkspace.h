@@ -4,8 +4,11 @@
 #include "MantidAPI/IEventWorkspace.h"
 #include "MantidAPI/ISpectrum.h"
 #include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/LazyEventBanks.h"
 #include "MantidKernel/System.h"
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <functional>
+#include <memory>
 #include <string>
 
 namespace Mantid {
@@ -143,6 +146,15 @@ public:
   void getIntegratedSpectra(std::vector<double> &out, const double minX,
                             const double maxX,
                             const bool entireRange) const override;
+
+  // Load the events of each bank when first accessed
+  void setLazyEventBanks(std::unique_ptr<LazyEventBanks> banks);
+  bool hasLazyEventBanks() const;
+  void loadLazyEventBanks() const;
+  size_t numLazyEventBanks() const;
+  const std::vector<size_t> &spectraOfLazyEventBank(const size_t bank) const;
+  LazyEventBanks::Pin pinLazyEventBank(const size_t bank) const;
+
   EventWorkspace &operator=(const EventWorkspace &other) = delete;
 
 protected:
@@ -155,6 +167,10 @@ private:
     return new EventWorkspace(storageMode());
   }
 
+  void forEachSpectrum(
+      const std::function<void(const size_t, const EventList &)> &function)
+      const;
+
   /** A vector that holds the event list for each spectrum; the key is
    * the workspace index, which is not necessarily the pixelid.
    */
@@ -162,6 +178,9 @@ private:
 
   /// Container for the MRU lists of the event lists contained.
   mutable EventWorkspaceMRU *mru;
+
+  /// Loads the events of each bank on demand, null if all events are loaded
+  mutable std::unique_ptr<LazyEventBanks> m_lazyBanks;
 };
 
 /// shared pointer to the EventWorkspace class
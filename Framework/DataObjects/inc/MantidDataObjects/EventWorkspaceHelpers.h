@@ -16,6 +16,10 @@ struct DLLExport EventWorkspaceHelpers {
   /// Converts an EventWorkspace to an equivalent Workspace2D.
   static API::MatrixWorkspace_sptr
   convertEventTo2D(API::MatrixWorkspace_sptr inputMatrixW);
+  /// Appends the events of several spectra to an event list in parallel.
+  static void appendEventLists(const EventWorkspace &inputWS,
+                               const std::vector<size_t> &indices,
+                               EventList &output);
 };
 
 } // namespace DataObjects
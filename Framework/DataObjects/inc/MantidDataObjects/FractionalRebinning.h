@@ -50,6 +50,53 @@ Code Documentation is available at: <http://doxygen.mantidproject.org>
 
 namespace FractionalRebinning {
 
+class PartialOutput;
+
+/// Add the partial outputs to the output workspace
+MANTID_DATAOBJECTS_DLL void
+addPartialOutputs(const std::vector<PartialOutput> &partialOutputs,
+                  API::MatrixWorkspace &outputWS);
+
+/**
+ * The signal, variance and fractional area of the output grid accumulated
+ * from a part of the input. Separate parts can be rebinned in parallel
+ * without locking, each into its own PartialOutput, and are then added to
+ * the output workspace by addPartialOutputs.
+ */
+class MANTID_DATAOBJECTS_DLL PartialOutput {
+public:
+  explicit PartialOutput(const API::MatrixWorkspace &outputWS);
+
+  /// The bin boundaries of the output
+  const std::vector<double> &x() const { return m_x; }
+
+  /// Add to the signal and variance of an output bin
+  void add(const size_t yi, const size_t xi, const double signal,
+           const double variance) {
+    const size_t index = yi * m_nBins + xi;
+    m_signal[index] += signal;
+    m_variance[index] += variance;
+  }
+  /// Add to the signal, variance and fractional area of an output bin
+  void add(const size_t yi, const size_t xi, const double signal,
+           const double variance, const double fraction) {
+    add(yi, xi, signal, variance);
+    m_fraction[yi * m_nBins + xi] += fraction;
+  }
+
+private:
+  const std::vector<double> &m_x;
+  size_t m_nBins;
+  std::vector<double> m_signal;
+  std::vector<double> m_variance;
+  /// Empty unless the output is a RebinnedOutput
+  std::vector<double> m_fraction;
+
+  friend void
+  addPartialOutputs(const std::vector<PartialOutput> &partialOutputs,
+                    API::MatrixWorkspace &outputWS);
+};
+
 /// Find the intersect region on the output grid
 MANTID_DATAOBJECTS_DLL bool
 getIntersectionRegion(const std::vector<double> &xAxis,
@@ -79,6 +126,26 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
     const std::vector<double> &verticalAxis,
     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/// Rebin the input quadrilateral to a partial output
+MANTID_DATAOBJECTS_DLL void
+rebinToOutput(const Geometry::Quadrilateral &inputQ,
+              const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+              const size_t j, PartialOutput &output,
+              const std::vector<double> &verticalAxis);
+
+/// Rebin the input quadrilateral to a partial output with fractional areas
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
+    const Geometry::Quadrilateral &inputQ,
+    const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+    const size_t j, PartialOutput &output,
+    const std::vector<double> &verticalAxis,
+    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
+/// Create the partial outputs for rebinning in parallel, if worthwhile
+MANTID_DATAOBJECTS_DLL std::vector<PartialOutput>
+createPartialOutputs(const API::MatrixWorkspace &inputWS,
+                     const API::MatrixWorkspace &outputWS);
+
 } // namespace FractionalRebinning
 
 } // namespace DataObjects
@@ -0,0 +1,148 @@
+#ifndef MANTID_DATAOBJECTS_LAZYEVENTBANKS_H_
+#define MANTID_DATAOBJECTS_LAZYEVENTBANKS_H_
+
+#include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/MRUList.h"
+#include "MantidKernel/System.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+class EventList;
+
+/** LazyEventBanks : Loads the events of an EventWorkspace one bank at a time,
+ * the first time a spectrum of the bank is accessed through
+ * EventWorkspace::getSpectrum, instead of loading all of them up front.
+ *
+ * Loading is done by a subclass implementing loadBank(). A bank accessed
+ * through getSpectrum stays in memory until the workspace is deleted, so
+ * references to its event lists stay valid as for any other workspace.
+ *
+ * Code that visits all spectra can instead read one bank at a time through a
+ * Pin, which keeps the bank in memory until it is destroyed. Banks that were
+ * only read through pins are freed again once no pin refers to them and more
+ * than a given number of such banks are in memory, least recently used first.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport LazyEventBanks {
+public:
+  /// Bank index of spectra that do not belong to any bank
+  static const size_t NO_BANK;
+
+  /** Keeps a bank in memory while it exists and gives access to the event
+   * lists of its spectra, which are only valid as long as the pin.
+   */
+  class DLLExport Pin {
+  public:
+    Pin() = default;
+    Pin(Pin &&other) noexcept;
+    Pin &operator=(Pin &&other) noexcept;
+    Pin(const Pin &) = delete;
+    Pin &operator=(const Pin &) = delete;
+    ~Pin();
+
+    const EventList &spectrum(const size_t index) const;
+
+  private:
+    friend class LazyEventBanks;
+    Pin(LazyEventBanks &banks, const std::vector<EventList *> &spectra,
+        const size_t bank);
+    void release();
+
+    LazyEventBanks *m_banks{nullptr};
+    const std::vector<EventList *> *m_spectra{nullptr};
+    size_t m_bank{NO_BANK};
+  };
+
+  LazyEventBanks(std::vector<size_t> bankOfSpectrum, const size_t numBanks,
+                 const size_t maxBanksInMemory = 0);
+  virtual ~LazyEventBanks() = default;
+
+  void load(const std::vector<EventList *> &spectra, const size_t index);
+  void loadAll(const std::vector<EventList *> &spectra);
+  Pin pin(const std::vector<EventList *> &spectra, const size_t bank);
+
+  /// @return the number of banks
+  size_t numBanks() const { return m_spectraOfBank.size(); }
+  /// @return the maximum number of banks only read through pins that are
+  /// kept in memory, 0 if unlimited
+  size_t maxBanksInMemory() const { return m_maxBanksInMemory; }
+  /// @return the workspace indices of the spectra in a bank
+  const std::vector<size_t> &spectraOfBank(const size_t bank) const {
+    return m_spectraOfBank[bank];
+  }
+  /// @return the workspace indices of the spectra that are in no bank
+  const std::vector<size_t> &spectraWithoutBank() const {
+    return m_spectraWithoutBank;
+  }
+  bool isLoaded(const size_t bank) const;
+  size_t numLoadedBanks() const;
+
+protected:
+  /** Load the events of a bank into its (empty) event lists.
+   * @param spectra :: the event lists of the workspace
+   * @param bank :: index of the bank to load
+   */
+  virtual void loadBank(const std::vector<EventList *> &spectra,
+                        const size_t bank) = 0;
+
+private:
+  /** Loading state of a bank. Streamed banks were only read through pins and
+   * may be evicted once no pin refers to them; resident banks never are.
+   */
+  enum class State : int { Unloaded, Streamed, Resident };
+  /// Entry in the list of the banks that may be evicted
+  using BankMarker = TypeWithMarker<size_t>;
+
+  void unpin(const std::vector<EventList *> &spectra, const size_t bank);
+  void loadLocked(const std::vector<EventList *> &spectra, const size_t bank);
+  void evict(const std::vector<EventList *> &spectra, const size_t bank);
+
+  /// Bank index of each spectrum
+  std::vector<size_t> m_bankOfSpectrum;
+  /// Workspace indices of the spectra in each bank
+  std::vector<std::vector<size_t>> m_spectraOfBank;
+  /// Workspace indices of the spectra that are in no bank
+  std::vector<size_t> m_spectraWithoutBank;
+  /// State of each bank, read without holding m_mutex
+  std::vector<std::atomic<State>> m_state;
+  /// Number of pins of each bank
+  std::vector<size_t> m_pins;
+  const size_t m_maxBanksInMemory;
+  /// Streamed banks without pins, most recently used first
+  std::unique_ptr<Kernel::MRUList<BankMarker>> m_evictable;
+  /// True once all banks were made resident by loadAll
+  std::atomic<bool> m_allResident{false};
+  /// Serializes loading, pinning and evicting banks
+  std::mutex m_mutex;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_LAZYEVENTBANKS_H_ */
@@ -168,6 +168,8 @@ public:
   /** Recalculate signal and various averages dependent on signal and the signal
    * coordinates */
   void refreshCache(Kernel::ThreadScheduler * /*ts*/ = nullptr) override;
+  void setSignal(const signal_t signal) override;
+  void setErrorSquared(const signal_t ErrorSquared) override;
   void calculateCentroid(coord_t *centroid) const override;
   void calculateCentroid(coord_t *centroid, const int runindex) const override;
   coord_t *getCentroid() const override;
@@ -218,7 +220,15 @@ protected:
   /// Flag indicating that masking has been applied.
   bool m_bIsMasked;
 
+  /** Number of leading events of the data vector already summed into the
+   * cached signal, error and centroid. Events appended after them are added
+   * to the cache incrementally by refreshCache(); 0 forces a full recount. */
+  mutable size_t m_nCachedEvents;
+
 private:
+  /// invalidate the cached signal so the next refreshCache recounts all events
+  void invalidateCache() const { m_nCachedEvents = 0; }
+
   /// private default copy constructor as the only correct constructor is the
   /// one with the boxController;
   MDBox(const MDBox &);
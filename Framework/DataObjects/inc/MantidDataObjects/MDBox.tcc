@@ -39,7 +39,7 @@ TMDE(MDBox)::~MDBox() {
 TMDE(MDBox)::MDBox(API::BoxController_sptr &splitter, const uint32_t depth,
                    const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter.get(), depth, boxID), m_Saveable(nullptr),
-      m_bIsMasked(false) {
+      m_bIsMasked(false), m_nCachedEvents(0) {
   initMDBox(nBoxEvents);
 }
 
@@ -53,7 +53,7 @@ TMDE(MDBox)::MDBox(API::BoxController_sptr &splitter, const uint32_t depth,
 TMDE(MDBox)::MDBox(API::BoxController *const splitter, const uint32_t depth,
                    const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter, depth, boxID), m_Saveable(nullptr),
-      m_bIsMasked(false) {
+      m_bIsMasked(false), m_nCachedEvents(0) {
   initMDBox(nBoxEvents);
 }
 
@@ -72,7 +72,7 @@ TMDE(MDBox)::MDBox(
         extentsVector,
     const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter.get(), depth, boxID, extentsVector),
-      m_Saveable(nullptr), m_bIsMasked(false) {
+      m_Saveable(nullptr), m_bIsMasked(false), m_nCachedEvents(0) {
   initMDBox(nBoxEvents);
 }
 //-----------------------------------------------------------------------------------------------
@@ -90,7 +90,7 @@ TMDE(MDBox)::MDBox(
         extentsVector,
     const size_t nBoxEvents, const size_t boxID)
     : MDBoxBase<MDE, nd>(splitter, depth, boxID, extentsVector),
-      m_Saveable(nullptr), m_bIsMasked(false) {
+      m_Saveable(nullptr), m_bIsMasked(false), m_nCachedEvents(0) {
   initMDBox(nBoxEvents);
 }
 /**Common part of MD box constructor */
@@ -115,7 +115,8 @@ TMDE(void MDBox)::initMDBox(const size_t nBoxEvents) {
 TMDE(MDBox)::MDBox(const MDBox<MDE, nd> &other,
                    Mantid::API::BoxController *const otherBC)
     : MDBoxBase<MDE, nd>(other, otherBC), m_Saveable(nullptr), data(other.data),
-      m_bIsMasked(other.m_bIsMasked) {
+      m_bIsMasked(other.m_bIsMasked),
+      m_nCachedEvents(other.m_nCachedEvents) {
   if (otherBC) // may be absent in some tests but generally have to be present
   {
     if (otherBC->isFileBacked())
@@ -151,6 +152,7 @@ TMDE(Kernel::ISaveable *MDBox)::getISaveable() const { return m_Saveable; }
  * Used to free up the memory in a file-backed workspace without removing the
  * events from disk. */
 TMDE(void MDBox)::clearDataFromMemory() {
+  this->invalidateCache();
   data.clear();
   vec_t().swap(data); // Linux trick to really free the memory
   // mark data unchanged
@@ -219,6 +221,8 @@ TMDE(uint64_t MDBox)::getNPoints() const {
  * data.
  */
 TMDE(std::vector<MDE> &MDBox)::getEvents() {
+  // the events may be modified, so they all have to be summed again
+  this->invalidateCache();
   if (!m_Saveable)
     return data;
   else {
@@ -292,6 +296,7 @@ TMDE(void MDBox)::getEventsData(std::vector<coord_t> &coordTable,
   MDE::eventsToData(this->data, coordTable, nColumns, signal, errorSq);
   this->m_signal = static_cast<signal_t>(signal);
   this->m_errorSquared = static_cast<signal_t>(errorSq);
+  m_nCachedEvents = this->data.size();
 
 #ifdef MDBOX_TRACK_CENTROID
   this->calculateCentroid(this->m_centroid);
@@ -304,6 +309,7 @@ TMDE(void MDBox)::getEventsData(std::vector<coord_t> &coordTable,
                            signal error and coordinates
  */
 TMDE(void MDBox)::setEventsData(const std::vector<coord_t> &coordTable) {
+  this->invalidateCache();
   MDE::dataToEvents(coordTable, this->data);
 }
 
@@ -340,7 +346,17 @@ TMDE(void MDBox)::refreshCache(Kernel::ThreadScheduler * /*ts*/) {
   double signalSum{0};
   double errorSum{0};
 
-  if (m_Saveable) {
+  // Events summed by the previous call are still in the cache as long as the
+  // box is in memory and its events were only appended to since then. A zero
+  // signal loses the centroid weights, so count everything again in that case.
+  size_t firstEvent{0};
+  const signal_t cachedSignal = this->m_signal;
+  if (!m_Saveable && m_nCachedEvents > 0 && m_nCachedEvents <= data.size() &&
+      cachedSignal != 0) {
+    firstEvent = m_nCachedEvents;
+    signalSum = cachedSignal;
+    errorSum = this->m_errorSquared;
+  } else if (m_Saveable) {
     if (m_Saveable->wasSaved()) // There are possible problems with disk
                                 // buffered events, as saving calculates
                                 // averages and these averages has to be added
@@ -358,11 +374,12 @@ TMDE(void MDBox)::refreshCache(Kernel::ThreadScheduler * /*ts*/) {
   }
 
   // calculate all averages from memory
-  signalSum = std::accumulate(data.cbegin(), data.cend(), signalSum,
+  const auto firstNew = data.cbegin() + firstEvent;
+  signalSum = std::accumulate(firstNew, data.cend(), signalSum,
                               [](const double &sum, const MDE &event) {
                                 return sum + event.getSignal();
                               });
-  errorSum = std::accumulate(data.cbegin(), data.cend(), errorSum,
+  errorSum = std::accumulate(firstNew, data.cend(), errorSum,
                              [](const double &sum, const MDE &event) {
                                return sum + event.getErrorSquared();
                              });
@@ -370,8 +387,25 @@ TMDE(void MDBox)::refreshCache(Kernel::ThreadScheduler * /*ts*/) {
   this->m_signal = signal_t(signalSum);
   this->m_errorSquared = signal_t(errorSum);
 #ifdef MDBOX_TRACK_CENTROID
-  this->calculateCentroid(this->m_centroid);
+  if (firstEvent == 0) {
+    this->calculateCentroid(this->m_centroid);
+  } else {
+    // Undo the normalisation of the cached centroid and add the new events
+    for (size_t d = 0; d < nd; ++d)
+      this->m_centroid[d] *= static_cast<coord_t>(cachedSignal);
+    for (auto it = firstNew; it != data.cend(); ++it) {
+      const auto signal = static_cast<coord_t>(it->getSignal());
+      for (size_t d = 0; d < nd; ++d)
+        this->m_centroid[d] += it->getCenter(d) * signal;
+    }
+    const coord_t reciprocal =
+        this->m_signal == 0 ? 0.0f
+                            : 1.0f / static_cast<coord_t>(this->m_signal);
+    for (size_t d = 0; d < nd; ++d)
+      this->m_centroid[d] *= reciprocal;
+  }
 #endif
+  m_nCachedEvents = m_Saveable ? 0 : data.size();
 
   /// TODO #4734: sum the individual weights of each event?
   this->m_totalWeight = static_cast<double>(this->getNPoints());
@@ -713,6 +747,18 @@ TMDE(void MDBox)::transformDimensions(std::vector<double> &scaling,
     m_Saveable->setBusy(false);
 }
 
+/// Set the cached signal; the next refreshCache() recounts all the events
+TMDE(void MDBox)::setSignal(const signal_t signal) {
+  MDBoxBase<MDE, nd>::setSignal(signal);
+  this->invalidateCache();
+}
+
+/// Set the cached error; the next refreshCache() recounts all the events
+TMDE(void MDBox)::setErrorSquared(const signal_t ErrorSquared) {
+  MDBoxBase<MDE, nd>::setErrorSquared(ErrorSquared);
+  this->invalidateCache();
+}
+
 /// Setter for masking the box
 TMDE(void MDBox)::mask() {
   this->setSignal(API::MDMaskValue);
@@ -866,6 +912,7 @@ TMDE(void MDBox)::saveAt(API::IBoxControllerIO *const FileSaver,
 
   this->m_signal = static_cast<signal_t>(totalSignal);
   this->m_errorSquared = static_cast<signal_t>(totalErrSq);
+  m_nCachedEvents = this->data.size();
 #ifdef MDBOX_TRACK_CENTROID
   this->calculateCentroid(this->m_centroid);
 #endif
@@ -929,6 +976,7 @@ TMDE(void MDBox)::clearFileBacked(bool loadDiskBackedData) {
     this->m_BoxController->getFileIO()->objectDeleted(m_Saveable);
     delete m_Saveable;
     m_Saveable = nullptr;
+    this->invalidateCache();
   }
 }
 
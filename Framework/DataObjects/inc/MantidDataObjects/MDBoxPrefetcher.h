@@ -0,0 +1,77 @@
+#ifndef MANTID_DATAOBJECTS_MDBOXPREFETCHER_H_
+#define MANTID_DATAOBJECTS_MDBOXPREFETCHER_H_
+
+#include "MantidAPI/IMDNode.h"
+#include "MantidKernel/System.h"
+
+#include <deque>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class IBoxControllerIO;
+}
+namespace DataObjects {
+
+/** MDBoxPrefetcher : Reads the events of the boxes of a file-backed
+  MDEventWorkspace ahead of their use, for algorithms which use a list of
+  boxes one after the other.
+
+  Before using each box, the algorithm calls advanceTo with the index of the
+  box. The file IO is then asked to read the events of the following boxes,
+  which are on disk but not in memory, in the background, up to a maximum
+  number of events. The data read ahead for boxes which were passed over
+  without loading their events are released again. Nothing is done if the
+  workspace is not file-backed.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport MDBoxPrefetcher {
+public:
+  MDBoxPrefetcher(const std::vector<API::IMDNode *> &boxes,
+                  const uint64_t maxEvents);
+  MDBoxPrefetcher(const MDBoxPrefetcher &) = delete;
+  MDBoxPrefetcher &operator=(const MDBoxPrefetcher &) = delete;
+  ~MDBoxPrefetcher();
+
+  void advanceTo(const size_t index);
+
+private:
+  /// The boxes in the order they are used
+  std::vector<API::IMDNode *> m_boxes;
+  /// The file IO of the workspace, null if not file-backed
+  API::IBoxControllerIO *m_fileIO;
+  /// Maximum number of events read ahead
+  const uint64_t m_maxEvents;
+  /// Index of the first box which may still be used
+  size_t m_first;
+  /// The blocks (position and size) requested for the boxes from m_first on,
+  /// with a size of 0 for the boxes which did not need reading
+  std::deque<std::pair<uint64_t, size_t>> m_requests;
+  /// Number of events requested for the boxes from m_first on
+  uint64_t m_requestedEvents;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_MDBOXPREFETCHER_H_ */
@@ -107,8 +107,9 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<Histogram1D *> data;
+  /// The 1D histograms, stored by value in one array. Only the Histogram1D
+  /// objects are contiguous: their X, Y and E arrays are allocated separately.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
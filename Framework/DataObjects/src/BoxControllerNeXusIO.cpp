@@ -8,10 +8,17 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 
 namespace Mantid {
 namespace DataObjects {
+namespace {
+/// The position of the block in progress when no block is being read ahead
+const uint64_t NO_BLOCK = std::numeric_limits<uint64_t>::max();
+} // namespace
+
 // Default headers(attributes) describing the contents of the data, written by
 // this class
 const char *EventHeaders[] = {
@@ -26,7 +33,8 @@ std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
 */
 BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
     : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc),
-      m_BlockStart(2, 0), m_BlockSize(2, 0), m_CoordSize(sizeof(coord_t)),
+      m_BlockStart(2, 0), m_BlockSize(2, 0), m_prefetchInProgress(NO_BLOCK),
+      m_stopPrefetch(false), m_CoordSize(sizeof(coord_t)),
       m_EventType(FatEvent), m_EventsVersion("1.0"),
       m_ReadConversion(noConversion) {
   m_BlockSize[1] = 4 + m_bc->getNDims();
@@ -333,7 +341,6 @@ void BoxControllerNeXusIO::saveGenericBlock(
   // Specify the dimensions
   std::vector<int64_t> dims(m_BlockSize);
 
-  std::lock_guard<std::mutex> _lock(m_fileMutex);
   start[0] = int64_t(blockPosition);
   dims[0] = int64_t(DataBlock.size() / this->getNDataColums());
 
@@ -342,11 +349,14 @@ void BoxControllerNeXusIO::saveGenericBlock(
   std::vector<Type> &mData = const_cast<std::vector<Type> &>(DataBlock);
 
   {
+    std::lock_guard<std::mutex> _lock(m_fileMutex);
     m_File->putSlab<Type>(mData, start, dims);
 
     if (blockPosition + dims[0] > this->getFileLength())
       this->setFileLength(blockPosition + dims[0]);
   }
+  // the blocks read ahead from this part of the file are out of date now
+  discardPrefetched(blockPosition, static_cast<size_t>(dims[0]));
 }
 
 /** Save float data block on specific position within properly opened NeXus data
@@ -402,6 +412,219 @@ void convertFormats(const std::vector<FROM> &inData, std::vector<TO> &outData) {
     outData.push_back(static_cast<TO>(inData[i]));
   }
 }
+/** Move a data block read ahead into the storage vector, which has the same
+ * format */
+template <typename TYPE>
+void moveFormats(std::vector<TYPE> &inData, std::vector<TYPE> &outData) {
+  outData.swap(inData);
+}
+/** Move a data block read ahead into the storage vector, converting it into
+ * the format of the storage vector */
+template <typename FROM, typename TO>
+void moveFormats(std::vector<FROM> &inData, std::vector<TO> &outData) {
+  outData.clear();
+  convertFormats(inData, outData);
+}
+
+/** Request a data block to be read in the background. The block is kept in
+ * memory until it is loaded by loadBlock or cancelled by cancelPrefetch.
+ *@param blockPosition -- The starting place of the block in the file
+ *@param nPoints       -- number of data points (events) in the block
+ */
+void BoxControllerNeXusIO::prefetchBlock(const uint64_t blockPosition,
+                                         const size_t nPoints) const {
+  if (!m_File || nPoints == 0 ||
+      blockPosition + nPoints > this->getFileLength())
+    return;
+
+  std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+  if (m_prefetchInProgress == blockPosition ||
+      m_prefetched.find(blockPosition) != m_prefetched.end())
+    return;
+  m_prefetchQueue.emplace_back(blockPosition, nPoints);
+  if (!m_prefetchThread.joinable())
+    m_prefetchThread = std::thread(&BoxControllerNeXusIO::prefetchLoop, this);
+  m_prefetchCondition.notify_all();
+}
+
+/** Forget a block requested by prefetchBlock, which is not going to be loaded.
+ *@param blockPosition -- The starting place of the block in the file
+ */
+void BoxControllerNeXusIO::cancelPrefetch(const uint64_t blockPosition) const {
+  std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+  auto queued = std::find_if(m_prefetchQueue.begin(), m_prefetchQueue.end(),
+                             [blockPosition](
+                                 const std::pair<uint64_t, size_t> &request) {
+                               return request.first == blockPosition;
+                             });
+  if (queued != m_prefetchQueue.end())
+    m_prefetchQueue.erase(queued);
+  if (m_prefetchInProgress == blockPosition)
+    m_prefetchInProgress = NO_BLOCK;
+  auto prefetched = m_prefetched.find(blockPosition);
+  if (prefetched != m_prefetched.end()) {
+    m_prefetched.erase(prefetched);
+    ++m_prefetchStatistics.discarded;
+  }
+}
+
+/**@return the numbers of blocks loaded with and without reading ahead */
+BoxControllerNeXusIO::PrefetchStatistics
+BoxControllerNeXusIO::getPrefetchStatistics() const {
+  std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+  return m_prefetchStatistics;
+}
+
+/** Body of the thread reading the requested blocks ahead, in the order they
+ * were requested, until stopPrefetching is called. */
+void BoxControllerNeXusIO::prefetchLoop() const {
+  // the data are kept in the format they have in the file
+  const bool floatFile =
+      (m_CoordSize == 4) == (m_ReadConversion == noConversion);
+  std::unique_lock<std::mutex> lock(m_prefetchMutex);
+  while (true) {
+    m_prefetchCondition.wait(
+        lock, [this] { return m_stopPrefetch || !m_prefetchQueue.empty(); });
+    if (m_stopPrefetch)
+      return;
+    const auto request = m_prefetchQueue.front();
+    m_prefetchQueue.pop_front();
+    m_prefetchInProgress = request.first;
+    lock.unlock();
+
+    PrefetchedBlock block;
+    block.nPoints = request.second;
+    bool loaded = true;
+    try {
+      if (floatFile)
+        loadGenericBlock(block.floatData, request.first, request.second);
+      else
+        loadGenericBlock(block.doubleData, request.first, request.second);
+    } catch (...) {
+      // loadBlock reads the block again and reports the error
+      loaded = false;
+    }
+
+    lock.lock();
+    if (loaded) {
+      ++m_prefetchStatistics.prefetched;
+      // the request may have been cancelled or overwritten while reading
+      if (m_prefetchInProgress == request.first)
+        m_prefetched[request.first] = std::move(block);
+      else
+        ++m_prefetchStatistics.discarded;
+    }
+    m_prefetchInProgress = NO_BLOCK;
+    m_prefetchCondition.notify_all();
+  }
+}
+
+/** Stop the thread reading ahead and forget all blocks read ahead */
+void BoxControllerNeXusIO::stopPrefetching() {
+  {
+    std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+    m_stopPrefetch = true;
+    m_prefetchCondition.notify_all();
+  }
+  if (m_prefetchThread.joinable())
+    m_prefetchThread.join();
+
+  std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+  m_stopPrefetch = false;
+  m_prefetchStatistics.discarded += m_prefetched.size();
+  m_prefetched.clear();
+  m_prefetchQueue.clear();
+}
+
+/** Forget the blocks read ahead which overlap a part of the file that has
+ * been written.
+ *@param blockPosition -- The starting place of the data written
+ *@param nPoints       -- number of data points (events) written
+ */
+void BoxControllerNeXusIO::discardPrefetched(const uint64_t blockPosition,
+                                             const size_t nPoints) const {
+  std::lock_guard<std::mutex> _lock(m_prefetchMutex);
+  if (m_prefetchThread.joinable()) {
+    for (auto it = m_prefetched.begin(); it != m_prefetched.end();) {
+      if (it->first < blockPosition + nPoints &&
+          it->first + it->second.nPoints > blockPosition) {
+        it = m_prefetched.erase(it);
+        ++m_prefetchStatistics.discarded;
+      } else {
+        ++it;
+      }
+    }
+    // the block being read may hold the data from before the write
+    m_prefetchInProgress = NO_BLOCK;
+    m_prefetchCondition.notify_all();
+  }
+}
+
+/** Remove a block from the blocks read ahead or waiting to be read ahead, as
+ * it is about to be loaded.
+ *@param blockPosition -- The starting place of the block in the file
+ *@param nPoints       -- number of data points (events) in the block
+ *@param block         -- the block read ahead, if any
+ *@returns true if the block had been read ahead
+ */
+bool BoxControllerNeXusIO::takePrefetched(const uint64_t blockPosition,
+                                          const size_t nPoints,
+                                          PrefetchedBlock &block) const {
+  std::unique_lock<std::mutex> lock(m_prefetchMutex);
+  if (!m_prefetchThread.joinable()) {
+    ++m_prefetchStatistics.misses;
+    return false;
+  }
+  auto queued = std::find_if(m_prefetchQueue.begin(), m_prefetchQueue.end(),
+                             [blockPosition](
+                                 const std::pair<uint64_t, size_t> &request) {
+                               return request.first == blockPosition;
+                             });
+  if (queued != m_prefetchQueue.end())
+    m_prefetchQueue.erase(queued);
+  // wait for the block if it is being read rather than reading it twice
+  m_prefetchCondition.wait(lock, [this, blockPosition] {
+    return m_prefetchInProgress != blockPosition;
+  });
+
+  auto prefetched = m_prefetched.find(blockPosition);
+  if (prefetched == m_prefetched.end()) {
+    ++m_prefetchStatistics.misses;
+    return false;
+  }
+  const bool sameSize = prefetched->second.nPoints == nPoints;
+  if (sameSize)
+    block = std::move(prefetched->second);
+  m_prefetched.erase(prefetched);
+  if (sameSize) {
+    ++m_prefetchStatistics.hits;
+  } else {
+    ++m_prefetchStatistics.discarded;
+    ++m_prefetchStatistics.misses;
+  }
+  return sameSize;
+}
+
+/** Load a data block from the blocks read ahead
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place of the block in the file
+  *@param nPoints       -- number of data points (events) to read
+  *@returns true if the block had been read ahead and was placed into Block
+*/
+template <typename Type>
+bool BoxControllerNeXusIO::loadPrefetchedBlock(std::vector<Type> &Block,
+                                               const uint64_t blockPosition,
+                                               const size_t nPoints) const {
+  PrefetchedBlock block;
+  if (!takePrefetched(blockPosition, nPoints, block))
+    return false;
+  if (block.doubleData.empty())
+    moveFormats(block.floatData, Block);
+  else
+    moveFormats(block.doubleData, Block);
+  return true;
+}
+
 /** Load float  data block from the opened NeXus file.
   *@param Block         -- the storage vector to place data into
   *@param blockPosition -- The starting place to read data from
@@ -413,6 +636,9 @@ void convertFormats(const std::vector<FROM> &inData, std::vector<TO> &outData) {
 void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block,
                                      const uint64_t blockPosition,
                                      const size_t nPoints) const {
+  if (loadPrefetchedBlock(Block, blockPosition, nPoints))
+    return;
+
   std::vector<double> tmp;
   switch (m_ReadConversion) {
   case (noConversion):
@@ -438,6 +664,9 @@ void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block,
 void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block,
                                      const uint64_t blockPosition,
                                      const size_t nPoints) const {
+  if (loadPrefetchedBlock(Block, blockPosition, nPoints))
+    return;
+
   std::vector<float> tmp;
   switch (m_ReadConversion) {
   case (noConversion):
@@ -463,6 +692,7 @@ void BoxControllerNeXusIO::flushData() const {
 }
 /** flush disk buffer data from memory and close underlying NeXus file*/
 void BoxControllerNeXusIO::closeFile() {
+  stopPrefetching();
   if (m_File) {
     // write all file-backed data still stack in the data buffer into the file.
     this->flushCache();
@@ -278,6 +278,62 @@ void CoordTransformAffine::apply(const coord_t *inputVector,
   }
 }
 
+namespace {
+/** Affine transformation of a block of points stored by dimension.
+ * The common 3D and 4D inputs use a fixed fixedInD, so that the sum over the
+ * input dimensions is unrolled and the loop over the points is vectorised;
+ * fixedInD = 0 takes the number of input dimensions from inD.
+ * The terms are summed in the same order as in CoordTransformAffine::apply().
+ */
+template <size_t fixedInD>
+void applyAffineToColumns(const coord_t *const *rawMatrix, size_t inD,
+                          const size_t outD, const coord_t *inputColumns,
+                          coord_t *outColumns, const size_t numPoints,
+                          const size_t stride) {
+  if (fixedInD > 0)
+    inD = fixedInD;
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *rawMatrixRow = rawMatrix[out];
+    coord_t *outColumn = outColumns + out * stride;
+    for (size_t i = 0; i < numPoints; ++i) {
+      coord_t outVal = 0.0;
+      for (size_t in = 0; in < inD; ++in)
+        outVal += rawMatrixRow[in] * inputColumns[in * stride + i];
+      outColumn[i] = outVal + rawMatrixRow[inD];
+    }
+  }
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Apply the transformation to a block of points stored by dimension:
+ * coordinate d of point i is at inputColumns[d * stride + i].
+ * Gives the same values as apply(in,out) on each point.
+ *
+ * @param inputColumns :: inD columns of input coordinates
+ * @param outColumns :: outD columns, set to the transformed coordinates
+ * @param numPoints :: number of points to transform
+ * @param stride :: distance between the starts of two columns, >= numPoints
+ */
+void CoordTransformAffine::applyToColumns(const coord_t *inputColumns,
+                                          coord_t *outColumns,
+                                          const size_t numPoints,
+                                          const size_t stride) const {
+  switch (inD) {
+  case 3:
+    applyAffineToColumns<3>(m_rawMatrix, inD, outD, inputColumns, outColumns,
+                            numPoints, stride);
+    break;
+  case 4:
+    applyAffineToColumns<4>(m_rawMatrix, inD, outD, inputColumns, outColumns,
+                            numPoints, stride);
+    break;
+  default:
+    applyAffineToColumns<0>(m_rawMatrix, inD, outD, inputColumns, outColumns,
+                            numPoints, stride);
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Serialize the coordinate transform
  *
@@ -133,6 +133,30 @@ void CoordTransformAligned::apply(const coord_t *inputVector,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the transformation to a block of points stored by dimension:
+ * coordinate d of point i is at inputColumns[d * stride + i].
+ * Gives the same values as apply(in,out) on each point.
+ *
+ * @param inputColumns :: inD columns of input coordinates
+ * @param outColumns :: outD columns, set to the transformed coordinates
+ * @param numPoints :: number of points to transform
+ * @param stride :: distance between the starts of two columns, >= numPoints
+ */
+void CoordTransformAligned::applyToColumns(const coord_t *inputColumns,
+                                           coord_t *outColumns,
+                                           const size_t numPoints,
+                                           const size_t stride) const {
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *inColumn = inputColumns + m_dimensionToBinFrom[out] * stride;
+    coord_t *outColumn = outColumns + out * stride;
+    const coord_t origin = m_origin[out];
+    const coord_t scaling = m_scaling[out];
+    for (size_t i = 0; i < numPoints; ++i)
+      outColumn[i] = (inColumn[i] - origin) * scaling;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Create an equivalent affine transformation matrix out of the
  * parameters of this axis-aligned transformation.
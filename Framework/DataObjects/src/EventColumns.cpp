@@ -0,0 +1,161 @@
+#include "MantidDataObjects/EventColumns.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <numeric>
+
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Reorder a column so that element i is the old element order[i]
+template <class T>
+void permute(std::vector<T> &column, const std::vector<size_t> &order) {
+  if (column.empty())
+    return;
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (const auto index : order)
+    sorted.push_back(column[index]);
+  column.swap(sorted);
+}
+} // namespace
+
+/** Replace the columns with the fields of the given events.
+ * @param events :: TofEvent's to copy
+ */
+void EventColumns::assign(const std::vector<TofEvent> &events) {
+  clear();
+  tof.reserve(events.size());
+  pulseTime.reserve(events.size());
+  for (const auto &event : events) {
+    tof.push_back(event.tof());
+    pulseTime.push_back(event.pulseTime().totalNanoseconds());
+  }
+}
+
+/** Replace the columns with the fields of the given events.
+ * @param events :: WeightedEvent's to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEvent> &events) {
+  clear();
+  tof.reserve(events.size());
+  pulseTime.reserve(events.size());
+  weight.reserve(events.size());
+  errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    tof.push_back(event.tof());
+    pulseTime.push_back(event.pulseTime().totalNanoseconds());
+    weight.push_back(event.m_weight);
+    errorSquared.push_back(event.m_errorSquared);
+  }
+}
+
+/** Replace the columns with the fields of the given events.
+ * @param events :: WeightedEventNoTime's to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEventNoTime> &events) {
+  clear();
+  tof.reserve(events.size());
+  weight.reserve(events.size());
+  errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    tof.push_back(event.tof());
+    weight.push_back(event.m_weight);
+    errorSquared.push_back(event.m_errorSquared);
+  }
+}
+
+/** Rebuild TofEvent's from the columns
+ * @param events :: replaced by the events held in the columns
+ */
+void EventColumns::copyTo(std::vector<TofEvent> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], DateAndTime(pulseTime[i]));
+}
+
+/** Rebuild WeightedEvent's from the columns
+ * @param events :: replaced by the events held in the columns
+ */
+void EventColumns::copyTo(std::vector<WeightedEvent> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], DateAndTime(pulseTime[i]), weight[i],
+                        errorSquared[i]);
+}
+
+/** Rebuild WeightedEventNoTime's from the columns
+ * @param events :: replaced by the events held in the columns
+ */
+void EventColumns::copyTo(std::vector<WeightedEventNoTime> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], weight[i], errorSquared[i]);
+}
+
+/// Remove all events and release the memory
+void EventColumns::clear() {
+  std::vector<double>().swap(tof);
+  std::vector<int64_t>().swap(pulseTime);
+  std::vector<float>().swap(weight);
+  std::vector<float>().swap(errorSquared);
+}
+
+/// @return the capacity of the columns in bytes
+size_t EventColumns::getMemorySize() const {
+  return tof.capacity() * sizeof(double) +
+         pulseTime.capacity() * sizeof(int64_t) +
+         (weight.capacity() + errorSquared.capacity()) * sizeof(float);
+}
+
+/// Sort all columns by increasing time-of-flight
+void EventColumns::sortByTof() {
+  std::vector<size_t> order(size());
+  std::iota(order.begin(), order.end(), 0);
+  const auto &tofs = tof;
+  tbb::parallel_sort(order.begin(), order.end(),
+                     [&tofs](const size_t lhs, const size_t rhs) {
+                       return tofs[lhs] < tofs[rhs];
+                     });
+  permute(tof, order);
+  permute(pulseTime, order);
+  permute(weight, order);
+  permute(errorSquared, order);
+}
+
+/// Reverse the order of the events in all columns
+void EventColumns::reverse() {
+  std::reverse(tof.begin(), tof.end());
+  std::reverse(pulseTime.begin(), pulseTime.end());
+  std::reverse(weight.begin(), weight.end());
+  std::reverse(errorSquared.begin(), errorSquared.end());
+}
+
+/** Convert the time-of-flight by tof' = tof * factor + offset
+ * @param factor :: the value to scale the time-of-flight by
+ * @param offset :: the value to shift the time-of-flight by
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  double *tofs = tof.data();
+  const size_t n = tof.size();
+  for (size_t i = 0; i < n; ++i)
+    tofs[i] = tofs[i] * factor + offset;
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -7,6 +7,7 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/make_unique.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
@@ -17,6 +18,7 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -85,6 +87,187 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/// Relative tolerance when checking whether bin edges have a constant step
+constexpr double BIN_STEP_TOLERANCE = 1e-6;
+
+/**
+ * Computes the bin index of a TOF arithmetically for bin edges that have
+ * either a constant width (as made by LinearGenerator) or a constant
+ * logarithmic step (as made by LogarithmicGenerator). The arithmetic guess is
+ * corrected against the actual edges so the result is identical to searching
+ * the edges, i.e. bins are [X[i], X[i+1]). Other bin edges fall back to a
+ * binary search.
+ */
+class DirectBinIndexer {
+public:
+  explicit DirectBinIndexer(const MantidVec &X)
+      : m_X(X), m_nBins(X.size() > 1 ? X.size() - 1 : 0) {
+    if (m_nBins == 0 || !(X.front() < X.back()))
+      return;
+    if (isConstantStep([](double lo, double hi) { return hi - lo; })) {
+      m_type = Linear;
+      m_inverseStep = static_cast<double>(m_nBins) / (X.back() - X.front());
+    } else if (X.front() > 0. &&
+               isConstantStep(
+                   [](double lo, double hi) { return std::log(hi / lo); })) {
+      m_type = Logarithmic;
+      m_inverseStep =
+          static_cast<double>(m_nBins) / std::log(X.back() / X.front());
+    }
+  }
+
+  /// @return true if the bin edges are linear or logarithmic
+  bool isDirect() const { return m_type != Other; }
+
+  /**
+   * @param tof :: the TOF to find the bin for
+   * @param bin :: set to the index of the bin holding tof
+   * @return false if the tof lies outside the bin edges
+   */
+  bool binIndex(const double tof, size_t &bin) const {
+    if (m_nBins == 0 || !(tof >= m_X.front() && tof < m_X.back()))
+      return false;
+    if (m_type == Other) {
+      bin = std::distance(m_X.begin(),
+                          std::upper_bound(m_X.begin(), m_X.end(), tof)) -
+            1;
+      return true;
+    }
+    const double guess = m_type == Linear
+                             ? (tof - m_X.front()) * m_inverseStep
+                             : std::log(tof / m_X.front()) * m_inverseStep;
+    bin = std::min(static_cast<size_t>(guess), m_nBins - 1);
+    // Correct for rounding in the guess
+    while (tof < m_X[bin])
+      --bin;
+    while (tof >= m_X[bin + 1])
+      ++bin;
+    return true;
+  }
+
+private:
+  enum BinningType { Linear, Logarithmic, Other };
+
+  /// Check that the step given by stepOf is the same for every bin
+  template <typename StepFunc> bool isConstantStep(StepFunc stepOf) const {
+    const double step =
+        stepOf(m_X.front(), m_X.back()) / static_cast<double>(m_nBins);
+    if (!std::isfinite(step))
+      return false;
+    const double tolerance = BIN_STEP_TOLERANCE * step;
+    for (size_t i = 0; i < m_nBins; ++i) {
+      if (std::abs(stepOf(m_X[i], m_X[i + 1]) - step) > tolerance)
+        return false;
+    }
+    return true;
+  }
+
+  const MantidVec &m_X;
+  const size_t m_nBins;
+  BinningType m_type{Other};
+  double m_inverseStep{0.};
+};
+
+/**
+ * Histogram events held in columns, in any order, using a DirectBinIndexer.
+ * @param columns :: the events to histogram
+ * @param indexer :: maps a TOF onto a bin index
+ * @param Y :: filled with the sum of the weights in each bin
+ * @param E :: if not null, filled with the sum of the squared errors
+ */
+void histogramColumnsHelper(const EventColumns &columns,
+                            const DirectBinIndexer &indexer, MantidVec &Y,
+                            MantidVec *E) {
+  const auto &tofs = columns.tof;
+  size_t bin(0);
+  if (columns.weight.empty()) {
+    for (const double tof : tofs) {
+      if (indexer.binIndex(tof, bin))
+        Y[bin] += 1.0;
+    }
+    return;
+  }
+  const auto &weights = columns.weight;
+  const auto &errorsSquared = columns.errorSquared;
+  for (size_t i = 0; i < tofs.size(); ++i) {
+    if (!indexer.binIndex(tofs[i], bin))
+      continue;
+    Y[bin] += weights[i];
+    if (E)
+      (*E)[bin] += errorsSquared[i];
+  }
+}
+
+/**
+ * Compress TOF sorted events held in columns by grouping events with the same
+ * TOF, as compressEventsHelper does for event structs.
+ * @param in :: the events to compress, sorted by TOF
+ * @param out :: filled with the compressed events, with no pulse times
+ * @param tolerance :: how close do two event's TOF have to be to be considered
+ * the same
+ */
+void compressColumnsHelper(const EventColumns &in, EventColumns &out,
+                           const double tolerance) {
+  out.clear();
+  const bool weighted = !in.weight.empty();
+  double lastTof = std::numeric_limits<double>::lowest();
+  double totalTof = 0;
+  int num = 0;
+  double weight = 0;
+  double errorSquared = 0;
+  const auto flush = [&]() {
+    if (num > 0) {
+      out.tof.push_back(totalTof / num);
+      out.weight.push_back(static_cast<float>(weight));
+      out.errorSquared.push_back(static_cast<float>(errorSquared));
+    }
+  };
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    const double tof = in.tof[i];
+    const double eventWeight = weighted ? in.weight[i] : 1.0;
+    const double eventErrorSquared = weighted ? in.errorSquared[i] : 1.0;
+    if ((tof - lastTof) <= tolerance) {
+      weight += eventWeight;
+      errorSquared += eventErrorSquared;
+      num++;
+      totalTof += tof;
+    } else {
+      flush();
+      num = 1;
+      totalTof = tof;
+      weight = eventWeight;
+      errorSquared = eventErrorSquared;
+      lastTof = tof;
+    }
+  }
+  flush();
+  out.tof.shrink_to_fit();
+  out.weight.shrink_to_fit();
+  out.errorSquared.shrink_to_fit();
+}
+
+/**
+ * Histogram events in any order using a DirectBinIndexer.
+ * @param events :: the events to histogram, in any order
+ * @param indexer :: maps a TOF onto a bin index
+ * @param Y :: filled with the sum of the weights in each bin
+ * @param E :: if not null, filled with the sum of the squared errors
+ */
+template <class T>
+void histogramDirectIndexHelper(const std::vector<T> &events,
+                                const DirectBinIndexer &indexer, MantidVec &Y,
+                                MantidVec *E) {
+  size_t bin(0);
+  for (const auto &event : events) {
+    if (!indexer.binIndex(event.tof(), bin))
+      continue;
+    Y[bin] += event.weight();
+    if (E)
+      (*E)[bin] += event.errorSquared();
+  }
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -148,7 +331,7 @@ struct comparePulseTimeTOFDelta {
 EventList::EventList()
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), order(UNSORTED), mru(nullptr) {}
+      m_columnar(false), eventType(TOF), order(UNSORTED), mru(nullptr) {}
 
 /** Constructor with a MRU list
  * @param mru :: pointer to the MRU of the parent EventWorkspace
@@ -157,12 +340,13 @@ EventList::EventList()
 EventList::EventList(EventWorkspaceMRU *mru, specnum_t specNo)
     : IEventList(specNo), m_histogram(HistogramData::Histogram::XMode::BinEdges,
                                       HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), order(UNSORTED), mru(mru) {}
+      m_columnar(false), eventType(TOF), order(UNSORTED), mru(mru) {}
 
 /** Constructor copying from an existing event list
  * @param rhs :: EventList object to copy*/
 EventList::EventList(const EventList &rhs)
-    : IEventList(rhs), m_histogram(rhs.m_histogram), mru{nullptr} {
+    : IEventList(rhs), m_histogram(rhs.m_histogram), m_columnar(false),
+      mru{nullptr} {
   // Note that operator= also assigns m_histogram, but the above use of the copy
   // constructor avoid a memory allocation and is thus faster.
   this->operator=(rhs);
@@ -173,7 +357,7 @@ EventList::EventList(const EventList &rhs)
 EventList::EventList(const std::vector<TofEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), mru(nullptr) {
+      m_columnar(false), eventType(TOF), mru(nullptr) {
   this->events.assign(events.begin(), events.end());
   this->eventType = TOF;
   this->order = UNSORTED;
@@ -184,7 +368,7 @@ EventList::EventList(const std::vector<TofEvent> &events)
 EventList::EventList(const std::vector<WeightedEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      mru(nullptr) {
+      m_columnar(false), mru(nullptr) {
   this->weightedEvents.assign(events.begin(), events.end());
   this->eventType = WEIGHTED;
   this->order = UNSORTED;
@@ -195,7 +379,7 @@ EventList::EventList(const std::vector<WeightedEvent> &events)
 EventList::EventList(const std::vector<WeightedEventNoTime> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      mru(nullptr) {
+      m_columnar(false), mru(nullptr) {
   this->weightedEventsNoTime.assign(events.begin(), events.end());
   this->eventType = WEIGHTED_NOTIME;
   this->order = UNSORTED;
@@ -220,10 +404,15 @@ void EventList::copyDataFrom(const ISpectrum &source) {
 
 /// Used by copyDataFrom for dynamic dispatch for its `source`.
 void EventList::copyDataInto(EventList &sink) const {
+  // Hold the sort lock so no other thread switches to rows meanwhile
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
   sink.m_histogram = m_histogram;
   sink.events = events;
   sink.weightedEvents = weightedEvents;
   sink.weightedEventsNoTime = weightedEventsNoTime;
+  sink.m_columns =
+      m_columns ? Kernel::make_unique<EventColumns>(*m_columns) : nullptr;
+  sink.m_columnar = m_columnar.load();
   sink.eventType = eventType;
   sink.order = order;
 }
@@ -248,6 +437,7 @@ void EventList::copyDataInto(Histogram1D &sink) const {
 void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
                                     bool GenerateMultipleEvents,
                                     int MaxEventsPerBin) {
+  this->switchToRowStorage();
   // Fresh start
   this->clear(true);
 
@@ -330,10 +520,18 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
 EventList &EventList::operator=(const EventList &rhs) {
   // Note that we are NOT copying the MRU pointer.
   IEventList::operator=(rhs);
+  // Hold the sort lock of rhs so no other thread switches it to rows
+  // meanwhile
+  std::unique_lock<std::mutex> rhsLock(rhs.m_sortMutex, std::defer_lock);
+  if (&rhs != this)
+    rhsLock.lock();
   m_histogram = rhs.m_histogram;
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  m_columns = rhs.m_columns ? Kernel::make_unique<EventColumns>(*rhs.m_columns)
+                            : nullptr;
+  m_columnar = rhs.m_columnar.load();
   eventType = rhs.eventType;
   order = rhs.order;
   return *this;
@@ -345,6 +543,7 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const TofEvent &event) {
+  this->switchToRowStorage();
 
   switch (this->eventType) {
   case TOF:
@@ -373,6 +572,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  this->switchToRowStorage();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -413,6 +613,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->switchToRowStorage();
   this->switchTo(WEIGHTED);
   this->weightedEvents.push_back(event);
   this->order = UNSORTED;
@@ -429,6 +630,7 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->switchToRowStorage();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -466,6 +668,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->switchToRowStorage();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -494,6 +697,8 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  this->switchToRowStorage();
+  more_events.switchToRowStorage();
   // We'll let the += operator for the given vector of event lists handle it
   switch (more_events.getEventType()) {
   case TOF:
@@ -555,6 +760,8 @@ void EventList::minusHelper(std::vector<T1> &events,
  * @return reference to this
  * */
 EventList &EventList::operator-=(const EventList &more_events) {
+  this->switchToRowStorage();
+  more_events.switchToRowStorage();
   if (this == &more_events) {
     // Special case, ticket #3844 part 2.
     // When doing this = this - this,
@@ -612,6 +819,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
  * @return :: true if equal.
  */
 bool EventList::operator==(const EventList &rhs) const {
+  this->switchToRowStorage();
+  rhs.switchToRowStorage();
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
   if (this->eventType != rhs.eventType)
@@ -636,6 +845,8 @@ bool EventList::operator!=(const EventList &rhs) const {
 
 bool EventList::equals(const EventList &rhs, const double tolTof,
                        const double tolWeight, const int64_t tolPulse) const {
+  this->switchToRowStorage();
+  rhs.switchToRowStorage();
   // generic checks
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
@@ -684,6 +895,7 @@ EventType EventList::getEventType() const { return eventType; }
  * WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
+  this->switchToRowStorage();
   switch (newType) {
   case TOF:
     if (eventType != TOF)
@@ -705,6 +917,67 @@ void EventList::switchTo(EventType newType) {
   this->clearUnused();
 }
 
+// -----------------------------------------------------------------------------------------------
+/** Store the events as columns of TOF, pulse time, weight and error
+ * (EventColumns) instead of a vector of event structs. Operations that only
+ * need the TOF (convertTof, convertUnitsViaTof, scaleTof, addTof,
+ * generateHistogram, compressEvents, ...) then work directly on the TOF
+ * column. Any other
+ * operation switches the list back to row storage first, so this is purely an
+ * optimization.
+ */
+void EventList::switchToColumnarStorage() {
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (m_columnar)
+    return;
+  m_columns = Kernel::make_unique<EventColumns>();
+  switch (eventType) {
+  case TOF:
+    m_columns->assign(events);
+    std::vector<TofEvent>().swap(events);
+    break;
+  case WEIGHTED:
+    m_columns->assign(weightedEvents);
+    std::vector<WeightedEvent>().swap(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns->assign(weightedEventsNoTime);
+    std::vector<WeightedEventNoTime>().swap(weightedEventsNoTime);
+    break;
+  }
+  m_columnar = true;
+}
+
+// -----------------------------------------------------------------------------------------------
+/** Store the events as a vector of event structs again, if they were switched
+ * to columns. This is const since, like sorting, it does not change the
+ * events themselves.
+ */
+void EventList::switchToRowStorage() const {
+  if (!m_columnar)
+    return;
+  // Avoid converting from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (!m_columnar)
+    return;
+  switch (eventType) {
+  case TOF:
+    m_columns->copyTo(events);
+    break;
+  case WEIGHTED:
+    m_columns->copyTo(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns->copyTo(weightedEventsNoTime);
+    break;
+  }
+  m_columnar = false;
+  m_columns.reset();
+}
+
+/// @return true if the events are stored as columns
+bool EventList::hasColumnarStorage() const { return m_columnar; }
+
 // -----------------------------------------------------------------------------------------------
 /** Switch the EventList to use WeightedEvents instead
  * of TofEvent.
@@ -776,6 +1049,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  this->switchToRowStorage();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events[event_number]);
@@ -802,6 +1076,7 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  this->switchToRowStorage();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -817,6 +1092,7 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  this->switchToRowStorage();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -832,6 +1108,7 @@ std::vector<TofEvent> &EventList::getEvents() {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  this->switchToRowStorage();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -847,6 +1124,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  this->switchToRowStorage();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -860,6 +1138,7 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  this->switchToRowStorage();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
@@ -874,6 +1153,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * */
 const std::vector<WeightedEventNoTime> &
 EventList::getWeightedEventsNoTime() const {
+  this->switchToRowStorage();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
@@ -895,6 +1175,8 @@ void EventList::clear(const bool removeDetIDs) {
   this->weightedEventsNoTime.clear();
   std::vector<WeightedEventNoTime>().swap(
       this->weightedEventsNoTime); // STL Trick to release memory
+  this->m_columns.reset();
+  this->m_columnar = false;
   if (removeDetIDs)
     this->clearDetectorIDs();
 }
@@ -904,6 +1186,9 @@ void EventList::clear(const bool removeDetIDs) {
  * Memory is freed.
  * */
 void EventList::clearUnused() {
+  // Nothing to do for columns, the vectors are all empty
+  if (m_columnar)
+    return;
   if (eventType != TOF) {
     this->events.clear();
     std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
@@ -938,7 +1223,10 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  *
  * @param num :: number of events that will be in this EventList
  */
-void EventList::reserve(size_t num) { this->events.reserve(num); }
+void EventList::reserve(size_t num) {
+  this->switchToRowStorage();
+  this->events.reserve(num);
+}
 
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
@@ -990,6 +1278,12 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return;
 
+  if (m_columnar) {
+    m_columns->sortByTof();
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     tbb::parallel_sort(events.begin(), events.end());
@@ -1018,6 +1312,7 @@ void EventList::sortTof() const {
 void EventList::sortTimeAtSample(const double &tofFactor,
                                  const double &tofShift,
                                  bool forceResort) const {
+  this->switchToRowStorage();
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1052,6 +1347,7 @@ void EventList::sortTimeAtSample(const double &tofFactor,
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  this->switchToRowStorage();
   if (this->order == PULSETIME_SORT)
     return; // nothing to do
 
@@ -1083,6 +1379,7 @@ void EventList::sortPulseTime() const {
  * (the absolute time)
  */
 void EventList::sortPulseTimeTOF() const {
+  this->switchToRowStorage();
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered.
 
@@ -1118,6 +1415,7 @@ void EventList::sortPulseTimeTOF() const {
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                                       const double seconds) const {
+  this->switchToRowStorage();
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1160,7 +1458,9 @@ void EventList::reverse() {
   std::reverse(x.begin(), x.end());
 
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  if (this->isSortedByTof() && m_columnar) {
+    m_columns->reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events.begin(), this->events.end());
@@ -1187,6 +1487,12 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar)
+      return m_columns->size();
+  }
   switch (eventType) {
   case TOF:
     return this->events.size();
@@ -1202,6 +1508,12 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar)
+      return m_columns->empty();
+  }
   switch (eventType) {
   case TOF:
     return this->events.empty();
@@ -1221,6 +1533,12 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar)
+      return m_columns->getMemorySize() + sizeof(EventList);
+  }
   switch (eventType) {
   case TOF:
     return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1703,6 +2021,24 @@ inline void EventList::compressFatEventsHelper(
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  if (m_columnar) {
+    // Compress column-wise, the output is held in columns too
+    this->sortTof();
+    auto out = Kernel::make_unique<EventColumns>();
+    compressColumnsHelper(*m_columns, *out, tolerance);
+    destination->clearData();
+    destination->m_columns = std::move(out);
+    destination->m_columnar = true;
+    destination->eventType = WEIGHTED_NOTIME;
+    destination->order = TOF_SORT;
+    return;
+  }
+  if (destination != this && destination->m_columnar) {
+    // The destination's events are replaced, no need to convert them
+    destination->m_columns.reset();
+    destination->m_columnar = false;
+  }
+
   if (!this->empty()) {
     this->sortTof();
     switch (eventType) {
@@ -1759,6 +2095,8 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
 void EventList::compressFatEvents(
     const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
     const double seconds, EventList *destination) {
+  this->switchToRowStorage();
+  destination->switchToRowStorage();
 
   // only worry about non-empty EventLists
   if (!this->empty()) {
@@ -1993,6 +2331,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                                            MantidVec &E, bool skipError) const {
+  this->switchToRowStorage();
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2030,6 +2369,7 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
                                               const double &tofFactor,
                                               const double &tofOffset,
                                               bool skipError) const {
+  this->switchToRowStorage();
   // All types of weights need to be sorted by time at sample
   this->sortTimeAtSample(tofFactor, tofOffset);
 
@@ -2063,8 +2403,22 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
+  // Unsorted events can be binned directly if the bins are linear or
+  // logarithmic, which avoids sorting them. Events held in columns are always
+  // binned directly.
+  if (this->order != TOF_SORT || m_columnar) {
+    // Hold the sort lock so no other thread reorders the events meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar) {
+      generateHistogramColumnar(X, Y, E, skipError);
+      return;
+    }
+    if (this->order != TOF_SORT &&
+        generateHistogramDirectIndex(X, Y, E, skipError))
+      return;
+  }
 
+  // Otherwise all types of weights need to be sorted by TOF
   this->sortTof();
 
   switch (eventType) {
@@ -2085,6 +2439,87 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
   }
 }
 
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms w.r.t TOF without sorting the
+ * events, by computing the bin index of each event from its TOF. This is only
+ * possible if X has a constant bin width or a constant logarithmic step. The
+ * sort order of the list is left unchanged.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events; you can just ignore the returned E vector.
+ * @return false, without touching Y and E, if X is not linear or logarithmic
+ */
+bool EventList::generateHistogramDirectIndex(const MantidVec &X, MantidVec &Y,
+                                             MantidVec &E,
+                                             bool skipError) const {
+  const DirectBinIndexer indexer(X);
+  if (!indexer.isDirect())
+    return false;
+
+  Y.assign(X.size() - 1, 0.0);
+  switch (eventType) {
+  case TOF:
+    histogramDirectIndexHelper(this->events, indexer, Y, nullptr);
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+    break;
+
+  case WEIGHTED:
+    E.assign(X.size() - 1, 0.0);
+    histogramDirectIndexHelper(this->weightedEvents, indexer, Y, &E);
+    break;
+
+  case WEIGHTED_NOTIME:
+    E.assign(X.size() - 1, 0.0);
+    histogramDirectIndexHelper(this->weightedEventsNoTime, indexer, Y, &E);
+    break;
+  }
+  if (eventType != TOF) {
+    // Errors were summed in quadrature
+    std::transform(E.begin(), E.end(), E.begin(),
+                   static_cast<double (*)(double)>(sqrt));
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms w.r.t TOF for events held in
+ * columns. The events are not sorted; linear or logarithmic bins are indexed
+ * directly and other bins by a binary search.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events; you can just ignore the returned E vector.
+ */
+void EventList::generateHistogramColumnar(const MantidVec &X, MantidVec &Y,
+                                          MantidVec &E, bool skipError) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+
+  const DirectBinIndexer indexer(X);
+  Y.assign(X.size() - 1, 0.0);
+  if (eventType == TOF) {
+    histogramColumnsHelper(*m_columns, indexer, Y, nullptr);
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+    return;
+  }
+
+  E.assign(X.size() - 1, 0.0);
+  histogramColumnsHelper(*m_columns, indexer, Y, &E);
+  // Errors were summed in quadrature
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
 // --------------------------------------------------------------------------
 /** With respect to PulseTime Fill a histogram given specified histogram bounds.
  * Does not modify
@@ -2094,6 +2529,7 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateCountsHistogramPulseTime(const MantidVec &X,
                                                  MantidVec &Y) const {
+  this->switchToRowStorage();
   // For slight speed=up.
   size_t x_size = X.size();
 
@@ -2173,6 +2609,7 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
                                                  MantidVec &Y,
                                                  const double TOF_min,
                                                  const double TOF_max) const {
+  this->switchToRowStorage();
 
   if (this->events.empty())
     return;
@@ -2408,6 +2845,7 @@ void EventList::integrateHelper(std::vector<T> &events, const double minX,
  */
 double EventList::integrate(const double minX, const double maxX,
                             const bool entireRange) const {
+  this->switchToRowStorage();
   double sum(0), error(0);
   integrate(minX, maxX, entireRange, sum, error);
   return sum;
@@ -2426,6 +2864,7 @@ double EventList::integrate(const double minX, const double maxX,
 void EventList::integrate(const double minX, const double maxX,
                           const bool entireRange, double &sum,
                           double &error) const {
+  this->switchToRowStorage();
   sum = 0;
   error = 0;
   if (!entireRange) {
@@ -2463,6 +2902,7 @@ void EventList::integrate(const double minX, const double maxX,
  */
 void EventList::convertTof(std::function<double(double)> func,
                            const int sorting) {
+  this->switchToRowStorage();
   // fix the histogram parameter
   MantidVec &x = dataX();
   transform(x.begin(), x.end(), x.begin(), func);
@@ -2521,6 +2961,11 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columnar) {
+    m_columns->convertTof(factor, offset);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2590,6 +3035,7 @@ void EventList::addPulsetimeHelper(std::vector<T> &events,
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->switchToRowStorage();
   if (this->getNumberEvents() <= 0)
     return;
 
@@ -2657,6 +3103,7 @@ std::size_t EventList::maskTofHelper(std::vector<T> &events,
  * @param tofMax :: upper bound of TOF to filter out
  */
 void EventList::maskTof(const double tofMin, const double tofMax) {
+  this->switchToRowStorage();
   if (tofMax <= tofMin)
     throw std::runtime_error("EventList::maskTof: tofMax must be > tofMin");
 
@@ -2707,6 +3154,15 @@ void EventList::getTofsHelper(const std::vector<T> &events,
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar) {
+      tofs = m_columns->tof;
+      return;
+    }
+  }
+
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
@@ -2753,6 +3209,7 @@ void EventList::getWeightsHelper(const std::vector<T> &events,
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  this->switchToRowStorage();
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -2800,6 +3257,7 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events,
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  this->switchToRowStorage();
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -2849,6 +3307,7 @@ void EventList::getPulseTimesHelper(
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
+  this->switchToRowStorage();
   std::vector<Mantid::Types::Core::DateAndTime> times;
   // Set the capacity of the vector to avoid multiple resizes
   times.reserve(this->getNumberEvents());
@@ -2880,6 +3339,19 @@ double EventList::getTofMin() const {
   if (this->empty())
     return tMin;
 
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar) {
+      const auto &tofs = m_columns->tof;
+      if (tofs.empty())
+        return tMin;
+      return this->order == TOF_SORT
+                 ? tofs.front()
+                 : *std::min_element(tofs.begin(), tofs.end());
+    }
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -2926,6 +3398,19 @@ double EventList::getTofMax() const {
   if (this->empty())
     return tMax;
 
+  if (m_columnar) {
+    // Hold the sort lock so no other thread switches to rows meanwhile
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    if (m_columnar) {
+      const auto &tofs = m_columns->tof;
+      if (tofs.empty())
+        return tMax;
+      return this->order == TOF_SORT
+                 ? tofs.back()
+                 : *std::max_element(tofs.begin(), tofs.end());
+    }
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -2964,6 +3449,7 @@ double EventList::getTofMax() const {
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  this->switchToRowStorage();
   // set up as the maximum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3008,6 +3494,7 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  this->switchToRowStorage();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3051,6 +3538,7 @@ DateAndTime EventList::getPulseTimeMax() const {
 void EventList::getPulseTimeMinMax(
     Mantid::Types::Core::DateAndTime &tMin,
     Mantid::Types::Core::DateAndTime &tMax) const {
+  this->switchToRowStorage();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3101,6 +3589,7 @@ void EventList::getPulseTimeMinMax(
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->switchToRowStorage();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3148,6 +3637,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->switchToRowStorage();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3222,6 +3712,13 @@ void EventList::setTofsHelper(std::vector<T> &events,
 void EventList::setTofs(const MantidVec &tofs) {
   this->order = UNSORTED;
 
+  if (m_columnar) {
+    // Same rules as setTofsHelper
+    if (!tofs.empty() && tofs.size() == m_columns->size())
+      m_columns->tof = tofs;
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -3322,6 +3819,7 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  this->switchToRowStorage();
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
@@ -3445,6 +3943,7 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y,
                          const MantidVec &E) {
+  this->switchToRowStorage();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3582,6 +4081,7 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y,
                        const MantidVec &E) {
+  this->switchToRowStorage();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3630,6 +4130,7 @@ EventList &EventList::operator/=(const double value) {
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 void EventList::divide(const double value, const double error) {
+  this->switchToRowStorage();
   if (value == 0.0)
     throw std::invalid_argument(
         "EventList::divide() called with value of 0.0. Cannot divide by zero.");
@@ -3715,6 +4216,7 @@ void EventList::filterByTimeAtSampleHelper(std::vector<T> &events,
  */
 void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
                                   EventList &output) const {
+  this->switchToRowStorage();
   if (this == &output) {
     throw std::invalid_argument("In-place filtering is not allowed");
   }
@@ -3749,6 +4251,7 @@ void EventList::filterByTimeAtSample(Types::Core::DateAndTime start,
                                      Types::Core::DateAndTime stop,
                                      double tofFactor, double tofOffset,
                                      EventList &output) const {
+  this->switchToRowStorage();
   if (this == &output) {
     throw std::invalid_argument("In-place filtering is not allowed");
   }
@@ -3864,6 +4367,7 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
  *     that will be kept. Any other events will be deleted.
  */
 void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
+  this->switchToRowStorage();
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
 
@@ -3955,6 +4459,7 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
                             std::vector<EventList *> outputs) const {
+  this->switchToRowStorage();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4095,6 +4600,7 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
                                 std::map<int, EventList *> outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const {
+  this->switchToRowStorage();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4326,6 +4832,7 @@ std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int> &vecgroups,
     std::map<int, EventList *> vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
+  this->switchToRowStorage();
   // Check validity
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4391,6 +4898,163 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   return debugmessage;
 }
 
+//------------------------------------------------------------------------------------------------
+/** Split the events, sorted by pulse time, into the outputs. The interval of
+ * an event is only searched for when it leaves the interval of the previous
+ * event, and the events are copied as contiguous runs into outputs that are
+ * reserved to their final size first, so no allocation is done per event.
+ *
+ * @param boundaries :: sorted boundaries of the splitters in nanoseconds
+ * @param targets :: index of the output of each splitter
+ * @param outputs :: where the split events end up
+ * @param events :: either this->events or this->weightedEvents.
+ * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
+ * @param tofshift :: amount to shift (in SECOND) to correct TOF
+ */
+template <class T>
+void EventList::splitByFullTimeSortedHelper(
+    const std::vector<int64_t> &boundaries, const std::vector<size_t> &targets,
+    const std::vector<EventList *> &outputs, const std::vector<T> &events,
+    double toffactor, double tofshift) const {
+  const size_t numSplitters = targets.size();
+  const size_t noSplitter = numSplitters;
+
+  // 1. Find the runs of consecutive events within the same splitter. The full
+  // times are only roughly sorted, so an event may go back to an earlier one.
+  std::vector<std::pair<size_t, size_t>> runs; // (end of run, splitter)
+  size_t splitter = noSplitter;
+  int64_t lower = std::numeric_limits<int64_t>::max();
+  int64_t upper = std::numeric_limits<int64_t>::min();
+  for (size_t i = 0; i < events.size(); ++i) {
+    const int64_t fulltime =
+        calculateCorrectedFullTime(events[i], toffactor, tofshift);
+    if (fulltime >= lower && fulltime < upper)
+      continue;
+    const auto next =
+        std::upper_bound(boundaries.cbegin(), boundaries.cend(), fulltime);
+    size_t current = noSplitter;
+    if (next == boundaries.cbegin()) {
+      lower = std::numeric_limits<int64_t>::min();
+      upper = boundaries.front();
+    } else if (next == boundaries.cend()) {
+      lower = boundaries.back();
+      upper = std::numeric_limits<int64_t>::max();
+    } else {
+      current = static_cast<size_t>(next - boundaries.cbegin()) - 1;
+      lower = *(next - 1);
+      upper = *next;
+    }
+    if (current != splitter) {
+      if (i > 0)
+        runs.emplace_back(i, splitter);
+      splitter = current;
+    }
+  }
+  runs.emplace_back(events.size(), splitter);
+
+  // 2. Reserve the outputs
+  const auto outputOfRun = [&](const std::pair<size_t, size_t> &run) {
+    if (run.second == noSplitter || targets[run.second] >= outputs.size())
+      return static_cast<EventList *>(nullptr);
+    return outputs[targets[run.second]];
+  };
+  std::vector<size_t> numEvents(outputs.size(), 0);
+  size_t begin = 0;
+  for (const auto &run : runs) {
+    if (outputOfRun(run))
+      numEvents[targets[run.second]] += run.first - begin;
+    begin = run.first;
+  }
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    if (numEvents[i] == 0)
+      continue;
+    std::vector<T> *outputEvents;
+    getEventsFrom(*outputs[i], outputEvents);
+    outputEvents->reserve(numEvents[i]);
+  }
+
+  // 3. Copy the runs
+  begin = 0;
+  for (const auto &run : runs) {
+    if (EventList *output = outputOfRun(run)) {
+      std::vector<T> *outputEvents;
+      getEventsFrom(*output, outputEvents);
+      outputEvents->insert(outputEvents->end(), events.begin() + begin,
+                           events.begin() + run.first);
+      output->order = UNSORTED;
+    }
+    begin = run.first;
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+/** Split the event list into n outputs by event's full time (tof + pulse
+ * time), with the splitters compiled into a sorted array of boundaries.
+ * An event with a full time in [boundaries[i], boundaries[i+1]) goes to
+ * outputs[targets[i]]. Events before the first or from the last boundary
+ * on, and events of splitters whose target is out of the range of the
+ * outputs or null, are discarded.
+ *
+ * Compared to splitByFullTimeMatrixSplitter, there is no map lookup per event
+ * and the outputs are filled without reallocation, which matters when
+ * splitting into many thousands of slices.
+ *
+ * @param boundaries :: sorted boundaries of the splitters in nanoseconds, one
+ * more than the number of targets
+ * @param targets :: index of the output of each splitter
+ * @param outputs :: where the split events will end up
+ * @param docorrection :: flag to do TOF correction from detector to sample
+ * @param toffactor :: factor multiplied to TOF for correction
+ * @param tofshift :: shift to TOF in unit of SECOND for correction
+ */
+void EventList::splitByFullTimeSorted(const std::vector<int64_t> &boundaries,
+                                      const std::vector<size_t> &targets,
+                                      const std::vector<EventList *> &outputs,
+                                      bool docorrection, double toffactor,
+                                      double tofshift) const {
+  this->switchToRowStorage();
+  if (eventType == WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::splitByFullTimeSorted() called on an "
+                             "EventList that no longer has time information.");
+  if (boundaries.size() != targets.size() + 1)
+    throw std::invalid_argument("EventList::splitByFullTimeSorted() needs one "
+                                "more boundary than targets.");
+
+  // Start by sorting the event list by pulse time
+  this->sortPulseTimeTOF();
+
+  // Initialize all the outputs
+  for (auto output : outputs) {
+    if (!output)
+      continue;
+    output->clear();
+    output->setDetectorIDs(this->getDetectorIDs());
+    output->setHistogram(m_histogram);
+    // Match the output event type.
+    output->switchTo(eventType);
+  }
+
+  if (targets.empty())
+    return;
+  if (!docorrection) {
+    toffactor = 1.0;
+    tofshift = 0.0;
+  }
+
+  switch (eventType) {
+  case TOF:
+    splitByFullTimeSortedHelper(boundaries, targets, outputs, this->events,
+                                toffactor, tofshift);
+    break;
+  case WEIGHTED:
+    splitByFullTimeSortedHelper(boundaries, targets, outputs,
+                                this->weightedEvents, toffactor, tofshift);
+    break;
+  case WEIGHTED_NOTIME:
+    break;
+  }
+}
+
 //-------------------------------------------
 //--------------------------------------------------
 /** Split the event list into n outputs by each event's pulse time only
@@ -4463,6 +5127,7 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
                                  std::map<int, EventList *> outputs) const {
+  this->switchToRowStorage();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4508,6 +5173,7 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
 void EventList::splitByPulseTimeWithMatrix(
     const std::vector<int64_t> &vec_times, const std::vector<int> &vec_target,
     std::map<int, EventList *> outputs) const {
+  this->switchToRowStorage();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4671,13 +5337,21 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
+  // Copy blocks of TOF values to a contiguous buffer so that the units can
+  // convert them all at once instead of with a virtual call per event
+  constexpr size_t blockSize = 1024;
+  double buffer[blockSize];
+  const size_t numEvents = events.size();
+  for (size_t start = 0; start < numEvents; start += blockSize) {
+    const size_t count = std::min(blockSize, numEvents - start);
+    for (size_t i = 0; i < count; ++i)
+      buffer[i] = events[start + i].m_tof;
+    // Convert to TOF
+    fromUnit->multipleToTOF(buffer, buffer, count);
     // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+    toUnit->multipleFromTOF(buffer, buffer, count);
+    for (size_t i = 0; i < count; ++i)
+      events[start + i].m_tof = buffer[i];
   }
 }
 
@@ -4702,6 +5376,14 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
     throw std::runtime_error(
         "EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  if (m_columnar) {
+    // The TOF column is already contiguous, convert it in place
+    auto &tof = m_columns->tof;
+    fromUnit->multipleToTOF(tof.data(), tof.data(), tof.size());
+    toUnit->multipleFromTOF(tof.data(), tof.data(), tof.size());
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(this->events, fromUnit, toUnit);
@@ -4739,6 +5421,7 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  this->switchToRowStorage();
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(this->events, factor, power);
@@ -8,6 +8,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/LazyEventBanks.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/CPUTimer.h"
@@ -43,13 +44,16 @@ EventWorkspace::EventWorkspace(const Parallel::StorageMode storageMode)
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
     : IEventWorkspace(other), mru(new EventWorkspaceMRU) {
-  for (const auto &el : other.data) {
+  // The copy holds all of the events, copied one bank at a time if the
+  // other workspace loads them on demand
+  data.resize(other.data.size(), nullptr);
+  other.forEachSpectrum([this](const size_t index, const EventList &el) {
     // Create a new event list, copying over the events
-    auto newel = new EventList(*el);
+    auto newel = new EventList(el);
     // Make sure to update the MRU to point to THIS event workspace.
     newel->setMRU(this->mru);
-    this->data.push_back(newel);
-  }
+    this->data[index] = newel;
+  });
 }
 
 EventWorkspace::~EventWorkspace() {
@@ -173,11 +177,16 @@ EventList &EventWorkspace::getSpectrum(const size_t index) {
   return spec;
 }
 
-/// Return const reference to EventList at the given workspace index.
+/** Return const reference to EventList at the given workspace index.
+ * If banks are loaded on demand, this loads the bank of the spectrum, which
+ * then stays in memory.
+ */
 const EventList &EventWorkspace::getSpectrum(const size_t index) const {
   if (index >= data.size())
     throw std::range_error(
         "EventWorkspace::getSpectrum, workspace index out of range");
+  if (m_lazyBanks)
+    m_lazyBanks->load(data, index);
   return *data[index];
 }
 
@@ -192,15 +201,11 @@ double EventWorkspace::getTofMax() const { return this->getEventXMax(); }
 DateAndTime EventWorkspace::getPulseTimeMin() const {
   // set to crazy values to start
   Mantid::Types::Core::DateAndTime tMin = DateAndTime::maximum();
-  size_t numWorkspace = this->data.size();
-  DateAndTime temp;
-  for (size_t workspaceIndex = 0; workspaceIndex < numWorkspace;
-       workspaceIndex++) {
-    const EventList &evList = this->getSpectrum(workspaceIndex);
-    temp = evList.getPulseTimeMin();
+  forEachSpectrum([&tMin](const size_t, const EventList &evList) {
+    const DateAndTime temp = evList.getPulseTimeMin();
     if (temp < tMin)
       tMin = temp;
-  }
+  });
   return tMin;
 }
 
@@ -211,15 +216,11 @@ DateAndTime EventWorkspace::getPulseTimeMin() const {
 DateAndTime EventWorkspace::getPulseTimeMax() const {
   // set to crazy values to start
   Mantid::Types::Core::DateAndTime tMax = DateAndTime::minimum();
-  size_t numWorkspace = this->data.size();
-  DateAndTime temp;
-  for (size_t workspaceIndex = 0; workspaceIndex < numWorkspace;
-       workspaceIndex++) {
-    const EventList &evList = this->getSpectrum(workspaceIndex);
-    temp = evList.getPulseTimeMax();
+  forEachSpectrum([&tMax](const size_t, const EventList &evList) {
+    const DateAndTime temp = evList.getPulseTimeMax();
     if (temp > tMax)
       tMax = temp;
-  }
+  });
   return tMax;
 }
 /**
@@ -234,6 +235,17 @@ void EventWorkspace::getPulseTimeMinMax(
   Tmax = DateAndTime::minimum();
   Tmin = DateAndTime::maximum();
 
+  if (m_lazyBanks) {
+    // Read one bank at a time, see forEachSpectrum
+    forEachSpectrum([&Tmin, &Tmax](const size_t, const EventList &evList) {
+      DateAndTime tempMin, tempMax;
+      evList.getPulseTimeMinMax(tempMin, tempMax);
+      Tmin = std::min(Tmin, tempMin);
+      Tmax = std::max(Tmax, tempMax);
+    });
+    return;
+  }
+
   int64_t numWorkspace = static_cast<int64_t>(this->data.size());
 #pragma omp parallel
   {
@@ -322,14 +334,11 @@ DateAndTime EventWorkspace::getTimeAtSampleMax(double tofOffset) const {
 double EventWorkspace::getEventXMin() const {
   // set to crazy values to start
   double xmin = std::numeric_limits<double>::max();
-  size_t numWorkspace = this->data.size();
-  for (size_t workspaceIndex = 0; workspaceIndex < numWorkspace;
-       workspaceIndex++) {
-    const EventList &evList = this->getSpectrum(workspaceIndex);
+  forEachSpectrum([&xmin](const size_t, const EventList &evList) {
     const double temp = evList.getTofMin();
     if (temp < xmin)
       xmin = temp;
-  }
+  });
   return xmin;
 }
 
@@ -346,14 +355,11 @@ double EventWorkspace::getEventXMin() const {
 double EventWorkspace::getEventXMax() const {
   // set to crazy values to start
   double xmax = std::numeric_limits<double>::lowest();
-  size_t numWorkspace = this->data.size();
-  for (size_t workspaceIndex = 0; workspaceIndex < numWorkspace;
-       workspaceIndex++) {
-    const EventList &evList = this->getSpectrum(workspaceIndex);
+  forEachSpectrum([&xmax](const size_t, const EventList &evList) {
     const double temp = evList.getTofMax();
     if (temp > xmax)
       xmax = temp;
-  }
+  });
   return xmax;
 }
 
@@ -367,6 +373,14 @@ void EventWorkspace::getEventXMinMax(double &xmin, double &xmax) const {
   // set to crazy values to start
   xmin = std::numeric_limits<double>::max();
   xmax = -1.0 * xmin;
+  if (m_lazyBanks) {
+    // Read one bank at a time, see forEachSpectrum
+    forEachSpectrum([&xmin, &xmax](const size_t, const EventList &evList) {
+      xmin = std::min(xmin, evList.getTofMin());
+      xmax = std::max(xmax, evList.getTofMax());
+    });
+    return;
+  }
   int64_t numWorkspace = static_cast<int64_t>(this->data.size());
 #pragma omp parallel
   {
@@ -392,10 +406,11 @@ void EventWorkspace::getEventXMinMax(double &xmin, double &xmax) const {
 /// The total number of events across all of the spectra.
 /// @returns The total number of events
 size_t EventWorkspace::getNumberEvents() const {
-  return std::accumulate(data.begin(), data.end(), size_t{0},
-                         [](size_t total, EventList *list) {
-                           return total + list->getNumberEvents();
-                         });
+  size_t total{0};
+  forEachSpectrum([&total](const size_t, const EventList &list) {
+    total += list.getNumberEvents();
+  });
+  return total;
 }
 
 /** Get the EventType of the most-specialized EventList in the workspace
@@ -543,6 +558,8 @@ void EventWorkspace::generateHistogram(const std::size_t index,
   if (index >= data.size())
     throw std::range_error(
         "EventWorkspace::generateHistogram, histogram number out of range");
+  if (m_lazyBanks)
+    m_lazyBanks->load(data, index);
   this->data[index]->generateHistogram(X, Y, E, skipError);
 }
 
@@ -563,6 +580,8 @@ void EventWorkspace::generateHistogramPulseTime(const std::size_t index,
   if (index >= data.size())
     throw std::range_error("EventWorkspace::generateHistogramPulseTime, "
                            "histogram number out of range");
+  if (m_lazyBanks)
+    m_lazyBanks->load(data, index);
   this->data[index]->generateHistogramPulseTime(X, Y, E, skipError);
 }
 
@@ -676,6 +695,13 @@ void EventWorkspace::getIntegratedSpectra(std::vector<double> &out,
                                           const bool entireRange) const {
   // Start with empty vector
   out.resize(this->getNumberHistograms(), 0.0);
+  if (m_lazyBanks) {
+    // Read one bank at a time, see forEachSpectrum
+    forEachSpectrum([&](const size_t index, const EventList &el) {
+      out[index] = el.integrate(minX, maxX, entireRange);
+    });
+    return;
+  }
 
   // We can run in parallel since there is no cross-reading of event lists
   PARALLEL_FOR_NO_WSP_CHECK()
@@ -689,6 +715,85 @@ void EventWorkspace::getIntegratedSpectra(std::vector<double> &out,
   }
 }
 
+/** Load the events of each bank only when a spectrum of the bank is first
+ * accessed through getSpectrum or pinLazyEventBank. Must be set after all
+ * spectra were created; the event lists of all spectra in a bank must be
+ * empty until it is loaded.
+ * @param banks :: the loader of the banks, which must use the spectra of this
+ * workspace
+ */
+void EventWorkspace::setLazyEventBanks(std::unique_ptr<LazyEventBanks> banks) {
+  m_lazyBanks = std::move(banks);
+}
+
+/// @return true if banks are loaded only when accessed
+bool EventWorkspace::hasLazyEventBanks() const {
+  return static_cast<bool>(m_lazyBanks);
+}
+
+/** Load the events of all banks that were not loaded yet. After that, all
+ * events stay in memory.
+ */
+void EventWorkspace::loadLazyEventBanks() const {
+  if (m_lazyBanks)
+    m_lazyBanks->loadAll(data);
+}
+
+/// @return the number of banks loaded on demand, 0 if all events are loaded
+size_t EventWorkspace::numLazyEventBanks() const {
+  return m_lazyBanks ? m_lazyBanks->numBanks() : 0;
+}
+
+/** @param bank :: index of a bank loaded on demand, or
+ * LazyEventBanks::NO_BANK for the spectra that are in no bank
+ * @return the workspace indices of the spectra in the bank
+ */
+const std::vector<size_t> &
+EventWorkspace::spectraOfLazyEventBank(const size_t bank) const {
+  if (m_lazyBanks && bank == LazyEventBanks::NO_BANK)
+    return m_lazyBanks->spectraWithoutBank();
+  if (bank >= numLazyEventBanks())
+    throw std::out_of_range(
+        "EventWorkspace::spectraOfLazyEventBank, bank index out of range");
+  return m_lazyBanks->spectraOfBank(bank);
+}
+
+/** Load a bank and keep it in memory while the returned pin exists. Unlike
+ * getSpectrum, reading the spectra of the bank through the pin lets the bank
+ * be freed again afterwards, within the limit set for the banks.
+ * @param bank :: index of a bank loaded on demand
+ * @return the pin, which gives access to the event lists of the bank
+ */
+LazyEventBanks::Pin EventWorkspace::pinLazyEventBank(const size_t bank) const {
+  if (bank >= numLazyEventBanks())
+    throw std::out_of_range(
+        "EventWorkspace::pinLazyEventBank, bank index out of range");
+  return m_lazyBanks->pin(data, bank);
+}
+
+/** Call a function with the workspace index and event list of each spectrum,
+ * in no particular order. If banks are loaded on demand, the spectra are
+ * visited one bank at a time, and banks that were not in memory are only kept
+ * while their spectra are visited.
+ * @param function :: called with each workspace index and its event list
+ */
+void EventWorkspace::forEachSpectrum(
+    const std::function<void(const size_t, const EventList &)> &function)
+    const {
+  if (!m_lazyBanks) {
+    for (size_t index = 0; index < data.size(); ++index)
+      function(index, *data[index]);
+    return;
+  }
+  for (size_t bank = 0; bank < m_lazyBanks->numBanks(); ++bank) {
+    const auto pin = m_lazyBanks->pin(data, bank);
+    for (const auto index : m_lazyBanks->spectraOfBank(bank))
+      function(index, pin.spectrum(index));
+  }
+  for (const auto index : m_lazyBanks->spectraWithoutBank())
+    function(index, *data[index]);
+}
+
 } // namespace DataObjects
 } // namespace Mantid
 
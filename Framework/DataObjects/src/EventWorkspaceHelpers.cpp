@@ -3,10 +3,23 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <exception>
 
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// Rethrow the first exception caught by the threads of a parallel loop
+void rethrowFirst(const std::vector<std::exception_ptr> &errors) {
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+} // namespace
+
 namespace Mantid {
 namespace DataObjects {
 
@@ -49,5 +62,69 @@ EventWorkspaceHelpers::convertEventTo2D(MatrixWorkspace_sptr inputMatrixW) {
   return outputW;
 }
 
+/** Appends the event lists of a number of spectra to an event list, in the
+ * order of the indices. Chunks of spectra are summed in parallel into partial
+ * lists, which are then joined pairwise in a tree, so the result is the same
+ * as appending the spectra one by one whatever the number of threads.
+ * @param inputWS :: workspace holding the spectra
+ * @param indices :: workspace indices of the spectra to append
+ * @param output :: the list the events are appended to
+ */
+void EventWorkspaceHelpers::appendEventLists(const EventWorkspace &inputWS,
+                                             const std::vector<size_t> &indices,
+                                             EventList &output) {
+  size_t numEvents(output.getNumberEvents());
+  for (const auto index : indices)
+    numEvents += inputWS.getSpectrum(index).getNumberEvents();
+  output.reserve(numEvents);
+
+  // Spectra per partial list, large enough to amortise the extra copy
+  const size_t chunkSize(200);
+  const size_t numChunks((indices.size() + chunkSize - 1) / chunkSize);
+  if (numChunks < 2 || PARALLEL_GET_MAX_THREADS < 2 ||
+      !Kernel::threadSafe(inputWS)) {
+    for (const auto index : indices)
+      output += inputWS.getSpectrum(index);
+    return;
+  }
+
+  // Exceptions must not escape the parallel loops, so each thread stores the
+  // one it catches and the first is rethrown after the loop
+  std::vector<EventList> partials(numChunks);
+  std::vector<std::exception_ptr> errors(numChunks);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t chunk = 0; chunk < static_cast<int64_t>(numChunks); ++chunk) {
+    try {
+      auto &partial = partials[chunk];
+      partial.switchTo(output.getEventType());
+      const size_t begin(chunk * chunkSize);
+      const size_t end(std::min(begin + chunkSize, indices.size()));
+      for (size_t i = begin; i < end; ++i)
+        partial += inputWS.getSpectrum(indices[i]);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  }
+  rethrowFirst(errors);
+  // Join neighbouring lists, doubling the distance between them each pass
+  for (size_t step = 1; step < numChunks; step *= 2) {
+    const int64_t numPairs((numChunks - 1) / (2 * step) + 1);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t pair = 0; pair < numPairs; ++pair) {
+      const size_t first(pair * 2 * step);
+      try {
+        if (first + step < numChunks) {
+          partials[first] += partials[first + step];
+          partials[first + step].clear();
+        }
+      } catch (...) {
+        errors[first] = std::current_exception();
+      }
+    }
+    rethrowFirst(errors);
+  }
+  output += partials.front();
+}
+
 } // namespace DataObjects
 } // namespace Mantid
@@ -503,22 +503,26 @@ void normaliseOutput(MatrixWorkspace_sptr outputWS,
   outputWS->setDistribution(inputWS->isDistribution());
 }
 
+namespace {
 /**
- * Rebin the input quadrilateral to the output grid.
- * The quadrilateral must have a CLOCKWISE winding.
+ * Rebin the input quadrilateral to the output grid, passing the contribution
+ * to every overlapping output bin to an accumulator.
  * @param inputQ The input polygon (Polygon winding must be Clockwise)
  * @param inputWS The input workspace containing the input intensity values
  * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param X The output horizontal axis bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
+ * @param accumulate Called with the output indices, signal and variance
  */
-void rebinToOutput(const Quadrilateral &inputQ,
-                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
-                   const size_t j, MatrixWorkspace &outputWS,
-                   const std::vector<double> &verticalAxis) {
-  const auto &X = outputWS.x(0).rawData();
+template <typename Accumulator>
+void rebinQuadrilateral(const Quadrilateral &inputQ,
+                        const MatrixWorkspace_const_sptr &inputWS,
+                        const size_t i, const size_t j,
+                        const std::vector<double> &X,
+                        const std::vector<double> &verticalAxis,
+                        Accumulator accumulate) {
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -556,38 +560,36 @@ void rebinToOutput(const Quadrilateral &inputQ,
           eValue *= overlapWidth;
         }
         eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
-        }
+        accumulate(y, xi, yValue, eValue);
       }
     }
   }
 }
 
 /**
- * Rebin the input quadrilateral to the output grid
- * The quadrilateral must have a CLOCKWISE winding.
+ * Rebin the input quadrilateral to the output grid keeping track of the
+ * fractional areas, passing the contribution to every overlapping output bin
+ * to an accumulator.
  * @param inputQ The input polygon (Polygon winding must be clockwise)
  * @param inputWS The input workspace containing the input intensity values
  * @param i The indexiin the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
+ * @param X The output horizontal axis bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
- * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
- * It is used to take into account the input area fractions when calcuting
- * the final output fractions.
- * This can be null to indicate that the input was a standard 2D workspace.
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace.
+ * @param accumulate Called with the output indices, signal, variance and
+ * fractional area
  */
-void rebinToFractionalOutput(const Quadrilateral &inputQ,
-                             const MatrixWorkspace_const_sptr &inputWS,
-                             const size_t i, const size_t j,
-                             RebinnedOutput &outputWS,
-                             const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
+template <typename Accumulator>
+void rebinFractionalQuadrilateral(const Quadrilateral &inputQ,
+                                  const MatrixWorkspace_const_sptr &inputWS,
+                                  const size_t i, const size_t j,
+                                  const std::vector<double> &X,
+                                  const std::vector<double> &verticalAxis,
+                                  const RebinnedOutput_const_sptr &inputRB,
+                                  Accumulator accumulate) {
   const auto &inX = inputWS->x(i);
   const auto &inY = inputWS->y(i);
   const auto &inE = inputWS->e(i);
@@ -595,7 +597,6 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   if (std::isnan(signal))
     return;
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -651,10 +652,199 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
     const size_t xi = std::get<0>(ai);
     const size_t yi = std::get<1>(ai);
     const double weight = std::get<2>(ai) / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      outputWS.mutableY(yi)[xi] += signal * weight;
-      outputWS.mutableE(yi)[xi] += variance * weight;
-      outputWS.dataF(yi)[xi] += weight * inputWeight;
+    accumulate(yi, xi, signal * weight, variance * weight,
+               weight * inputWeight);
+  }
+}
+} // namespace
+
+/**
+ * Rebin the input quadrilateral to the output grid.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ,
+                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, MatrixWorkspace &outputWS,
+                   const std::vector<double> &verticalAxis) {
+  rebinQuadrilateral(inputQ, inputWS, i, j, outputWS.x(0).rawData(),
+                     verticalAxis,
+                     [&outputWS](const size_t yi, const size_t xi,
+                                 const double signal, const double variance) {
+                       PARALLEL_CRITICAL(overlap_sum) {
+                         outputWS.mutableY(yi)[xi] += signal;
+                         outputWS.mutableE(yi)[xi] += variance;
+                       }
+                     });
+}
+
+/**
+ * Rebin the input quadrilateral to a partial output of the grid.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param output The partial output that accumulates the data. It must only be
+ * used by one thread at a time.
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ,
+                   const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, PartialOutput &output,
+                   const std::vector<double> &verticalAxis) {
+  rebinQuadrilateral(inputQ, inputWS, i, j, output.x(), verticalAxis,
+                     [&output](const size_t yi, const size_t xi,
+                               const double signal, const double variance) {
+                       output.add(yi, xi, signal, variance);
+                     });
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinFractionalQuadrilateral(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+      [&outputWS](const size_t yi, const size_t xi, const double signal,
+                  const double variance, const double fraction) {
+        PARALLEL_CRITICAL(overlap) {
+          outputWS.mutableY(yi)[xi] += signal;
+          outputWS.mutableE(yi)[xi] += variance;
+          outputWS.dataF(yi)[xi] += fraction;
+        }
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to a partial output of the grid, keeping
+ * track of the fractional areas.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param output The partial output that accumulates the data. It must have
+ * been created for a RebinnedOutput workspace and only be used by one thread
+ * at a time.
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             PartialOutput &output,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinFractionalQuadrilateral(
+      inputQ, inputWS, i, j, output.x(), verticalAxis, inputRB,
+      [&output](const size_t yi, const size_t xi, const double signal,
+                const double variance, const double fraction) {
+        output.add(yi, xi, signal, variance, fraction);
+      });
+}
+
+/**
+ * Create zeroed signal, variance and, for a RebinnedOutput, fractional area
+ * arrays matching the output workspace.
+ * @param outputWS The workspace the partial output will be added to
+ */
+PartialOutput::PartialOutput(const MatrixWorkspace &outputWS)
+    : m_x(outputWS.x(0).rawData()), m_nBins(outputWS.blocksize()) {
+  const size_t size = outputWS.getNumberHistograms() * m_nBins;
+  m_signal.resize(size, 0.);
+  m_variance.resize(size, 0.);
+  if (dynamic_cast<const RebinnedOutput *>(&outputWS))
+    m_fraction.resize(size, 0.);
+}
+
+/**
+ * Create one partial output per thread, so that the input can be rebinned in
+ * parallel without locking the output. No partial outputs are created when
+ * running in a single thread or when their memory would exceed that of the
+ * signal and errors of the input; the output workspace has to be locked then.
+ * @param inputWS The workspace being rebinned
+ * @param outputWS The workspace the partial outputs will be added to
+ * @return The partial outputs, empty if the output workspace should be used
+ */
+std::vector<PartialOutput>
+createPartialOutputs(const MatrixWorkspace &inputWS,
+                     const MatrixWorkspace &outputWS) {
+  std::vector<PartialOutput> partialOutputs;
+  const size_t nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  const size_t arrays =
+      dynamic_cast<const RebinnedOutput *>(&outputWS) ? 3 : 2;
+  const size_t partialSize = arrays * outputWS.getNumberHistograms() *
+                             outputWS.blocksize() * nThreads;
+  const size_t inputSize =
+      2 * inputWS.getNumberHistograms() * inputWS.blocksize();
+  if (nThreads < 2 || partialSize > inputSize)
+    return partialOutputs;
+
+  partialOutputs.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; ++i)
+    partialOutputs.emplace_back(outputWS);
+  return partialOutputs;
+}
+
+/**
+ * Add the partial outputs to the output workspace. The partial outputs are
+ * summed in order for every bin, so the result does not depend on which
+ * thread filled which partial output.
+ * @param partialOutputs The partial outputs created for the workspace
+ * @param outputWS The workspace that accumulates the data
+ */
+void addPartialOutputs(const std::vector<PartialOutput> &partialOutputs,
+                       MatrixWorkspace &outputWS) {
+  if (partialOutputs.empty())
+    return;
+  auto outputRB = dynamic_cast<RebinnedOutput *>(&outputWS);
+  const size_t nBins = outputWS.blocksize();
+  PARALLEL_FOR_IF(Kernel::threadSafe(outputWS))
+  for (int64_t i = 0; i < static_cast<int64_t>(outputWS.getNumberHistograms());
+       ++i) {
+    auto &outputY = outputWS.mutableY(i);
+    auto &outputE = outputWS.mutableE(i);
+    const size_t offset = static_cast<size_t>(i) * nBins;
+    for (const auto &partial : partialOutputs) {
+      for (size_t j = 0; j < nBins; ++j) {
+        outputY[j] += partial.m_signal[offset + j];
+        outputE[j] += partial.m_variance[offset + j];
+      }
+    }
+    if (outputRB) {
+      auto &outputF = outputRB->dataF(i);
+      for (const auto &partial : partialOutputs)
+        for (size_t j = 0; j < nBins; ++j)
+          outputF[j] += partial.m_fraction[offset + j];
     }
   }
 }
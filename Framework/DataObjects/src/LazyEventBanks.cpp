@@ -0,0 +1,217 @@
+#include "MantidDataObjects/LazyEventBanks.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+
+const size_t LazyEventBanks::NO_BANK = std::numeric_limits<size_t>::max();
+
+/** Constructor
+ * @param bankOfSpectrum :: the bank index of each spectrum of the workspace,
+ * NO_BANK for spectra whose events are never loaded lazily
+ * @param numBanks :: the number of banks
+ * @param maxBanksInMemory :: the maximum number of banks that were only read
+ * through pins to keep in memory before evicting the least recently used one,
+ * 0 to never evict banks
+ */
+LazyEventBanks::LazyEventBanks(std::vector<size_t> bankOfSpectrum,
+                               const size_t numBanks,
+                               const size_t maxBanksInMemory)
+    : m_bankOfSpectrum(std::move(bankOfSpectrum)), m_spectraOfBank(numBanks),
+      m_state(numBanks), m_pins(numBanks, 0),
+      m_maxBanksInMemory(maxBanksInMemory) {
+  for (size_t i = 0; i < m_bankOfSpectrum.size(); ++i) {
+    const size_t bank = m_bankOfSpectrum[i];
+    if (bank == NO_BANK) {
+      m_spectraWithoutBank.push_back(i);
+      continue;
+    }
+    if (bank >= numBanks)
+      throw std::invalid_argument("LazyEventBanks: bank index out of range");
+    m_spectraOfBank[bank].push_back(i);
+  }
+  for (auto &state : m_state)
+    state.store(State::Unloaded);
+  if (m_maxBanksInMemory > 0)
+    m_evictable =
+        Kernel::make_unique<Kernel::MRUList<BankMarker>>(m_maxBanksInMemory);
+}
+
+/** Make sure the bank containing a spectrum is loaded, and keep it in memory
+ * from now on since references to its event lists may be kept.
+ * @param spectra :: the event lists of the workspace
+ * @param index :: workspace index of the spectrum being accessed
+ */
+void LazyEventBanks::load(const std::vector<EventList *> &spectra,
+                          const size_t index) {
+  if (index >= m_bankOfSpectrum.size())
+    return;
+  const size_t bank = m_bankOfSpectrum[index];
+  if (bank == NO_BANK)
+    return;
+  // Fast path, no need to lock once the bank stays in memory
+  if (m_state[bank].load(std::memory_order_acquire) == State::Resident)
+    return;
+
+  std::lock_guard<std::mutex> _lock(m_mutex);
+  loadLocked(spectra, bank);
+  if (m_evictable)
+    m_evictable->deleteIndex(bank);
+  m_state[bank].store(State::Resident, std::memory_order_release);
+}
+
+/** Load all banks that are not loaded yet and keep them in memory.
+ * @param spectra :: the event lists of the workspace
+ */
+void LazyEventBanks::loadAll(const std::vector<EventList *> &spectra) {
+  if (m_allResident.load())
+    return;
+  std::lock_guard<std::mutex> _lock(m_mutex);
+  for (size_t bank = 0; bank < numBanks(); ++bank) {
+    loadLocked(spectra, bank);
+    m_state[bank].store(State::Resident, std::memory_order_release);
+  }
+  if (m_evictable)
+    m_evictable->clear();
+  m_allResident.store(true);
+}
+
+/** Load a bank if needed and keep it in memory until the returned pin is
+ * destroyed. If the bank was not accessed otherwise, it may be evicted after
+ * that.
+ * @param spectra :: the event lists of the workspace
+ * @param bank :: index of the bank
+ * @return the pin of the bank
+ */
+LazyEventBanks::Pin
+LazyEventBanks::pin(const std::vector<EventList *> &spectra,
+                    const size_t bank) {
+  if (bank >= numBanks())
+    throw std::out_of_range("LazyEventBanks: bank index out of range");
+  std::lock_guard<std::mutex> _lock(m_mutex);
+  loadLocked(spectra, bank);
+  if (m_evictable)
+    m_evictable->deleteIndex(bank);
+  ++m_pins[bank];
+  return Pin(*this, spectra, bank);
+}
+
+/** @param bank :: index of the bank
+ * @return true if the events of the bank are in memory
+ */
+bool LazyEventBanks::isLoaded(const size_t bank) const {
+  return m_state[bank].load(std::memory_order_acquire) != State::Unloaded;
+}
+
+/// @return the number of banks whose events are in memory
+size_t LazyEventBanks::numLoadedBanks() const {
+  return std::count_if(m_state.begin(), m_state.end(),
+                       [](const std::atomic<State> &state) {
+                         return state.load() != State::Unloaded;
+                       });
+}
+
+/** Release a pin of a bank. Once a streamed bank has no pins left it becomes
+ * the most recently used evictable bank, evicting the least recently used one
+ * if there are too many.
+ * @param spectra :: the event lists of the workspace
+ * @param bank :: index of the bank
+ */
+void LazyEventBanks::unpin(const std::vector<EventList *> &spectra,
+                           const size_t bank) {
+  std::lock_guard<std::mutex> _lock(m_mutex);
+  if (--m_pins[bank] > 0 || !m_evictable ||
+      m_state[bank].load(std::memory_order_relaxed) != State::Streamed)
+    return;
+  BankMarker *marker = m_evictable->find(bank);
+  if (!marker)
+    marker = new BankMarker(bank);
+  if (BankMarker *dropped = m_evictable->insert(marker)) {
+    evict(spectra, dropped->m_index);
+    delete dropped;
+  }
+}
+
+/** Load a bank if it is not loaded yet. Must hold m_mutex.
+ * @param spectra :: the event lists of the workspace
+ * @param bank :: index of the bank
+ */
+void LazyEventBanks::loadLocked(const std::vector<EventList *> &spectra,
+                                const size_t bank) {
+  if (m_state[bank].load(std::memory_order_relaxed) != State::Unloaded)
+    return;
+  try {
+    loadBank(spectra, bank);
+  } catch (...) {
+    // Do not leave a partially loaded bank behind
+    for (const auto index : m_spectraOfBank[bank])
+      spectra[index]->clearData();
+    throw;
+  }
+  m_state[bank].store(State::Streamed, std::memory_order_release);
+}
+
+/** Free the events of a bank that is neither pinned nor resident, it is
+ * loaded again on the next access. Must hold m_mutex.
+ * @param spectra :: the event lists of the workspace
+ * @param bank :: index of the bank
+ */
+void LazyEventBanks::evict(const std::vector<EventList *> &spectra,
+                           const size_t bank) {
+  for (const auto index : m_spectraOfBank[bank])
+    spectra[index]->clearData();
+  m_state[bank].store(State::Unloaded, std::memory_order_release);
+}
+
+LazyEventBanks::Pin::Pin(LazyEventBanks &banks,
+                         const std::vector<EventList *> &spectra,
+                         const size_t bank)
+    : m_banks(&banks), m_spectra(&spectra), m_bank(bank) {}
+
+LazyEventBanks::Pin::Pin(Pin &&other) noexcept
+    : m_banks(other.m_banks), m_spectra(other.m_spectra),
+      m_bank(other.m_bank) {
+  other.m_banks = nullptr;
+}
+
+LazyEventBanks::Pin &LazyEventBanks::Pin::operator=(Pin &&other) noexcept {
+  if (this != &other) {
+    release();
+    m_banks = other.m_banks;
+    m_spectra = other.m_spectra;
+    m_bank = other.m_bank;
+    other.m_banks = nullptr;
+  }
+  return *this;
+}
+
+LazyEventBanks::Pin::~Pin() { release(); }
+
+/** Access the event list of a spectrum of the pinned bank without keeping
+ * the bank in memory beyond the lifetime of the pin.
+ * @param index :: workspace index of the spectrum
+ * @return the event list, valid as long as the pin
+ * @throws std::invalid_argument if the spectrum is not in the pinned bank
+ */
+const EventList &LazyEventBanks::Pin::spectrum(const size_t index) const {
+  if (!m_banks || index >= m_banks->m_bankOfSpectrum.size() ||
+      m_banks->m_bankOfSpectrum[index] != m_bank)
+    throw std::invalid_argument(
+        "LazyEventBanks::Pin: the spectrum is not in the pinned bank");
+  return *(*m_spectra)[index];
+}
+
+/// Release the pin, unless it was moved from
+void LazyEventBanks::Pin::release() {
+  if (m_banks)
+    m_banks->unpin(*m_spectra, m_bank);
+  m_banks = nullptr;
+}
+
+} // namespace DataObjects
+} // namespace Mantid
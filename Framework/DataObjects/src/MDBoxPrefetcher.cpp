@@ -0,0 +1,69 @@
+#include "MantidDataObjects/MDBoxPrefetcher.h"
+#include "MantidAPI/BoxController.h"
+#include "MantidAPI/IBoxControllerIO.h"
+#include "MantidKernel/ISaveable.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** Constructor
+ * @param boxes :: the boxes in the order they are going to be used
+ * @param maxEvents :: maximum number of events to read ahead
+ */
+MDBoxPrefetcher::MDBoxPrefetcher(const std::vector<API::IMDNode *> &boxes,
+                                 const uint64_t maxEvents)
+    : m_boxes(boxes), m_fileIO(nullptr), m_maxEvents(maxEvents), m_first(0),
+      m_requestedEvents(0) {
+  if (!m_boxes.empty()) {
+    auto bc = m_boxes.front()->getBoxController();
+    if (bc && bc->isFileBacked())
+      m_fileIO = bc->getFileIO();
+  }
+}
+
+/// Destructor, releases the events read ahead which were not used
+MDBoxPrefetcher::~MDBoxPrefetcher() { advanceTo(m_boxes.size()); }
+
+/** Move on to a box, which is going to be used next. The boxes before it are
+ * not going to be used any more, and the boxes after it are read ahead.
+ * @param index :: the index of the box in the list of boxes
+ */
+void MDBoxPrefetcher::advanceTo(const size_t index) {
+  if (!m_fileIO)
+    return;
+
+  const size_t first = std::min(index, m_boxes.size());
+  for (; m_first < first; ++m_first) {
+    if (m_requests.empty())
+      continue;
+    const auto request = m_requests.front();
+    m_requests.pop_front();
+    if (request.second > 0) {
+      // no-op if the events have been loaded
+      m_fileIO->cancelPrefetch(request.first);
+      m_requestedEvents -= request.second;
+    }
+  }
+
+  for (size_t next = m_first + m_requests.size(); next < m_boxes.size();
+       ++next) {
+    const Kernel::ISaveable *saveable = m_boxes[next]->getISaveable();
+    size_t nEvents = 0;
+    if (saveable && saveable->wasSaved() && !saveable->isLoaded())
+      nEvents = saveable->getFileSize();
+    if (nEvents > 0 && m_requestedEvents > 0 &&
+        m_requestedEvents + nEvents > m_maxEvents)
+      break;
+    m_requests.emplace_back(nEvents > 0 ? saveable->getFilePosition() : 0,
+                            nEvents);
+    if (nEvents > 0) {
+      m_fileIO->prefetchBlock(saveable->getFilePosition(), nEvents);
+      m_requestedEvents += nEvents;
+    }
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -24,12 +24,8 @@ Workspace2D::Workspace2D(const Parallel::StorageMode storageMode)
     : HistoWorkspace(storageMode) {}
 
 Workspace2D::Workspace2D(const Workspace2D &other)
-    : HistoWorkspace(other), m_monitorList(other.m_monitorList) {
-  data.resize(other.data.size());
-  for (size_t i = 0; i < data.size(); ++i) {
-    data[i] = new Histogram1D(*(other.data[i]));
-  }
-}
+    : HistoWorkspace(other), m_monitorList(other.m_monitorList),
+      data(other.data) {}
 
 /// Destructor
 Workspace2D::~Workspace2D() {
@@ -41,16 +37,15 @@ Workspace2D::~Workspace2D() {
 // interleaved and then trying to deallocate this serially leads to
 // lots of swapping in and out of memory. See
 // http://social.msdn.microsoft.com/Forums/en-US/2fe4cfc7-ca5c-4665-8026-42e0ba634214/visual-studio-$
-
+// The Histogram1D objects live in one array, so release their data arrays
+// in parallel before the array is freed.
 #ifdef _MSC_VER
   PARALLEL_FOR_IF(Kernel::threadSafe(*this))
   for (int64_t i = 0; i < static_cast<int64_t>(data.size()); i++) {
-#else
-  for (size_t i = 0; i < data.size(); ++i) {
-#endif
-    // Clear out the memory
-    delete data[i];
+    const auto &histogram = data[i].histogram();
+    data[i] = Histogram1D(histogram.xMode(), histogram.yMode());
   }
+#endif
 }
 
 /**
@@ -67,8 +62,6 @@ Workspace2D::~Workspace2D() {
  */
 void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
                        const std::size_t &YLength) {
-  data.resize(NVectors);
-
   auto x = Kernel::make_cow<HistogramData::HistogramX>(
       XLength, HistogramData::LinearGenerator(1.0, 1.0));
   HistogramData::Counts y(YLength);
@@ -78,10 +71,10 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
   spec.setX(x);
   spec.setCounts(y);
   spec.setCountStandardDeviations(e);
+  data.assign(NVectors, spec);
   for (size_t i = 0; i < data.size(); i++) {
-    data[i] = new Histogram1D(spec);
     // Default spectrum number = starts at 1, for workspace index 0.
-    data[i]->setSpectrumNo(specnum_t(i + 1));
+    data[i].setSpectrumNo(specnum_t(i + 1));
   }
 
   // Add axes that reference the data
@@ -91,8 +84,6 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
 }
 
 void Workspace2D::init(const HistogramData::Histogram &histogram) {
-  data.resize(numberOfDetectorGroups());
-
   HistogramData::Histogram initializedHistogram(histogram);
   if (!histogram.sharedY()) {
     if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies) {
@@ -107,9 +98,7 @@ void Workspace2D::init(const HistogramData::Histogram &histogram) {
 
   Histogram1D spec(initializedHistogram.xMode(), initializedHistogram.yMode());
   spec.setHistogram(initializedHistogram);
-  for (auto &i : data) {
-    i = new Histogram1D(spec);
-  }
+  data.assign(numberOfDetectorGroups(), spec);
 
   // Add axes that reference the data
   m_axes.resize(2);
@@ -127,8 +116,8 @@ size_t Workspace2D::getNumberHistograms() const {
 /// get pseudo size
 size_t Workspace2D::size() const {
   return std::accumulate(data.begin(), data.end(), static_cast<size_t>(0),
-                         [](const size_t value, const Histogram1D *histo) {
-                           return value + histo->size();
+                         [](const size_t value, const Histogram1D &histo) {
+                           return value + histo.size();
                          });
 }
 
@@ -137,9 +126,9 @@ size_t Workspace2D::blocksize() const {
   if (data.empty()) {
     return 0;
   } else {
-    size_t numBins = data[0]->size();
-    for (const auto *iter : data)
-      if (numBins != iter->size())
+    size_t numBins = data[0].size();
+    for (const auto &histogram : data)
+      if (numBins != histogram.size())
         throw std::length_error(
             "blocksize undefined because size of histograms is not equal");
     return numBins;
@@ -234,8 +223,8 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
       auto pE = rowE.begin();
       for (auto pY = rowY.begin(); pY != rowY.end() && pE != rowE.end();
            ++pY, ++pE, ++spec) {
-        data[spec]->dataY()[0] = *pY;
-        data[spec]->dataE()[0] = *pE;
+        data[spec].dataY()[0] = *pY;
+        data[spec].dataE()[0] = *pE;
       }
     }
   } else {
@@ -262,18 +251,18 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
 
       const auto &rowY = imageY[i];
       const auto &rowE = imageE[i];
-      data[i]->dataY() = rowY;
-      data[i]->dataE() = rowE;
+      data[i].dataY() = rowY;
+      data[i].dataE() = rowE;
     }
     // X values. Set first spectrum and copy/propagate that one to all the other
     // spectra
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 0; i < static_cast<int>(width) + 1; ++i) {
-      data[0]->dataX()[i] = i * scale_1;
+      data[0].dataX()[i] = i * scale_1;
     }
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 1; i < static_cast<int>(height); ++i) {
-      data[i]->setX(data[0]->ptrX());
+      data[i].setX(data[0].ptrX());
     }
   }
 }
@@ -295,7 +284,7 @@ const Histogram1D &Workspace2D::getSpectrum(const size_t index) const {
        << " out of range " << data.size();
     throw std::range_error(ss.str());
   }
-  return *data[index];
+  return data[index];
 }
 
 //--------------------------------------------------------------------------------------------
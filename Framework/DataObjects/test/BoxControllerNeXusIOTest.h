@@ -5,8 +5,10 @@
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <thread>
 
 #include <cxxtest/TestSuite.h>
 
@@ -226,7 +228,107 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_prefetched_block_is_loaded() {
+    auto pSaver = createFileWithEvents();
+    std::vector<float> toRead;
+
+    pSaver->prefetchBlock(0, 20);
+    TS_ASSERT(waitForPrefetch(*pSaver, 1));
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 0, 20));
+    TS_ASSERT_EQUALS(toRead, m_events);
+
+    const auto statistics = pSaver->getPrefetchStatistics();
+    TS_ASSERT_EQUALS(statistics.hits, 1);
+    TS_ASSERT_EQUALS(statistics.misses, 0);
+    TS_ASSERT_EQUALS(statistics.discarded, 0);
+    closeAndRemove(pSaver);
+  }
+
+  void test_prefetched_block_is_discarded_when_overwritten() {
+    auto pSaver = createFileWithEvents();
+    const size_t nColumns = pSaver->getNDataColums();
+
+    pSaver->prefetchBlock(0, 20);
+    TS_ASSERT(waitForPrefetch(*pSaver, 1));
+    std::vector<float> update(2 * nColumns, -1.f);
+    pSaver->saveBlock(update, 5);
+    std::copy(update.begin(), update.end(), m_events.begin() + 5 * nColumns);
+
+    std::vector<float> toRead;
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 0, 20));
+    TS_ASSERT_EQUALS(toRead, m_events);
+    const auto statistics = pSaver->getPrefetchStatistics();
+    TS_ASSERT_EQUALS(statistics.hits, 0);
+    TS_ASSERT_EQUALS(statistics.misses, 1);
+    TS_ASSERT_EQUALS(statistics.discarded, 1);
+    closeAndRemove(pSaver);
+  }
+
+  void test_cancelled_block_is_read_from_file() {
+    auto pSaver = createFileWithEvents();
+
+    pSaver->prefetchBlock(0, 20);
+    pSaver->cancelPrefetch(0);
+    std::vector<float> toRead;
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 0, 20));
+    TS_ASSERT_EQUALS(toRead, m_events);
+    const auto statistics = pSaver->getPrefetchStatistics();
+    TS_ASSERT_EQUALS(statistics.hits, 0);
+    TS_ASSERT_EQUALS(statistics.misses, 1);
+    closeAndRemove(pSaver);
+  }
+
+  void test_closing_the_file_discards_prefetched_blocks() {
+    auto pSaver = createFileWithEvents();
+
+    pSaver->prefetchBlock(0, 10);
+    pSaver->prefetchBlock(10, 10);
+    TS_ASSERT(waitForPrefetch(*pSaver, 2));
+    std::string FullPathFile = pSaver->getFileName();
+    TS_ASSERT_THROWS_NOTHING(pSaver->closeFile());
+    TS_ASSERT_EQUALS(pSaver->getPrefetchStatistics().discarded, 2);
+    delete pSaver;
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
 private:
+  /// Create a test box controller with a file holding 20 events, which are
+  /// kept in m_events. Ownership is passed to the caller
+  Mantid::DataObjects::BoxControllerNeXusIO *createFileWithEvents() {
+    auto pSaver = createTestBoxController();
+    pSaver->setDataType(4, "MDEvent");
+    pSaver->openFile(this->xxfFileName, "w");
+    const size_t nColumns = pSaver->getNDataColums();
+    m_events.resize(20 * nColumns);
+    for (size_t i = 0; i < m_events.size(); ++i)
+      m_events[i] = static_cast<float>(i);
+    pSaver->saveBlock(m_events, 0);
+    return pSaver;
+  }
+
+  /// Wait for the background thread to read a number of blocks
+  bool waitForPrefetch(
+      const Mantid::DataObjects::BoxControllerNeXusIO &saver,
+      const size_t nBlocks) {
+    for (int i = 0; i < 1000; ++i) {
+      if (saver.getPrefetchStatistics().prefetched >= nBlocks)
+        return true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+  }
+
+  void closeAndRemove(Mantid::DataObjects::BoxControllerNeXusIO *pSaver) {
+    std::string FullPathFile = pSaver->getFileName();
+    pSaver->closeFile();
+    delete pSaver;
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
+  std::vector<float> m_events;
+
   /// Create a test box controller. Ownership is passed to the caller
   Mantid::DataObjects::BoxControllerNeXusIO *createTestBoxController() {
     return new Mantid::DataObjects::BoxControllerNeXusIO(sc.get());
@@ -60,7 +60,41 @@ private:
     return transform;
   }
 
+  /** Helper checking that applyToColumns() matches apply() point by point */
+  void check_applyToColumns(size_t inD, size_t outD) {
+    CoordTransformAffine ct(inD, outD);
+    Matrix<coord_t> mat(outD + 1, inD + 1);
+    for (size_t row = 0; row < outD; ++row)
+      for (size_t col = 0; col <= inD; ++col)
+        mat[row][col] = coord_t(0.37 * double(row + 1) - 0.21 * double(col));
+    mat[outD][inD] = 1.0;
+    ct.setMatrix(mat);
+
+    const size_t numPoints = 7;
+    const size_t stride = 9;
+    std::vector<coord_t> columns(inD * stride);
+    for (size_t i = 0; i < columns.size(); ++i)
+      columns[i] = coord_t(0.5 * double(i) - 3.0);
+    std::vector<coord_t> outColumns(outD * stride);
+    ct.applyToColumns(columns.data(), outColumns.data(), numPoints, stride);
+
+    std::vector<coord_t> in(inD), out(outD);
+    for (size_t i = 0; i < numPoints; ++i) {
+      for (size_t d = 0; d < inD; ++d)
+        in[d] = columns[d * stride + i];
+      ct.apply(in.data(), out.data());
+      for (size_t d = 0; d < outD; ++d)
+        TS_ASSERT_DELTA(outColumns[d * stride + i], out[d], 1e-5);
+    }
+  }
+
 public:
+  void test_applyToColumns_3D() { check_applyToColumns(3, 3); }
+
+  void test_applyToColumns_4D_to_2D() { check_applyToColumns(4, 2); }
+
+  void test_applyToColumns_5D() { check_applyToColumns(5, 5); }
+
   void test_initialization() {
     // Can't output more dimensions than the input
     TS_ASSERT_THROWS_ANYTHING(CoordTransformAffine ct_cant(2, 3))
@@ -418,6 +452,29 @@ public:
       ct.apply(in, out);
     }
   }
+
+  void test_applyToColumns_3D_performance() {
+    do_applyToColumns_performance(3);
+  }
+
+  void test_applyToColumns_4D_performance() {
+    do_applyToColumns_performance(4);
+  }
+
+private:
+  /// Transform 10 million points in blocks of 1024
+  void do_applyToColumns_performance(size_t nd) {
+    CoordTransformAffine ct(nd, nd);
+    std::vector<coord_t> translation(nd, 2.0);
+    ct.addTranslation(translation.data());
+    const size_t blockSize = 1024;
+    std::vector<coord_t> in(nd * blockSize, 1.5);
+    std::vector<coord_t> out(nd * blockSize);
+
+    for (size_t i = 0; i < 1000 * 1000 * 10 / blockSize; ++i) {
+      ct.applyToColumns(in.data(), out.data(), blockSize, blockSize);
+    }
+  }
 };
 
 #endif /* MANTID_DATAOBJECTS_COORDTRANSFORMAFFINETEST_H_ */
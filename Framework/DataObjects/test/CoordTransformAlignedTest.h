@@ -71,6 +71,24 @@ public:
     TS_ASSERT_DELTA(output[2], 3.0, 1e-6);
   }
 
+  void test_applyToColumns() {
+    size_t dimToBinFrom[3] = {3, 1, 0};
+    coord_t origin[3] = {5, 10, 15};
+    coord_t scaling[3] = {1, 2, 3};
+    CoordTransformAligned ct(4, 3, dimToBinFrom, origin, scaling);
+
+    // Two points, in columns with a stride of 3
+    const coord_t input[12] = {16, 17, 0, 11, 12, 0, 1111, 1111, 0, 6, 7, 0};
+    coord_t output[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    ct.applyToColumns(input, output, 2, 3);
+    TS_ASSERT_DELTA(output[0], 1.0, 1e-6);
+    TS_ASSERT_DELTA(output[1], 2.0, 1e-6);
+    TS_ASSERT_DELTA(output[3], 2.0, 1e-6);
+    TS_ASSERT_DELTA(output[4], 4.0, 1e-6);
+    TS_ASSERT_DELTA(output[6], 3.0, 1e-6);
+    TS_ASSERT_DELTA(output[7], 6.0, 1e-6);
+  }
+
   /// Clone the transform, check that it still works
   void test_clone() {
     size_t dimToBinFrom[3] = {3, 1, 0};
@@ -174,5 +192,20 @@ public:
       ct.apply(in, out);
     }
   }
+  void test_applyToColumns_4D_performance() {
+    // Do a simple 4-4 transform, on blocks of 1024 points.
+    size_t dimToBinFrom[4] = {0, 1, 2, 3};
+    coord_t origin[4] = {5, 10, 15, 20};
+    coord_t scaling[4] = {1, 2, 3, 4};
+    CoordTransformAligned ct(4, 4, dimToBinFrom, origin, scaling);
+
+    const size_t blockSize = 1024;
+    std::vector<coord_t> in(4 * blockSize, 1.5);
+    std::vector<coord_t> out(4 * blockSize);
+
+    for (size_t i = 0; i < 1000 * 1000 * 10 / blockSize; ++i) {
+      ct.applyToColumns(in.data(), out.data(), blockSize, blockSize);
+    }
+  }
 };
 #endif /* MANTID_DATAOBJECTS_COORDTRANSFORMALIGNEDTEST_H_ */
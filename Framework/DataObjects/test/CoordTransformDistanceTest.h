@@ -86,6 +86,20 @@ public:
     TS_ASSERT_DELTA(out, 4.0, 1e-5);
   }
 
+  /** The default applyToColumns() gives the same result as apply() */
+  void test_applyToColumns() {
+    coord_t center[2] = {1, 2};
+    bool used[2] = {true, true};
+    CoordTransformDistance ct(2, center, used);
+
+    // Two points, in columns with a stride of 3
+    const coord_t in[6] = {0, -1, 99, 3, 5, 99};
+    coord_t out[3] = {0, 0, 0};
+    TS_ASSERT_THROWS_NOTHING(ct.applyToColumns(in, out, 2, 3));
+    TS_ASSERT_DELTA(out[0], 2.0, 1e-5);
+    TS_ASSERT_DELTA(out[1], 13.0, 1e-5);
+  }
+
   /** Test serialization */
   void test_to_xml_string() {
     std::string expectedResult =
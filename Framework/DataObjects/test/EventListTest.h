@@ -5,7 +5,10 @@
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Histogram1D.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/LogarithmicGenerator.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/make_unique.h"
@@ -1229,6 +1232,167 @@ public:
     TS_ASSERT_EQUALS(this->el.ptrX()->size(), NUMBINS + 1);
   }
 
+  /** Histogram a copy of the list twice, unsorted (direct bin indexing) and
+   * sorted, and check the results agree. */
+  void do_test_histogram_direct_index(const MantidVec &X) {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      if (this_type > 0)
+        el *= 1.5;
+      TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+
+      MantidVec Y, E;
+      el.generateHistogram(X, Y, E);
+      // The events were not sorted for histogramming
+      TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+
+      el.sortTof();
+      MantidVec sortedY, sortedE;
+      el.generateHistogram(X, sortedY, sortedE);
+      TS_ASSERT_EQUALS(Y.size(), X.size() - 1);
+      TS_ASSERT_EQUALS(Y.size(), sortedY.size());
+      TS_ASSERT_EQUALS(E.size(), sortedE.size());
+      for (size_t i = 0; i < Y.size(); ++i) {
+        TS_ASSERT_DELTA(Y[i], sortedY[i], 1e-8);
+        TS_ASSERT_DELTA(E[i], sortedE[i], 1e-8);
+      }
+    }
+  }
+
+  void test_histogram_direct_index_linear() {
+    BinEdges edges(1001, LinearGenerator(1e6, 5e3));
+    do_test_histogram_direct_index(edges.rawData());
+  }
+
+  void test_histogram_direct_index_logarithmic() {
+    BinEdges edges(501, LogarithmicGenerator(1e5, 0.01));
+    do_test_histogram_direct_index(edges.rawData());
+  }
+
+  void test_histogram_direct_index_events_on_bin_edges() {
+    MantidVec X{0., 2., 4., 6., 8., 10.};
+    el = EventList();
+    for (double tof : {10., 8., 0., 2., 9.999, 4., -1e-12, 6., 3.})
+      el += TofEvent(tof, 0);
+    MantidVec Y, E;
+    el.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+    const MantidVec expected{1., 2., 1., 1., 2.};
+    TS_ASSERT_EQUALS(Y, expected);
+  }
+
+  void test_histogram_irregular_bins_still_sorts() {
+    this->fake_data();
+    MantidVec X{0., 1e6, 1.5e6, 4e6, 1e7};
+    MantidVec Y, E;
+    el.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+  }
+
+  //-----------------------------------------------------------------------------------------------
+  void test_columnar_storage_round_trip_allTypes() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      if (this_type > 0)
+        el *= 1.5;
+      const EventList rows(el);
+
+      el.switchToColumnarStorage();
+      TS_ASSERT(el.hasColumnarStorage());
+      TS_ASSERT_EQUALS(el.getNumberEvents(), rows.getNumberEvents());
+      TS_ASSERT_EQUALS(el.getEventType(), rows.getEventType());
+      TS_ASSERT_DELTA(el.getTofMin(), rows.getTofMin(), 1e-8);
+      TS_ASSERT_DELTA(el.getTofMax(), rows.getTofMax(), 1e-8);
+
+      // Anything that is not column aware switches back to rows
+      TS_ASSERT(el == rows);
+      TS_ASSERT(!el.hasColumnarStorage());
+    }
+  }
+
+  void test_columnar_storage_const_readers_while_switching_to_rows() {
+    this->fake_data();
+    const size_t numEvents = el.getNumberEvents();
+    const double tofMin = el.getTofMin();
+    const double tofMax = el.getTofMax();
+    el.switchToColumnarStorage();
+    const EventList &constEl = el;
+
+    // One iteration switches back to rows while the others keep reading
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000; ++i) {
+      if (i == 500)
+        constEl.switchToRowStorage();
+      TS_ASSERT_EQUALS(constEl.getNumberEvents(), numEvents);
+      TS_ASSERT_EQUALS(constEl.getTofMin(), tofMin);
+      TS_ASSERT_EQUALS(constEl.getTofMax(), tofMax);
+    }
+    TS_ASSERT(!el.hasColumnarStorage());
+  }
+
+  void test_columnar_storage_histogram_allTypes() {
+    const BinEdges linear(1001, LinearGenerator(1e6, 5e3));
+    const MantidVec irregular{0., 1e6, 1.5e6, 4e6, 1e7};
+    for (const auto &X : {linear.rawData(), irregular}) {
+      for (int this_type = 0; this_type < 3; this_type++) {
+        this->fake_data();
+        el.switchTo(static_cast<EventType>(this_type));
+        if (this_type > 0)
+          el *= 1.5;
+        MantidVec rowY, rowE;
+        el.generateHistogram(X, rowY, rowE);
+
+        el.switchToColumnarStorage();
+        MantidVec Y, E;
+        el.generateHistogram(X, Y, E);
+        TS_ASSERT(el.hasColumnarStorage());
+        TS_ASSERT_EQUALS(Y.size(), rowY.size());
+        TS_ASSERT_EQUALS(E.size(), rowE.size());
+        for (size_t i = 0; i < Y.size(); ++i) {
+          TS_ASSERT_DELTA(Y[i], rowY[i], 1e-8);
+          TS_ASSERT_DELTA(E[i], rowE[i], 1e-8);
+        }
+      }
+    }
+  }
+
+  void test_columnar_storage_sort_and_convertTof() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      EventList rows(el);
+      rows.sortTof();
+      rows.convertTof(2.5, 1.);
+
+      el.switchToColumnarStorage();
+      el.sortTof();
+      el.convertTof(2.5, 1.);
+      TS_ASSERT(el.hasColumnarStorage());
+      TS_ASSERT(el.isSortedByTof());
+      std::vector<double> tofs, rowTofs;
+      el.getTofs(tofs);
+      rows.getTofs(rowTofs);
+      TS_ASSERT_EQUALS(tofs, rowTofs);
+      // The other fields were sorted along with the TOF
+      TS_ASSERT(el == rows);
+    }
+  }
+
+  void test_columnar_storage_adding_events_switches_to_rows() {
+    el.switchToColumnarStorage();
+    el.addEventQuickly(TofEvent(7.5, 10));
+    TS_ASSERT(!el.hasColumnarStorage());
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 4);
+    TS_ASSERT_EQUALS(el.getEvent(3).tof(), 7.5);
+
+    el.switchToColumnarStorage();
+    el.clear();
+    TS_ASSERT(!el.hasColumnarStorage());
+    TS_ASSERT(el.empty());
+  }
+
   //  void test_histogram_static_function()
   //  {
   //    std::vector<WeightedEvent> events;
@@ -1880,6 +2044,78 @@ public:
     return;
   }
 
+  //-----------------------------------------------------------------------------------------------
+  /** Test method to split events by full time with splitters compiled into
+   * sorted boundaries and output indices
+   */
+  void test_splitByFullTimeSorted() {
+    // Create 1000 random events close to SNS's frequency
+    fake_uniform_time_sns_data();
+
+    std::vector<EventList> lists(3);
+    std::vector<EventList *> outputs{&lists[0], &lists[1], &lists[2]};
+    // The second splitter has no output and the third one is empty
+    std::vector<int64_t> boundaries{1000000, 2000000, 4000000,
+                                    4000000, 10000000, 500000000};
+    std::vector<size_t> targets{0, 3, 2, 1, 2};
+    el.splitByFullTimeSorted(boundaries, targets, outputs, false, 1.0, 0.0);
+
+    TS_ASSERT_EQUALS(lists[0].getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(lists[0].getEvent(0).pulseTime(), DateAndTime(1000000));
+    TS_ASSERT_EQUALS(lists[1].getNumberEvents(), 6);
+    TS_ASSERT_EQUALS(lists[1].getEvent(0).pulseTime(), DateAndTime(4000000));
+    TS_ASSERT_EQUALS(lists[2].getNumberEvents(), 490);
+    TS_ASSERT_EQUALS(lists[2].getEventType(), TOF);
+  }
+
+  void test_splitByFullTimeSorted_weighted_with_correction() {
+    fake_uniform_time_sns_data();
+    el.switchTo(WEIGHTED);
+
+    EventList output;
+    std::vector<EventList *> outputs{&output, nullptr};
+    // Shifting by 2 ms moves events 8 and 9 into the first splitter
+    std::vector<int64_t> boundaries{10000000, 12000000, 20000000};
+    std::vector<size_t> targets{0, 1};
+    el.splitByFullTimeSorted(boundaries, targets, outputs, true, 0.0, 2.0E-3);
+
+    TS_ASSERT_EQUALS(output.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(output.getEvent(0).pulseTime(), DateAndTime(8000000));
+  }
+
+  void test_splitByFullTimeSorted_event_on_boundary_goes_to_later_splitter() {
+    fake_uniform_time_sns_data();
+
+    // More splitters than events, each starting exactly at a pulse time
+    std::vector<EventList> lists(2);
+    std::vector<EventList *> outputs{&lists[0], &lists[1]};
+    std::vector<int64_t> boundaries;
+    std::vector<size_t> targets;
+    for (int64_t i = 0; i < 2000; ++i) {
+      boundaries.push_back(i * 1000000);
+      targets.push_back(static_cast<size_t>(i % 2));
+    }
+    boundaries.push_back(2000000000);
+    // Without the TOF, the full time of each event is its pulse time
+    el.splitByFullTimeSorted(boundaries, targets, outputs, true, 0.0, 0.0);
+
+    TS_ASSERT_EQUALS(lists[0].getNumberEvents(), 500);
+    TS_ASSERT_EQUALS(lists[0].getEvent(0).pulseTime(), DateAndTime(0));
+    TS_ASSERT_EQUALS(lists[1].getNumberEvents(), 500);
+    TS_ASSERT_EQUALS(lists[1].getEvent(0).pulseTime(), DateAndTime(1000000));
+  }
+
+  void test_splitByFullTimeSorted_throws_on_mismatched_targets() {
+    fake_uniform_time_sns_data();
+    std::vector<EventList *> outputs;
+    std::vector<int64_t> boundaries{1000000, 2000000};
+    std::vector<size_t> targets;
+    TS_ASSERT_THROWS(el.splitByFullTimeSorted(boundaries, targets, outputs,
+                                              false, 1.0, 0.0),
+                     std::invalid_argument);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_allTypes() {
     // Go through each possible EventType as the input
@@ -2112,6 +2348,29 @@ public:
     }   // starting event type
   }
 
+  void test_compressEvents_columnar_storage() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      for (size_t inplace = 0; inplace < 2; inplace++) {
+        this->fake_data();
+        el.switchTo(static_cast<EventType>(this_type));
+        if (this_type > 0)
+          el *= 2.0;
+        EventList rows(el);
+        EventList rowsOut;
+        rows.compressEvents(1e3, &rowsOut);
+
+        el.switchToColumnarStorage();
+        EventList out;
+        EventList *el_out = inplace ? &el : &out;
+        el.compressEvents(1e3, el_out);
+        TS_ASSERT(el_out->hasColumnarStorage());
+        TS_ASSERT_EQUALS(el_out->getEventType(), WEIGHTED_NOTIME);
+        TS_ASSERT(el_out->isSortedByTof());
+        TS_ASSERT(*el_out == rowsOut);
+      }
+    }
+  }
+
   void test_compressFatEvents() {
     // no pulse time should throw an exception
     EventList el_notime_output;
@@ -2821,6 +3080,81 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  /* Compare histogramming unsorted events with linear bins directly against
+   * sorting them first. */
+  void test_histogram_linear_direct_index_1e5() {
+    do_test_histogram_linear(100000, false);
+  }
+  void test_histogram_linear_sorted_1e5() {
+    do_test_histogram_linear(100000, true);
+  }
+  void test_histogram_linear_direct_index_1e6() {
+    do_test_histogram_linear(1000000, false);
+  }
+  void test_histogram_linear_sorted_1e6() {
+    do_test_histogram_linear(1000000, true);
+  }
+  void test_histogram_linear_direct_index_1e7() {
+    do_test_histogram_linear(10000000, false);
+  }
+  void test_histogram_linear_sorted_1e7() {
+    do_test_histogram_linear(10000000, true);
+  }
+  void test_histogram_linear_direct_index_1e8() {
+    do_test_histogram_linear(100000000, false);
+  }
+  void test_histogram_linear_sorted_1e8() {
+    do_test_histogram_linear(100000000, true);
+  }
+
+  void test_histogram_log_direct_index_1e7() {
+    EventList el;
+    fillRandomEvents(el, 10000000);
+    BinEdges edges(2001, LogarithmicGenerator(10., 0.004));
+    MantidVec Y, E;
+    el.generateHistogram(edges.rawData(), Y, E);
+  }
+
+  void test_histogram_log_sorted_1e7() {
+    EventList el;
+    fillRandomEvents(el, 10000000);
+    BinEdges edges(2001, LogarithmicGenerator(10., 0.004));
+    MantidVec Y, E;
+    el.sortTof();
+    el.generateHistogram(edges.rawData(), Y, E);
+  }
+
+  /* Compare TOF-only operations on events stored as columns against rows. */
+  void test_convertTof_columnar_1e7() {
+    EventList el;
+    fillRandomEvents(el, 10000000);
+    el.switchToColumnarStorage();
+    el.convertTof(2.5, 6.78);
+  }
+
+  void test_convertTof_rows_1e7() {
+    EventList el;
+    fillRandomEvents(el, 10000000);
+    el.convertTof(2.5, 6.78);
+  }
+
+  void test_histogram_linear_columnar_1e7() {
+    EventList el;
+    fillRandomEvents(el, 10000000);
+    el.switchToColumnarStorage();
+    BinEdges edges(5001, LinearGenerator(0., 4.));
+    MantidVec Y, E;
+    el.generateHistogram(edges.rawData(), Y, E);
+  }
+
+  void test_compressEvents_columnar() {
+    // Work on a copy, the shared fixture is used by the tests that follow
+    EventList columnar(el_sorted);
+    columnar.switchToColumnarStorage();
+    EventList out_el;
+    columnar.compressEvents(10.0, &out_el);
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
@@ -2832,6 +3166,70 @@ public:
     double integ = el_sorted.integrate(25e3, 75e3, false);
     TS_ASSERT_DELTA(integ, 5e6, 1);
   }
+
+  /* Compare splitting a long run into many time slices with the sorted
+   * splitters against the matrix splitters. */
+  void test_splitByFullTimeSorted_1e8_events_10k_slices() {
+    do_test_split(100000000, 10000, true);
+  }
+
+  void test_splitByFullTimeMatrixSplitter_1e8_events_10k_slices() {
+    do_test_split(100000000, 10000, false);
+  }
+
+private:
+  /// Fill with unsorted events with TOF up to 2e4
+  void fillRandomEvents(EventList &el, const size_t nEvents) {
+    el.reserve(nEvents);
+    for (size_t i = 0; i < nEvents; i++)
+      el.addEventQuickly(TofEvent((rand() % 200000) * 0.1, rand() % 1000));
+  }
+
+  void do_test_histogram_linear(const size_t nEvents, const bool sortFirst) {
+    EventList el;
+    fillRandomEvents(el, nEvents);
+    BinEdges edges(5001, LinearGenerator(0., 4.));
+    MantidVec Y, E;
+    if (sortFirst)
+      el.sortTof();
+    el.generateHistogram(edges.rawData(), Y, E);
+  }
+
+  /// Split events spread uniformly over 1000 s into slices of equal length
+  void do_test_split(const size_t nEvents, const size_t nSlices,
+                     const bool sorted) {
+    const int64_t runLength = 1000000000000;
+    EventList el;
+    el.reserve(nEvents);
+    for (size_t i = 0; i < nEvents; i++)
+      el.addEventQuickly(TofEvent(
+          (rand() % 160000) * 0.1,
+          DateAndTime(static_cast<int64_t>(i) * (runLength / nEvents))));
+
+    std::vector<int64_t> boundaries(nSlices + 1);
+    for (size_t i = 0; i <= nSlices; i++)
+      boundaries[i] = static_cast<int64_t>(i) * (runLength / nSlices);
+    std::vector<EventList> outputs(nSlices);
+    if (sorted) {
+      std::vector<size_t> targets(nSlices);
+      std::vector<EventList *> outputPtrs(nSlices);
+      for (size_t i = 0; i < nSlices; i++) {
+        targets[i] = i;
+        outputPtrs[i] = &outputs[i];
+      }
+      el.splitByFullTimeSorted(boundaries, targets, outputPtrs, false, 1.0,
+                               0.0);
+    } else {
+      std::vector<int> groups(nSlices);
+      std::map<int, EventList *> outputMap;
+      for (size_t i = 0; i < nSlices; i++) {
+        groups[i] = static_cast<int>(i);
+        outputMap.emplace(groups[i], &outputs[i]);
+      }
+      el.splitByFullTimeMatrixSplitter(boundaries, groups, outputMap, false,
+                                       1.0, 0.0);
+    }
+  }
 };
 
 #endif /// EVENTLISTTEST_H_
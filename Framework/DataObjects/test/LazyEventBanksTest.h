@@ -0,0 +1,210 @@
+#ifndef MANTID_DATAOBJECTS_LAZYEVENTBANKSTEST_H_
+#define MANTID_DATAOBJECTS_LAZYEVENTBANKSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/LazyEventBanks.h"
+#include "MantidKernel/make_unique.h"
+
+using namespace Mantid::DataObjects;
+using Mantid::Kernel::make_unique;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// Puts one event per spectrum, with a TOF encoding the bank and spectrum
+class FakeEventBanks : public LazyEventBanks {
+public:
+  FakeEventBanks(std::vector<size_t> bankOfSpectrum, const size_t numBanks,
+                 const size_t maxBanksInMemory, std::vector<int> &loadCount)
+      : LazyEventBanks(std::move(bankOfSpectrum), numBanks, maxBanksInMemory),
+        m_loadCount(loadCount) {}
+
+protected:
+  void loadBank(const std::vector<EventList *> &spectra,
+                const size_t bank) override {
+    ++m_loadCount[bank];
+    for (const auto index : spectraOfBank(bank))
+      spectra[index]->addEventQuickly(
+          TofEvent(static_cast<double>(100 * bank + index)));
+  }
+
+private:
+  std::vector<int> &m_loadCount;
+};
+} // namespace
+
+class LazyEventBanksTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LazyEventBanksTest *createSuite() { return new LazyEventBanksTest(); }
+  static void destroySuite(LazyEventBanksTest *suite) { delete suite; }
+
+  void test_bank_loaded_on_first_access() {
+    auto ws = makeWorkspace(0);
+    const EventWorkspace &constWS = *ws;
+    TS_ASSERT(ws->hasLazyEventBanks());
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({0, 0, 0}));
+
+    TS_ASSERT_EQUALS(constWS.getSpectrum(3).getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(constWS.getSpectrum(3).getTofMin(), 103.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({0, 1, 0}));
+
+    // The other spectrum of the bank was loaded with it
+    TS_ASSERT_EQUALS(constWS.getSpectrum(2).getTofMin(), 102.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({0, 1, 0}));
+  }
+
+  void test_spectra_without_bank_are_never_loaded() {
+    auto ws = makeWorkspace(0);
+    TS_ASSERT_EQUALS(ws->getSpectrum(6).getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({0, 0, 0}));
+  }
+
+  void test_spectra_of_banks() {
+    auto ws = makeWorkspace(0);
+    TS_ASSERT_EQUALS(ws->numLazyEventBanks(), 3);
+    TS_ASSERT_EQUALS(ws->spectraOfLazyEventBank(1),
+                     std::vector<size_t>({2, 3}));
+    TS_ASSERT_EQUALS(ws->spectraOfLazyEventBank(LazyEventBanks::NO_BANK),
+                     std::vector<size_t>({6}));
+    TS_ASSERT_THROWS(ws->spectraOfLazyEventBank(3), std::out_of_range);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({0, 0, 0}));
+  }
+
+  void test_least_recently_used_bank_is_evicted() {
+    auto ws = makeWorkspace(2);
+    TS_ASSERT(ws->threadSafe());
+    ws->pinLazyEventBank(0);
+    ws->pinLazyEventBank(1);
+    // Pin bank 0 again so bank 1 is the least recently used
+    ws->pinLazyEventBank(0);
+    ws->pinLazyEventBank(2);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+
+    // Bank 1 was evicted and is loaded again
+    TS_ASSERT_EQUALS(ws->pinLazyEventBank(1).spectrum(3).getTofMin(), 103.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 2, 1}));
+    // Bank 0 was evicted to make room, and is loaded again
+    TS_ASSERT_EQUALS(ws->pinLazyEventBank(0).spectrum(0).getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({2, 2, 1}));
+  }
+
+  void test_pinned_bank_is_not_evicted() {
+    auto ws = makeWorkspace(1);
+    const auto pin = ws->pinLazyEventBank(0);
+    ws->pinLazyEventBank(1);
+    ws->pinLazyEventBank(2);
+    TS_ASSERT_EQUALS(pin.spectrum(1).getTofMin(), 1.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+  }
+
+  void test_pin_gives_only_spectra_of_its_bank() {
+    auto ws = makeWorkspace(0);
+    const auto pin = ws->pinLazyEventBank(0);
+    TS_ASSERT_THROWS(pin.spectrum(2), std::invalid_argument);
+    TS_ASSERT_THROWS(pin.spectrum(6), std::invalid_argument);
+    TS_ASSERT_THROWS(ws->pinLazyEventBank(3), std::out_of_range);
+  }
+
+  void test_const_reference_stays_valid() {
+    auto ws = makeWorkspace(1);
+    const EventWorkspace &constWS = *ws;
+    const EventList &spectrum0 = constWS.getSpectrum(0);
+    ws->pinLazyEventBank(1);
+    ws->pinLazyEventBank(2);
+    TS_ASSERT_EQUALS(spectrum0.getNumberEvents(), 1);
+    // Only the banks read through pins were evicted
+    ws->pinLazyEventBank(0);
+    ws->pinLazyEventBank(1);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 2, 1}));
+  }
+
+  void test_access_while_pinned_keeps_the_bank() {
+    auto ws = makeWorkspace(1);
+    const EventWorkspace &constWS = *ws;
+    const EventList *spectrum2{nullptr};
+    {
+      const auto pin = ws->pinLazyEventBank(1);
+      spectrum2 = &constWS.getSpectrum(2);
+    }
+    ws->pinLazyEventBank(0);
+    ws->pinLazyEventBank(2);
+    TS_ASSERT_EQUALS(spectrum2->getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+  }
+
+  void test_scans_of_all_spectra_read_one_bank_at_a_time() {
+    auto ws = makeWorkspace(1);
+    double xmin, xmax;
+    ws->getEventXMinMax(xmin, xmax);
+    TS_ASSERT_EQUALS(xmin, 0.);
+    TS_ASSERT_EQUALS(xmax, 205.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+    // Only the last bank was kept in memory, and is evicted by the next scan
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), 6);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({2, 2, 2}));
+
+    std::vector<double> integrated;
+    ws->getIntegratedSpectra(integrated, 0., 0., true);
+    TS_ASSERT_EQUALS(integrated,
+                     std::vector<double>({1., 1., 1., 1., 1., 1., 0.}));
+    TS_ASSERT(ws->hasLazyEventBanks());
+  }
+
+  void test_modified_bank_is_never_evicted() {
+    auto ws = makeWorkspace(1);
+    const EventWorkspace &constWS = *ws;
+    ws->getSpectrum(0) += TofEvent(5.);
+    ws->pinLazyEventBank(1);
+    ws->pinLazyEventBank(2);
+    ws->pinLazyEventBank(0);
+    TS_ASSERT_EQUALS(constWS.getSpectrum(0).getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+  }
+
+  void test_load_all() {
+    auto ws = makeWorkspace(1);
+    ws->loadLazyEventBanks();
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+    // All events stay in memory now
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), 6);
+    const EventWorkspace &constWS = *ws;
+    for (size_t i = 0; i < 6; ++i)
+      TS_ASSERT_EQUALS(constWS.getSpectrum(i).getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+  }
+
+  void test_clone_copies_all_events() {
+    auto ws = makeWorkspace(1);
+    auto clone = ws->clone();
+    TS_ASSERT(!clone->hasLazyEventBanks());
+    TS_ASSERT_EQUALS(clone->getNumberEvents(), 6);
+    TS_ASSERT_EQUALS(clone->getSpectrum(5).getTofMin(), 205.);
+    TS_ASSERT_EQUALS(m_loadCount, std::vector<int>({1, 1, 1}));
+  }
+
+  void test_bank_index_out_of_range_throws() {
+    std::vector<size_t> bankOfSpectrum{0, 3};
+    TS_ASSERT_THROWS(FakeEventBanks(bankOfSpectrum, 3, 0, m_loadCount),
+                     std::invalid_argument);
+  }
+
+private:
+  /// Workspace with 3 banks of 2 spectra each, and a spectrum without a bank
+  std::unique_ptr<EventWorkspace> makeWorkspace(const size_t maxBanks) {
+    m_loadCount.assign(3, 0);
+    auto ws = make_unique<EventWorkspace>();
+    ws->initialize(7, 2, 1);
+    std::vector<size_t> bankOfSpectrum{0, 0, 1, 1, 2, 2,
+                                       LazyEventBanks::NO_BANK};
+    ws->setLazyEventBanks(make_unique<FakeEventBanks>(
+        std::move(bankOfSpectrum), 3, maxBanks, m_loadCount));
+    return ws;
+  }
+
+  std::vector<int> m_loadCount;
+};
+
+#endif /* MANTID_DATAOBJECTS_LAZYEVENTBANKSTEST_H_ */
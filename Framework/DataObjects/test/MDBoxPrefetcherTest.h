@@ -0,0 +1,126 @@
+#ifndef MANTID_DATAOBJECTS_MDBOXPREFETCHERTEST_H_
+#define MANTID_DATAOBJECTS_MDBOXPREFETCHERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDBoxPrefetcher.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+#include "MantidTestHelpers/BoxControllerDummyIO.h"
+
+#include <boost/make_shared.hpp>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+class MDBoxPrefetcherTest : public CxxTest::TestSuite {
+  /// Records the blocks requested to be read ahead
+  class RecordingIO : public MantidTestHelpers::BoxControllerDummyIO {
+  public:
+    RecordingIO(const BoxController *bc) : BoxControllerDummyIO(bc) {}
+    void prefetchBlock(const uint64_t blockPosition,
+                       const size_t nPoints) const override {
+      prefetched.emplace_back(blockPosition, nPoints);
+    }
+    void cancelPrefetch(const uint64_t blockPosition) const override {
+      cancelled.push_back(blockPosition);
+    }
+    mutable std::vector<std::pair<uint64_t, size_t>> prefetched;
+    mutable std::vector<uint64_t> cancelled;
+  };
+
+  using Box = MDBox<MDLeanEvent<1>, 1>;
+
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDBoxPrefetcherTest *createSuite() { return new MDBoxPrefetcherTest(); }
+  static void destroySuite(MDBoxPrefetcherTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_bc = boost::make_shared<BoxController>(1);
+    m_io = new RecordingIO(m_bc.get());
+    m_io->setDataType(sizeof(Mantid::coord_t), "MDLeanEvent");
+    m_bc->setFileBacked(boost::shared_ptr<IBoxControllerIO>(m_io),
+                        "existingDummy");
+    // Five boxes of 10 events on file, the third one is in memory only
+    m_boxes.clear();
+    for (size_t i = 0; i < 5; ++i) {
+      m_boxes.emplace_back(new Box(m_bc.get()));
+      if (i != 2)
+        m_boxes.back()->setFileBacked(i * 10, 10, true);
+    }
+  }
+
+  void tearDown() override {
+    m_boxes.clear();
+    m_bc->clearFileBacked();
+  }
+
+  void test_boxes_are_read_ahead_up_to_the_maximum_number_of_events() {
+    MDBoxPrefetcher prefetcher(nodes(), 25);
+    prefetcher.advanceTo(0);
+    TS_ASSERT_EQUALS(m_io->prefetched, (Blocks{{0, 10}, {10, 10}}));
+    TS_ASSERT(m_io->cancelled.empty());
+
+    // The box in memory is skipped
+    prefetcher.advanceTo(1);
+    TS_ASSERT_EQUALS(m_io->prefetched, (Blocks{{0, 10}, {10, 10}, {30, 10}}));
+    TS_ASSERT_EQUALS(m_io->cancelled, std::vector<uint64_t>{0});
+
+    prefetcher.advanceTo(4);
+    TS_ASSERT_EQUALS(m_io->prefetched,
+                     (Blocks{{0, 10}, {10, 10}, {30, 10}, {40, 10}}));
+    TS_ASSERT_EQUALS(m_io->cancelled, (std::vector<uint64_t>{0, 10, 30}));
+  }
+
+  void test_unused_boxes_are_released_on_destruction() {
+    {
+      MDBoxPrefetcher prefetcher(nodes(), 100);
+      prefetcher.advanceTo(0);
+      TS_ASSERT_EQUALS(m_io->prefetched.size(), 4);
+    }
+    TS_ASSERT_EQUALS(m_io->cancelled, (std::vector<uint64_t>{0, 10, 30, 40}));
+  }
+
+  void test_a_box_larger_than_the_maximum_is_read_ahead_alone() {
+    MDBoxPrefetcher prefetcher(nodes(), 5);
+    prefetcher.advanceTo(0);
+    TS_ASSERT_EQUALS(m_io->prefetched, (Blocks{{0, 10}}));
+  }
+
+  void test_loaded_boxes_are_not_read_ahead() {
+    m_boxes[0]->getISaveable()->setLoaded(true);
+    MDBoxPrefetcher prefetcher(nodes(), 15);
+    prefetcher.advanceTo(0);
+    TS_ASSERT_EQUALS(m_io->prefetched, (Blocks{{10, 10}}));
+  }
+
+  void test_nothing_is_read_ahead_if_not_file_backed() {
+    m_bc->clearFileBacked();
+    m_boxes.clear();
+    auto bc = boost::make_shared<BoxController>(1);
+    Box box(bc.get());
+    std::vector<IMDNode *> boxes{&box};
+    MDBoxPrefetcher prefetcher(boxes, 100);
+    TS_ASSERT_THROWS_NOTHING(prefetcher.advanceTo(0));
+    TS_ASSERT_THROWS_NOTHING(prefetcher.advanceTo(1));
+  }
+
+private:
+  using Blocks = std::vector<std::pair<uint64_t, size_t>>;
+
+  std::vector<IMDNode *> nodes() {
+    std::vector<IMDNode *> result;
+    for (const auto &box : m_boxes)
+      result.push_back(box.get());
+    return result;
+  }
+
+  BoxController_sptr m_bc;
+  RecordingIO *m_io;
+  std::vector<std::unique_ptr<Box>> m_boxes;
+};
+
+#endif /* MANTID_DATAOBJECTS_MDBOXPREFETCHERTEST_H_ */
@@ -561,6 +561,52 @@ public:
     //#endif
   }
 
+  /** refreshCache() only sums the events added since the previous call */
+  void test_refreshCache_adds_new_events_to_cached_values() {
+    BoxController_sptr sc(new BoxController(2));
+    MDBox<MDLeanEvent<2>, 2> b(sc.get());
+    MDBox<MDLeanEvent<2>, 2> reference(sc.get());
+    for (size_t i = 0; i < 5; ++i) {
+      MDLeanEvent<2> ev(float(i + 1), float(2 * i + 1));
+      ev.setCenter(0, coord_t(i));
+      ev.setCenter(1, coord_t(10 - i));
+      b.addEvent(ev);
+      reference.addEvent(ev);
+      if (i == 2)
+        b.refreshCache();
+    }
+    b.refreshCache();
+    reference.refreshCache();
+
+    TS_ASSERT_EQUALS(b.getSignal(), reference.getSignal());
+    TS_ASSERT_EQUALS(b.getErrorSquared(), reference.getErrorSquared());
+    TS_ASSERT_EQUALS(b.getTotalWeight(), 5.0);
+    TS_ASSERT_DELTA(b.getCentroid()[0], reference.getCentroid()[0], 1e-5);
+    TS_ASSERT_DELTA(b.getCentroid()[1], reference.getCentroid()[1], 1e-5);
+  }
+
+  /** Events changed through getEvents() are all counted again */
+  void test_refreshCache_after_events_are_modified() {
+    BoxController_sptr sc(new BoxController(2));
+    MDBox<MDLeanEvent<2>, 2> b(sc.get());
+    MDLeanEvent<2> ev(1.2, 3.4);
+    b.addEvent(ev);
+    b.addEvent(ev);
+    b.refreshCache();
+    TS_ASSERT_DELTA(b.getSignal(), 2.4, 1e-5);
+
+    for (auto &event : b.getEvents())
+      event.setSignal(2.0);
+    b.releaseEvents();
+    b.addEvent(ev);
+    b.refreshCache();
+    TS_ASSERT_DELTA(b.getSignal(), 5.2, 1e-5);
+
+    b.setSignal(100.);
+    b.refreshCache();
+    TS_ASSERT_DELTA(b.getSignal(), 5.2, 1e-5);
+  }
+
   //-----------------------------------------------------------------------------------------
   void test_centroidSphere() {
     BoxController_sptr sc(new BoxController(2));
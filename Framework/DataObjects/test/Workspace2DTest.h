@@ -210,6 +210,26 @@ public:
                      nhist * (nbins + 1) * sizeof(double));
   }
 
+  void testCloneIsIndependentOfOriginal() {
+    auto original = create2DWorkspaceBinned(nhist, nbins);
+    original->getSpectrum(3).setSpectrumNo(42);
+    Workspace2D_sptr cloned(original->clone());
+    TS_ASSERT_EQUALS(cloned->getSpectrum(3).getSpectrumNo(), 42);
+    // Data is shared until one of the workspaces is modified
+    TS_ASSERT_EQUALS(&cloned->y(3), &original->y(3));
+    cloned->mutableY(3)[0] = -1.;
+    cloned->getSpectrum(3).setSpectrumNo(7);
+    TS_ASSERT_DIFFERS(original->y(3)[0], -1.);
+    TS_ASSERT_EQUALS(original->getSpectrum(3).getSpectrumNo(), 42);
+  }
+
+  void testSpectrumNumbersAfterInit() {
+    Workspace2D ws;
+    ws.initialize(3, 2, 1);
+    for (size_t i = 0; i < 3; ++i)
+      TS_ASSERT_EQUALS(ws.getSpectrum(i).getSpectrumNo(), specnum_t(i + 1));
+  }
+
   /** Refs #3003: very odd bug when getting detector in parallel only!
    * This does not reproduce it :( */
   void test_getDetector_parallel() {
@@ -322,6 +342,45 @@ public:
     std::cout << tim << " to set all detector IDs for " << nhist
               << " spectra, using the ISpectrum method (in parallel).\n";
   }
+
+  void test_read_y() {
+    double sum = 0.;
+    for (size_t i = 0; i < ws1->getNumberHistograms(); i++)
+      sum += ws1->y(i)[0];
+    TS_ASSERT_DIFFERS(sum, 0.);
+  }
+
+  void test_mutableY() {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(ws1->getNumberHistograms()); i++)
+      ws1->mutableY(i)[0] = 1.;
+  }
+
+  void test_clone() {
+    CPUTimer tim;
+    Workspace2D_sptr cloned(ws1->clone());
+    TS_ASSERT_EQUALS(cloned->getNumberHistograms(), ws1->getNumberHistograms());
+    std::cout << tim << " to clone a workspace with " << nhist
+              << " spectra.\n";
+  }
+
+  void test_create_and_destroy() {
+    CPUTimer tim;
+    {
+      Workspace2D ws;
+      ws.initialize(nhist, 6, 5);
+    }
+    std::cout << tim << " to create and destroy a workspace with " << nhist
+              << " spectra.\n";
+  }
+
+  void test_mutableX_of_shared_x() {
+    // The X of the workspace is shared, so every spectrum takes a copy
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(nhist, 5);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(ws->getNumberHistograms()); i++)
+      ws->mutableX(i)[0] = 1.;
+  }
 };
 
 #endif
@@ -252,6 +252,9 @@ public:
   makeBeamline(ParameterMap &pmap, const ParameterMap *source = nullptr) const;
 
 private:
+  /// Reads and writes the caches of the instrument directly
+  friend class InstrumentBinaryCache;
+
   /// Save information about a set of detectors to Nexus
   void saveDetectorSetInfoToNexus(::NeXus::File *file,
                                   const std::vector<detid_t> &detIDs) const;
@@ -0,0 +1,90 @@
+#ifndef MANTID_GEOMETRY_COMPACTPARAMETERMAP_H_
+#define MANTID_GEOMETRY_COMPACTPARAMETERMAP_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Instrument/Parameter.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class ComponentInfo;
+class ParameterMap;
+
+/** CompactParameterMap : An immutable snapshot of the parameters of a
+  ParameterMap for read-only queries, indexed by the component index of a
+  ComponentInfo instead of by component ID.
+
+  The parameters are stored contiguously, sorted by component index, and their
+  names are interned so that a lookup compares integers rather than strings.
+  getRecursive walks the parent indices of the ComponentInfo instead of the
+  parametrized components. Build it once, after all parameters have been added,
+  and use it for repeated lookups, e.g. one per detector. Changes to the
+  ParameterMap after construction are not seen.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL CompactParameterMap {
+public:
+  /// Index of a name that no parameter has
+  static const size_t NO_NAME;
+
+  CompactParameterMap(const ParameterMap &map,
+                      const ComponentInfo &componentInfo);
+
+  /// Number of parameters
+  size_t size() const { return m_parameters.size(); }
+  /// Number of components
+  size_t numberOfComponents() const { return m_parents.size(); }
+
+  size_t nameIndex(const std::string &name) const;
+
+  Parameter_sptr get(const size_t componentIndex, const std::string &name,
+                     const std::string &type = "") const;
+  Parameter_sptr get(const size_t componentIndex, const size_t nameIndex,
+                     const std::string &type = "") const;
+  Parameter_sptr getRecursive(const size_t componentIndex,
+                              const std::string &name,
+                              const std::string &type = "") const;
+  Parameter_sptr getRecursive(const size_t componentIndex,
+                              const size_t nameIndex,
+                              const std::string &type = "") const;
+
+private:
+  /// Interned (lower case) names, parameter names are case insensitive
+  std::unordered_map<std::string, size_t> m_nameIndices;
+  /// Parent of each component, the component itself for the root
+  std::vector<size_t> m_parents;
+  /// Start of the parameters of each component, one more than the components
+  std::vector<size_t> m_offsets;
+  /// Name index of each parameter
+  std::vector<size_t> m_names;
+  /// The parameters, sorted by component index
+  std::vector<Parameter_sptr> m_parameters;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_COMPACTPARAMETERMAP_H_ */
@@ -0,0 +1,79 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTBINARYCACHE_H_
+#define MANTID_GEOMETRY_INSTRUMENTBINARYCACHE_H_
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+class Instrument;
+class IObject;
+
+/** InstrumentBinaryCache : Stores an instrument built from an instrument
+  definition file in a binary file, and builds the same instrument again from
+  that file without parsing the XML.
+
+  The file holds the component tree with the positions, rotations and detector
+  IDs of all components, the shapes, the source, sample and chopper points,
+  the parameters defined in the definition file and the defaults of the
+  instrument. It starts with a version number and a key, normally the mangled
+  name of the definition file which includes the checksum of its contents, and
+  a file written for a different version or key is never read.
+
+  Only instruments made of the component types created by the
+  InstrumentDefinitionParser, with shapes defined in XML, can be stored.
+  Instruments with structured detectors or with a separate physical
+  instrument (indirect positions) are rejected with std::invalid_argument.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL InstrumentBinaryCache {
+public:
+  /// Shapes of the instrument by the name of the type defining them
+  using TypeShapes = std::map<std::string, boost::shared_ptr<IObject>>;
+
+  /// Version of the file layout, increase when changing it
+  static const int32_t VERSION;
+
+  explicit InstrumentBinaryCache(std::string filename);
+
+  /// The path of the cache file
+  const std::string &filename() const { return m_filename; }
+
+  void write(const Instrument &instrument, const std::string &key,
+             const TypeShapes &typeShapes) const;
+  void read(Instrument &instrument, const std::string &key,
+            TypeShapes &typeShapes) const;
+
+private:
+  std::string m_filename;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTBINARYCACHE_H_ */
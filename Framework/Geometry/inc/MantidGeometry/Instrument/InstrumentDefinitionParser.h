@@ -107,6 +107,9 @@ public:
   /// creates a vtp filename from a given xml filename
   const std::string createVTPFileName();
 
+  /// creates a binary instrument cache filename from a given xml filename
+  const std::string createInstrumentCacheFileName();
+
 private:
   /// shared Constructor logic
   void initialise(const std::string &filename, const std::string &instName,
@@ -305,6 +308,15 @@ private:
   CachingOption writeAndApplyCache(IDFObject_const_sptr firstChoiceCache,
                                    IDFObject_const_sptr fallBackCache);
 
+  /// Builds the instrument from a binary instrument cache file if available
+  bool readInstrumentCache();
+
+  /// Writes the instrument to a binary instrument cache file
+  void writeInstrumentCache();
+
+  /// Whether the binary instrument cache is enabled
+  bool useInstrumentCache() const;
+
   /// This method returns the parent appended which its child components and
   /// also name of type of the last child component
   std::string getShapeCoorSysComp(
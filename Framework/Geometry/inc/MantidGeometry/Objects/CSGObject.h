@@ -9,6 +9,7 @@
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 
 #include "BoundingBox.h"
+#include <cstdint>
 #include <map>
 #include <memory>
 
@@ -216,6 +217,9 @@ private:
   /// Calculate bounding box using object's geometric data
   void calcBoundingBoxByGeometry();
 
+  /// Find the parts of the object tracks are tested against
+  void createInterceptParts();
+
   int searchForObject(Kernel::V3D &) const;
   double getTriangleSolidAngle(const Kernel::V3D &a, const Kernel::V3D &b,
                                const Kernel::V3D &c,
@@ -280,6 +284,18 @@ private:
   /// Whether or not the object geometry is finite
   bool m_isFiniteGeometry = true;
 
+  /// A member of the union at the top of the rule tree, with a bounding box
+  /// that is null if the rule system cannot bound it
+  struct InterceptPart {
+    BoundingBox boundingBox;
+    /// Bit i is set if m_SurList[i] bounds this part; all bits are set when
+    /// there are more than 64 surfaces
+    uint64_t surfaces;
+  };
+  /// Only the surfaces of the parts whose bounding box a track crosses are
+  /// tested for intersections. Empty if every surface has to be tested.
+  std::vector<InterceptPart> m_interceptParts;
+
 protected:
   std::vector<const Surface *> m_SurList; ///< Full surfaces (make a map
   /// including complementary object ?)
@@ -8,7 +8,8 @@
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidKernel/Tolerance.h"
-#include <list>
+
+#include <boost/container/small_vector.hpp>
 
 namespace Mantid {
 //----------------------------------------------------------------------
@@ -139,13 +140,15 @@ struct IntersectionPoint {
 /**
  * Defines a track as a start point and a direction. Intersections are
  * stored as ordered lists of links from the start point to the exit point.
+ * The links and points are held in vectors with inline storage for a few
+ * elements, so that tracing a ray through simple shapes does not allocate.
  *
  * @author S. Ansell
  */
 class MANTID_GEOMETRY_DLL Track {
 public:
-  using LType = std::list<Link>;
-  using PType = std::list<IntersectionPoint>;
+  using LType = boost::container::small_vector<Link, 5>;
+  using PType = boost::container::small_vector<IntersectionPoint, 5>;
 
 public:
   /// Default constructor
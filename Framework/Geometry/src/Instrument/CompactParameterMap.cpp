@@ -0,0 +1,132 @@
+#include "MantidGeometry/Instrument/CompactParameterMap.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Geometry {
+
+const size_t CompactParameterMap::NO_NAME = std::numeric_limits<size_t>::max();
+
+/** Constructor
+ * @param map :: the parameters to copy. Parameters of components that are not
+ * part of componentInfo are left out.
+ * @param componentInfo :: the components of the instrument
+ */
+CompactParameterMap::CompactParameterMap(const ParameterMap &map,
+                                         const ComponentInfo &componentInfo)
+    : m_parents(componentInfo.size()), m_offsets(componentInfo.size() + 1, 0) {
+  for (size_t i = 0; i < m_parents.size(); ++i)
+    m_parents[i] = componentInfo.hasParent(i) ? componentInfo.parent(i) : i;
+
+  // Find the component index of each parameter and count them per component
+  std::vector<std::pair<size_t, const Parameter_sptr *>> indexed;
+  indexed.reserve(map.size());
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    size_t index;
+    try {
+      index = componentInfo.indexOf(it->first);
+    } catch (std::out_of_range &) {
+      continue;
+    }
+    indexed.emplace_back(index, &it->second);
+    ++m_offsets[index + 1];
+  }
+  for (size_t i = 1; i < m_offsets.size(); ++i)
+    m_offsets[i] += m_offsets[i - 1];
+
+  // Place the parameters by component index, interning their names
+  m_names.resize(indexed.size());
+  m_parameters.resize(indexed.size());
+  std::vector<size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+  for (const auto &item : indexed) {
+    const size_t position = next[item.first]++;
+    const auto parameter = boost::atomic_load(item.second);
+    const auto name = boost::algorithm::to_lower_copy(parameter->name());
+    m_names[position] =
+        m_nameIndices.emplace(name, m_nameIndices.size()).first->second;
+    m_parameters[position] = parameter;
+  }
+}
+
+/** @param name :: the name of a parameter, case insensitive
+ * @return the index of the name for the lookup methods, NO_NAME if no
+ * parameter has this name
+ */
+size_t CompactParameterMap::nameIndex(const std::string &name) const {
+  const auto it = m_nameIndices.find(boost::algorithm::to_lower_copy(name));
+  return it == m_nameIndices.end() ? NO_NAME : it->second;
+}
+
+/** Return a named parameter of a given type
+ * @param componentIndex :: index of the component in the ComponentInfo
+ * @param name :: parameter name
+ * @param type :: an optional type string
+ * @returns the parameter if it exists or a NULL shared pointer if not
+ */
+Parameter_sptr CompactParameterMap::get(const size_t componentIndex,
+                                        const std::string &name,
+                                        const std::string &type) const {
+  return get(componentIndex, nameIndex(name), type);
+}
+
+/** Return a named parameter of a given type
+ * @param componentIndex :: index of the component in the ComponentInfo
+ * @param nameIndex :: index of the parameter name from nameIndex()
+ * @param type :: an optional type string
+ * @returns the parameter if it exists or a NULL shared pointer if not
+ */
+Parameter_sptr CompactParameterMap::get(const size_t componentIndex,
+                                        const size_t nameIndex,
+                                        const std::string &type) const {
+  if (nameIndex == NO_NAME)
+    return Parameter_sptr();
+  for (size_t i = m_offsets[componentIndex]; i < m_offsets[componentIndex + 1];
+       ++i) {
+    if (m_names[i] == nameIndex &&
+        (type.empty() || m_parameters[i]->type() == type))
+      return m_parameters[i];
+  }
+  return Parameter_sptr();
+}
+
+/** Find a parameter by name, going up the component tree to higher parents
+ * @param componentIndex :: index of the component to start the search with
+ * @param name :: parameter name
+ * @param type :: an optional type string
+ * @returns the first matching parameter
+ */
+Parameter_sptr CompactParameterMap::getRecursive(
+    const size_t componentIndex, const std::string &name,
+    const std::string &type) const {
+  return getRecursive(componentIndex, nameIndex(name), type);
+}
+
+/** Find a parameter by name, going up the component tree to higher parents
+ * @param componentIndex :: index of the component to start the search with
+ * @param nameIndex :: index of the parameter name from nameIndex()
+ * @param type :: an optional type string
+ * @returns the first matching parameter
+ */
+Parameter_sptr CompactParameterMap::getRecursive(
+    const size_t componentIndex, const size_t nameIndex,
+    const std::string &type) const {
+  if (nameIndex == NO_NAME)
+    return Parameter_sptr();
+  size_t index = componentIndex;
+  while (true) {
+    if (auto parameter = get(index, nameIndex, type))
+      return parameter;
+    const size_t parent = m_parents[index];
+    if (parent == index)
+      return Parameter_sptr();
+    index = parent;
+  }
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -0,0 +1,687 @@
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/BinaryStreamReader.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+#include "MantidKernel/Interpolation.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/TemporaryFile.h>
+
+#include <boost/make_shared.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <typeinfo>
+#include <unordered_map>
+
+using Mantid::Kernel::BinaryStreamReader;
+using Mantid::Kernel::BinaryStreamWriter;
+using Mantid::Kernel::Quat;
+using Mantid::Kernel::V3D;
+
+namespace Mantid {
+namespace Geometry {
+
+const int32_t InstrumentBinaryCache::VERSION = 1;
+
+namespace {
+/// Marks the start and the end of a cache file
+const std::string MAGIC("MantidInstrumentBinaryCache");
+/// Written as a whole to detect files written with a different byte order
+const int32_t BYTE_ORDER_MARK = 0x01020304;
+/// Index of a component or shape that does not exist
+const int32_t NO_INDEX = -1;
+
+/// The classes of components that can be stored
+enum class ComponentKind : int32_t {
+  Instrument = 0,
+  CompAssembly = 1,
+  ObjCompAssembly = 2,
+  ObjComponent = 3,
+  Detector = 4,
+  RectangularDetector = 5
+};
+
+/// How a detector is registered with the instrument
+enum class Registration : int32_t { None = 0, Detector = 1, Monitor = 2 };
+
+/// @return the kind of the exact class of a component
+ComponentKind kindOf(const IComponent &component) {
+  const auto &type = typeid(component);
+  if (type == typeid(Instrument))
+    return ComponentKind::Instrument;
+  if (type == typeid(CompAssembly))
+    return ComponentKind::CompAssembly;
+  if (type == typeid(ObjCompAssembly))
+    return ComponentKind::ObjCompAssembly;
+  if (type == typeid(ObjComponent))
+    return ComponentKind::ObjComponent;
+  if (type == typeid(Detector))
+    return ComponentKind::Detector;
+  if (type == typeid(RectangularDetector))
+    return ComponentKind::RectangularDetector;
+  throw std::invalid_argument("InstrumentBinaryCache: cannot store components "
+                              "of type " +
+                              component.type());
+}
+
+bool isAssembly(const ComponentKind kind) {
+  return kind == ComponentKind::Instrument ||
+         kind == ComponentKind::CompAssembly ||
+         kind == ComponentKind::ObjCompAssembly ||
+         kind == ComponentKind::RectangularDetector;
+}
+
+void writeV3D(BinaryStreamWriter &out, const V3D &value) {
+  out << value.X() << value.Y() << value.Z();
+}
+
+V3D readV3D(BinaryStreamReader &in) {
+  double x, y, z;
+  in >> x >> y >> z;
+  return V3D(x, y, z);
+}
+
+void writeQuat(BinaryStreamWriter &out, const Quat &value) {
+  out << value.real() << value.imagI() << value.imagJ() << value.imagK();
+}
+
+Quat readQuat(BinaryStreamReader &in) {
+  double w, a, b, c;
+  in >> w >> a >> b >> c;
+  return Quat(w, a, b, c);
+}
+
+int32_t readInt(BinaryStreamReader &in) {
+  int32_t value;
+  in >> value;
+  return value;
+}
+
+/// Read the number of items that follow, which cannot be negative
+size_t readCount(BinaryStreamReader &in) {
+  const auto count = readInt(in);
+  if (count < 0)
+    throw std::runtime_error("InstrumentBinaryCache: invalid number of items");
+  return static_cast<size_t>(count);
+}
+
+std::string readString(BinaryStreamReader &in) {
+  std::string value;
+  in >> value;
+  return value;
+}
+
+/// @return the axis a unit vector along one of the axes points along
+PointingAlong axisOf(const V3D &direction) {
+  if (direction.X() != 0.)
+    return X;
+  if (direction.Y() != 0.)
+    return Y;
+  return Z;
+}
+
+/// Collects the components and shapes of an instrument in the order they are
+/// written
+class InstrumentContents {
+public:
+  explicit InstrumentContents(const Instrument &instrument) {
+    addComponent(instrument);
+  }
+
+  int32_t componentIndex(const IComponent *component) const {
+    if (!component)
+      return NO_INDEX;
+    const auto it = m_componentIndices.find(component);
+    if (it == m_componentIndices.end())
+      throw std::invalid_argument("InstrumentBinaryCache: the instrument "
+                                  "refers to a component outside of its tree");
+    return it->second;
+  }
+
+  int32_t shapeIndex(const boost::shared_ptr<const IObject> &shape) {
+    if (!shape)
+      return NO_INDEX;
+    const auto it = m_shapeIndices.find(shape.get());
+    if (it != m_shapeIndices.end())
+      return it->second;
+    const auto csgShape = dynamic_cast<const CSGObject *>(shape.get());
+    if (!csgShape)
+      throw std::invalid_argument(
+          "InstrumentBinaryCache: only shapes defined in XML can be stored");
+    const auto index = static_cast<int32_t>(m_shapes.size());
+    m_shapes.push_back(csgShape);
+    m_shapeIndices.emplace(shape.get(), index);
+    return index;
+  }
+
+  const std::vector<const IComponent *> &components() const {
+    return m_components;
+  }
+  const std::vector<const CSGObject *> &shapes() const { return m_shapes; }
+
+private:
+  void addComponent(const IComponent &component) {
+    const auto kind = kindOf(component);
+    m_componentIndices.emplace(&component,
+                               static_cast<int32_t>(m_components.size()));
+    m_components.push_back(&component);
+    switch (kind) {
+    case ComponentKind::ObjCompAssembly:
+    case ComponentKind::ObjComponent:
+    case ComponentKind::Detector:
+    case ComponentKind::RectangularDetector:
+      shapeIndex(dynamic_cast<const IObjComponent &>(component).shape());
+      break;
+    default:
+      break;
+    }
+    if (isAssembly(kind)) {
+      const auto &assembly = dynamic_cast<const ICompAssembly &>(component);
+      for (int i = 0; i < assembly.nelements(); ++i)
+        addComponent(*assembly.getChild(i));
+    }
+  }
+
+  std::vector<const IComponent *> m_components;
+  std::unordered_map<const IComponent *, int32_t> m_componentIndices;
+  std::vector<const CSGObject *> m_shapes;
+  std::unordered_map<const IObject *, int32_t> m_shapeIndices;
+};
+
+/// Writes one component without its children
+void writeComponent(BinaryStreamWriter &out, const IComponent &component,
+                    InstrumentContents &contents,
+                    const std::unordered_map<const IComponent *, Registration>
+                        &registrations) {
+  const auto kind = kindOf(component);
+  out << static_cast<int32_t>(kind) << component.getName();
+  writeV3D(out, component.getRelativePos());
+  writeQuat(out, component.getRelativeRot());
+  switch (kind) {
+  case ComponentKind::ObjCompAssembly:
+  case ComponentKind::ObjComponent:
+    out << contents.shapeIndex(
+        dynamic_cast<const IObjComponent &>(component).shape());
+    break;
+  case ComponentKind::Detector: {
+    const auto &detector = dynamic_cast<const Detector &>(component);
+    const auto it = registrations.find(&component);
+    const auto registration =
+        it == registrations.end() ? Registration::None : it->second;
+    out << contents.shapeIndex(detector.shape())
+        << static_cast<int32_t>(detector.getID())
+        << static_cast<int32_t>(registration);
+    break;
+  }
+  case ComponentKind::RectangularDetector: {
+    const auto &bank = dynamic_cast<const RectangularDetector &>(component);
+    out << contents.shapeIndex(bank.shape())
+        << static_cast<int32_t>(bank.xpixels()) << bank.xstart()
+        << bank.xstep() << static_cast<int32_t>(bank.ypixels())
+        << bank.ystart() << bank.ystep()
+        << static_cast<int32_t>(bank.idstart())
+        << static_cast<int32_t>(bank.idfillbyfirst_y())
+        << static_cast<int32_t>(bank.idstepbyrow())
+        << static_cast<int32_t>(bank.idstep());
+    break;
+  }
+  default:
+    break;
+  }
+  if (isAssembly(kind))
+    out << static_cast<int32_t>(
+        dynamic_cast<const ICompAssembly &>(component).nelements());
+}
+
+void writeParameter(BinaryStreamWriter &out,
+                    const XMLInstrumentParameter &parameter,
+                    const InstrumentContents &contents) {
+  out << parameter.m_logfileID << parameter.m_value << parameter.m_paramName
+      << parameter.m_type << parameter.m_tie
+      << static_cast<int32_t>(parameter.m_constraint.size());
+  for (const auto &constraint : parameter.m_constraint)
+    out << constraint;
+  out << parameter.m_penaltyFactor << parameter.m_fittingFunction
+      << parameter.m_formula << parameter.m_formulaUnit
+      << parameter.m_resultUnit;
+  if (parameter.m_interpolation) {
+    std::ostringstream interpolation;
+    interpolation.precision(17);
+    parameter.m_interpolation->printSelf(interpolation);
+    out << int32_t(1) << interpolation.str();
+  } else {
+    out << int32_t(0);
+  }
+  out << parameter.m_extractSingleValueAs << parameter.m_eq
+      << contents.componentIndex(parameter.m_component)
+      << parameter.m_angleConvertConst << parameter.m_description;
+}
+
+boost::shared_ptr<XMLInstrumentParameter>
+readParameter(BinaryStreamReader &in,
+              const std::vector<IComponent *> &components) {
+  const auto logfileID = readString(in);
+  const auto value = readString(in);
+  const auto paramName = readString(in);
+  const auto type = readString(in);
+  const auto tie = readString(in);
+  std::vector<std::string> constraint(readCount(in));
+  for (auto &item : constraint)
+    in >> item;
+  auto penaltyFactor = readString(in);
+  const auto fittingFunction = readString(in);
+  const auto formula = readString(in);
+  const auto formulaUnit = readString(in);
+  const auto resultUnit = readString(in);
+  boost::shared_ptr<Kernel::Interpolation> interpolation;
+  if (readInt(in) != 0) {
+    interpolation = boost::make_shared<Kernel::Interpolation>();
+    std::istringstream stream(readString(in));
+    stream >> *interpolation;
+  }
+  const auto extractSingleValueAs = readString(in);
+  const auto eq = readString(in);
+  const auto componentIndex = readInt(in);
+  if (componentIndex >= static_cast<int32_t>(components.size()))
+    throw std::runtime_error("InstrumentBinaryCache: invalid component index");
+  const IComponent *component =
+      componentIndex == NO_INDEX ? nullptr : components[componentIndex];
+  double angleConvertConst;
+  in >> angleConvertConst;
+  const auto description = readString(in);
+  return boost::make_shared<XMLInstrumentParameter>(
+      logfileID, value, interpolation, formula, formulaUnit, resultUnit,
+      paramName, type, tie, constraint, penaltyFactor, fittingFunction,
+      extractSingleValueAs, eq, component, angleConvertConst, description);
+}
+
+/// Rebuilds the component tree of an instrument
+class ComponentReader {
+public:
+  ComponentReader(std::istream &stream, BinaryStreamReader &in,
+                  const std::vector<boost::shared_ptr<CSGObject>> &shapes)
+      : m_stream(stream), m_in(in), m_shapes(shapes) {}
+
+  void readTree(Instrument &instrument) { read(nullptr, &instrument); }
+
+  const std::vector<IComponent *> &components() const { return m_components; }
+  const std::vector<const IDetector *> &detectors() const {
+    return m_detectors;
+  }
+  const std::vector<const IDetector *> &monitors() const { return m_monitors; }
+
+private:
+  boost::shared_ptr<CSGObject> readShape() {
+    const auto index = readInt(m_in);
+    if (index == NO_INDEX)
+      return nullptr;
+    if (index < 0 || index >= static_cast<int32_t>(m_shapes.size()))
+      throw std::runtime_error("InstrumentBinaryCache: invalid shape index");
+    return m_shapes[index];
+  }
+
+  /** Read a component and its children.
+   * @param parent :: the assembly to add a new component to
+   * @param existing :: the component if it was already created by its parent,
+   * as for the pixels of a RectangularDetector, otherwise null
+   */
+  void read(ICompAssembly *parent, IComponent *existing) {
+    const auto kind = static_cast<ComponentKind>(readInt(m_in));
+    const auto name = readString(m_in);
+    const auto pos = readV3D(m_in);
+    const auto rot = readQuat(m_in);
+    if (!m_stream)
+      throw std::runtime_error("InstrumentBinaryCache: unexpected end of file");
+
+    IComponent *component = existing;
+    bool childrenExist = existing != nullptr;
+    switch (kind) {
+    case ComponentKind::Instrument:
+      if (!existing || parent)
+        throw std::runtime_error(
+            "InstrumentBinaryCache: misplaced instrument component");
+      break;
+    case ComponentKind::CompAssembly:
+      if (!existing)
+        component = new CompAssembly(name, parent);
+      break;
+    case ComponentKind::ObjCompAssembly: {
+      const auto outline = readShape();
+      if (!existing) {
+        auto assembly = new ObjCompAssembly(name, parent);
+        if (outline)
+          assembly->setOutline(outline);
+        component = assembly;
+      }
+      break;
+    }
+    case ComponentKind::ObjComponent: {
+      const auto shape = readShape();
+      if (!existing) {
+        component = new ObjComponent(name, shape, parent);
+        parent->add(component);
+      }
+      break;
+    }
+    case ComponentKind::Detector: {
+      const auto shape = readShape();
+      const auto id = readInt(m_in);
+      const auto registration = static_cast<Registration>(readInt(m_in));
+      Detector *detector;
+      if (existing) {
+        detector = dynamic_cast<Detector *>(existing);
+        if (!detector || detector->getID() != id)
+          throw std::runtime_error(
+              "InstrumentBinaryCache: detector does not match");
+      } else {
+        detector = new Detector(name, id, shape, parent);
+        parent->add(detector);
+        component = detector;
+      }
+      if (registration == Registration::Detector)
+        m_detectors.push_back(detector);
+      else if (registration == Registration::Monitor)
+        m_monitors.push_back(detector);
+      break;
+    }
+    case ComponentKind::RectangularDetector: {
+      const auto shape = readShape();
+      int32_t xpixels, ypixels, idstart, idfillbyfirst_y, idstepbyrow, idstep;
+      double xstart, xstep, ystart, ystep;
+      m_in >> xpixels >> xstart >> xstep >> ypixels >> ystart >> ystep >>
+          idstart >> idfillbyfirst_y >> idstepbyrow >> idstep;
+      if (existing)
+        throw std::runtime_error(
+            "InstrumentBinaryCache: misplaced RectangularDetector");
+      auto bank = new RectangularDetector(name, parent);
+      bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep,
+                       idstart, idfillbyfirst_y != 0, idstepbyrow, idstep);
+      component = bank;
+      childrenExist = true;
+      break;
+    }
+    default:
+      throw std::runtime_error("InstrumentBinaryCache: unknown component kind");
+    }
+    if (existing &&
+        (kindOf(*existing) != kind || existing->getName() != name))
+      throw std::runtime_error(
+          "InstrumentBinaryCache: component does not match");
+    component->setPos(pos);
+    component->setRot(rot);
+    m_components.push_back(component);
+
+    if (!isAssembly(kind))
+      return;
+    const auto numberOfChildren = static_cast<int>(readCount(m_in));
+    auto assembly = dynamic_cast<ICompAssembly *>(component);
+    if (childrenExist && assembly->nelements() != numberOfChildren)
+      throw std::runtime_error(
+          "InstrumentBinaryCache: number of children does not match");
+    for (int i = 0; i < numberOfChildren; ++i)
+      read(assembly, childrenExist ? assembly->getChild(i).get() : nullptr);
+  }
+
+  std::istream &m_stream;
+  BinaryStreamReader &m_in;
+  const std::vector<boost::shared_ptr<CSGObject>> &m_shapes;
+  std::vector<IComponent *> m_components;
+  std::vector<const IDetector *> m_detectors;
+  std::vector<const IDetector *> m_monitors;
+};
+} // namespace
+
+/** Constructor
+ * @param filename :: path of the cache file
+ */
+InstrumentBinaryCache::InstrumentBinaryCache(std::string filename)
+    : m_filename(std::move(filename)) {}
+
+/** Write an instrument to the cache file. The file is written under a
+ * temporary name first and then renamed, so that a reader never sees a
+ * partially written file.
+ * @param instrument :: the (unparametrized) instrument to store
+ * @param key :: identifies the definition the instrument was built from
+ * @param typeShapes :: the shapes by the name of the type defining them
+ * @throw std::invalid_argument if the instrument cannot be stored
+ * @throw std::runtime_error if writing the file fails
+ */
+void InstrumentBinaryCache::write(const Instrument &instrument,
+                                  const std::string &key,
+                                  const TypeShapes &typeShapes) const {
+  if (instrument.isParametrized())
+    throw std::invalid_argument(
+        "InstrumentBinaryCache: cannot store a parametrized instrument");
+  if (instrument.getPhysicalInstrument())
+    throw std::invalid_argument("InstrumentBinaryCache: cannot store an "
+                                "instrument with a physical instrument");
+
+  // Collect everything first, so that an instrument that cannot be stored
+  // does not leave a file behind
+  InstrumentContents contents(instrument);
+  std::vector<std::pair<std::string, int32_t>> typeShapeIndices;
+  for (const auto &typeShape : typeShapes)
+    typeShapeIndices.emplace_back(typeShape.first,
+                                  contents.shapeIndex(typeShape.second));
+  std::unordered_map<const IComponent *, Registration> registrations;
+  for (const auto &item : instrument.m_detectorCache)
+    registrations.emplace(std::get<1>(item).get(),
+                          std::get<2>(item) ? Registration::Monitor
+                                            : Registration::Detector);
+  const auto sourceIndex = contents.componentIndex(instrument.m_sourceCache);
+  const auto sampleIndex = contents.componentIndex(instrument.m_sampleCache);
+  std::vector<int32_t> chopperIndices;
+  for (const auto chopper : *instrument.m_chopperPoints)
+    chopperIndices.push_back(contents.componentIndex(chopper));
+  const auto &logfileCache = instrument.getLogfileCache();
+  for (const auto &item : logfileCache)
+    contents.componentIndex(item.first.second);
+
+  const std::string tempFilename = Poco::TemporaryFile::tempName(
+      Poco::Path(m_filename).parent().toString());
+  try {
+    std::ofstream file(tempFilename, std::ios::binary | std::ios::trunc);
+    if (!file)
+      throw std::runtime_error("InstrumentBinaryCache: cannot open " +
+                               tempFilename + " for writing");
+    BinaryStreamWriter out(file);
+    out << MAGIC << VERSION << BYTE_ORDER_MARK << key;
+
+    // Defaults of the instrument
+    out << instrument.getValidFromDate().totalNanoseconds()
+        << instrument.getValidToDate().totalNanoseconds()
+        << instrument.getDefaultView() << instrument.getDefaultAxis();
+    const auto frame = instrument.getReferenceFrame();
+    out << static_cast<int32_t>(frame->pointingUp())
+        << static_cast<int32_t>(frame->pointingAlongBeam())
+        << static_cast<int32_t>(axisOf(frame->vecThetaSign()))
+        << static_cast<int32_t>(frame->getHandedness()) << frame->origin();
+    const auto &logfileUnit = instrument.m_logfileUnit;
+    out << static_cast<int32_t>(logfileUnit.size());
+    for (const auto &unit : logfileUnit)
+      out << unit.first << unit.second;
+
+    // Shapes
+    const auto &shapes = contents.shapes();
+    out << static_cast<int32_t>(shapes.size());
+    for (const auto shape : shapes)
+      out << static_cast<int32_t>(shape->getName()) << shape->getShapeXML();
+    out << static_cast<int32_t>(typeShapeIndices.size());
+    for (const auto &typeShape : typeShapeIndices)
+      out << typeShape.first << typeShape.second;
+
+    // Components, depth first in the order of the children
+    const auto &components = contents.components();
+    out << static_cast<int32_t>(components.size());
+    for (const auto component : components)
+      writeComponent(out, *component, contents, registrations);
+    out << sourceIndex << sampleIndex
+        << static_cast<int32_t>(chopperIndices.size());
+    for (const auto index : chopperIndices)
+      out << index;
+
+    // Parameters from the definition
+    out << static_cast<int32_t>(logfileCache.size());
+    for (const auto &item : logfileCache) {
+      out << item.first.first << contents.componentIndex(item.first.second);
+      writeParameter(out, *item.second, contents);
+    }
+    out << MAGIC;
+    file.close();
+    if (!file)
+      throw std::runtime_error("InstrumentBinaryCache: error writing " +
+                               tempFilename);
+    Poco::File(tempFilename).renameTo(m_filename);
+  } catch (...) {
+    Poco::File temp(tempFilename);
+    if (temp.exists())
+      temp.remove();
+    throw;
+  }
+}
+
+/** Build an instrument from the cache file.
+ * @param instrument :: a new, empty instrument to add the components to. Its
+ * name, filename and XML text are not changed.
+ * @param key :: identifies the definition the instrument should be built from
+ * @param typeShapes :: filled with the shapes by the name of the type defining
+ * them
+ * @throw std::runtime_error if the file cannot be read, was written by a
+ * different version or for a different key
+ */
+void InstrumentBinaryCache::read(Instrument &instrument,
+                                 const std::string &key,
+                                 TypeShapes &typeShapes) const {
+  if (instrument.nelements() > 0)
+    throw std::invalid_argument(
+        "InstrumentBinaryCache: the instrument must be empty");
+  std::ifstream file(m_filename, std::ios::binary);
+  if (!file)
+    throw std::runtime_error("InstrumentBinaryCache: cannot open " +
+                             m_filename);
+  BinaryStreamReader in(file);
+  const auto magic = readString(in);
+  const auto version = readInt(in);
+  const auto byteOrder = readInt(in);
+  if (!file || magic != MAGIC || version != VERSION ||
+      byteOrder != BYTE_ORDER_MARK)
+    throw std::runtime_error("InstrumentBinaryCache: " + m_filename +
+                             " was written by a different version");
+  if (readString(in) != key)
+    throw std::runtime_error("InstrumentBinaryCache: " + m_filename +
+                             " was written for a different definition");
+
+  // Defaults of the instrument
+  int64_t validFrom, validTo;
+  in >> validFrom >> validTo;
+  const auto defaultView = readString(in);
+  const auto defaultAxis = readString(in);
+  const auto up = static_cast<PointingAlong>(readInt(in));
+  const auto alongBeam = static_cast<PointingAlong>(readInt(in));
+  const auto thetaSign = static_cast<PointingAlong>(readInt(in));
+  const auto handedness = static_cast<Handedness>(readInt(in));
+  const auto origin = readString(in);
+  std::map<std::string, std::string> logfileUnit;
+  const auto numberOfUnits = readCount(in);
+  for (size_t i = 0; i < numberOfUnits; ++i) {
+    const auto name = readString(in);
+    logfileUnit[name] = readString(in);
+  }
+
+  // Shapes
+  ShapeFactory shapeFactory;
+  std::vector<boost::shared_ptr<CSGObject>> shapes(readCount(in));
+  for (auto &shape : shapes) {
+    const auto name = readInt(in);
+    const auto shapeXML = readString(in);
+    shape = shapeXML.empty() ? boost::make_shared<CSGObject>()
+                             : shapeFactory.createShape(shapeXML, false);
+    shape->setName(name);
+  }
+  TypeShapes readTypeShapes;
+  const auto numberOfTypeShapes = readCount(in);
+  for (size_t i = 0; i < numberOfTypeShapes; ++i) {
+    const auto typeName = readString(in);
+    const auto index = readInt(in);
+    if (index < 0 || index >= static_cast<int32_t>(shapes.size()))
+      throw std::runtime_error("InstrumentBinaryCache: invalid shape index");
+    readTypeShapes[typeName] = shapes[index];
+  }
+  if (!file)
+    throw std::runtime_error("InstrumentBinaryCache: unexpected end of " +
+                             m_filename);
+
+  // Components
+  const auto numberOfComponents = readCount(in);
+  ComponentReader reader(file, in, shapes);
+  reader.readTree(instrument);
+  const auto &components = reader.components();
+  if (!file || components.size() != numberOfComponents)
+    throw std::runtime_error("InstrumentBinaryCache: corrupt component tree "
+                             "in " +
+                             m_filename);
+  const auto component = [&components](const int32_t index) {
+    if (index < NO_INDEX || index >= static_cast<int32_t>(components.size()))
+      throw std::runtime_error("InstrumentBinaryCache: invalid component "
+                               "index");
+    return index == NO_INDEX ? nullptr : components[index];
+  };
+  const auto sourceIndex = readInt(in);
+  const auto sampleIndex = readInt(in);
+  std::vector<int32_t> chopperIndices(readCount(in));
+  for (auto &index : chopperIndices)
+    in >> index;
+
+  // Parameters from the definition
+  InstrumentParameterCache logfileCache;
+  const auto numberOfParameters = readCount(in);
+  for (size_t i = 0; i < numberOfParameters; ++i) {
+    const auto name = readString(in);
+    const IComponent *paramComponent = component(readInt(in));
+    logfileCache[std::make_pair(name, paramComponent)] =
+        readParameter(in, components);
+  }
+  if (!file || readString(in) != MAGIC)
+    throw std::runtime_error("InstrumentBinaryCache: unexpected end of " +
+                             m_filename);
+
+  // Everything was read, now set up the instrument
+  instrument.setValidFromDate(Types::Core::DateAndTime(validFrom));
+  instrument.setValidToDate(Types::Core::DateAndTime(validTo));
+  instrument.setDefaultView(defaultView);
+  instrument.setDefaultViewAxis(defaultAxis);
+  instrument.setReferenceFrame(boost::make_shared<ReferenceFrame>(
+      up, alongBeam, thetaSign, handedness, origin));
+  instrument.getLogfileUnit() = std::move(logfileUnit);
+  instrument.getLogfileCache() = std::move(logfileCache);
+  for (const auto detector : reader.detectors())
+    instrument.markAsDetectorIncomplete(detector);
+  instrument.markAsDetectorFinalize();
+  for (const auto monitor : reader.monitors())
+    instrument.markAsMonitor(monitor);
+  if (const auto source = component(sourceIndex))
+    instrument.markAsSource(source);
+  if (const auto sample = component(sampleIndex))
+    instrument.markAsSamplePos(sample);
+  for (const auto index : chopperIndices) {
+    const auto chopper = dynamic_cast<const ObjComponent *>(component(index));
+    if (!chopper)
+      throw std::runtime_error("InstrumentBinaryCache: chopper point is not "
+                               "an ObjComponent");
+    instrument.markAsChopperPoint(chopper);
+  }
+  typeShapes = std::move(readTypeShapes);
+}
+
+} // namespace Geometry
+} // namespace Mantid
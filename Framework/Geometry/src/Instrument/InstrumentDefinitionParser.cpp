@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidGeometry/Instrument/ObjCompAssembly.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -222,6 +223,13 @@ void InstrumentDefinitionParser::throwIfTypeNameNotUnique(
  */
 Instrument_sptr
 InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
+  // An instrument built from the same XML before can be read from the binary
+  // instrument cache instead. The shapes still use the geometry cache.
+  if (readInstrumentCache()) {
+    m_cachingOption = setupGeometryCache();
+    return m_instrument;
+  }
+
   auto pDoc = getDocument();
 
   // Get pointer to root element
@@ -279,6 +287,8 @@ InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
   // (which does the final sorting).
   m_instrument->markAsDetectorFinalize();
 
+  writeInstrumentCache();
+
   // And give back what we created
   return m_instrument;
 }
@@ -2549,6 +2559,93 @@ InstrumentDefinitionParser::setupGeometryCache() {
   return cachingOption;
 }
 
+/** Whether the binary instrument cache is enabled, controlled by the
+ * instrumentDefinition.binaryCache property.
+ * @return true if instruments should be read from and written to the cache
+ */
+bool InstrumentDefinitionParser::useInstrumentCache() const {
+  return ConfigService::Instance()
+      .getValue<bool>("instrumentDefinition.binaryCache")
+      .get_value_or(true);
+}
+
+/** Builds the instrument from a binary instrument cache file written for the
+ * same XML contents, looking first next to the geometry cache files and then
+ * in the temporary directory. A cache file that cannot be read is ignored and
+ * the instrument is then parsed from the XML as usual.
+ * @return true if the instrument and its shapes were read from a cache file
+ */
+bool InstrumentDefinitionParser::readInstrumentCache() {
+  if (!useInstrumentCache())
+    return false;
+  const std::string key = getMangledName();
+  if (key.empty())
+    return false;
+
+  const std::vector<std::string> cacheFiles{
+      createInstrumentCacheFileName(),
+      Poco::Path(ConfigService::Instance().getTempDir())
+          .append(key + ".instrument")
+          .toString()};
+  for (const auto &cacheFile : cacheFiles) {
+    try {
+      if (!Poco::File(cacheFile).exists())
+        continue;
+      InstrumentBinaryCache(cacheFile).read(*m_instrument, key,
+                                            mapTypeNameToShape);
+      g_log.information("Loaded instrument from cache " + cacheFile);
+      return true;
+    } catch (std::exception &exc) {
+      g_log.warning() << "Unable to read instrument cache " << cacheFile
+                      << ": " << exc.what() << "\n";
+    } catch (Poco::Exception &exc) {
+      g_log.warning() << "Unable to read instrument cache " << cacheFile
+                      << ": " << exc.displayText() << "\n";
+    }
+    // Start again from an empty instrument
+    auto instrument = boost::make_shared<Instrument>(m_instName);
+    instrument->setFilename(m_instrument->getFilename());
+    instrument->setXmlText(m_instrument->getXmlText());
+    m_instrument = instrument;
+    mapTypeNameToShape.clear();
+  }
+  return false;
+}
+
+/** Writes the instrument just parsed to a binary instrument cache file next
+ * to the geometry cache files, or to the temporary directory if that is not
+ * writable. Instruments that cannot be stored are simply not cached.
+ */
+void InstrumentDefinitionParser::writeInstrumentCache() {
+  if (!useInstrumentCache())
+    return;
+  const std::string key = getMangledName();
+  if (key.empty())
+    return;
+
+  std::string cacheFile = createInstrumentCacheFileName();
+  try {
+    Poco::File dir(Poco::Path(cacheFile).parent());
+    if (dir.path().empty() || !dir.exists() || !dir.canWrite()) {
+      cacheFile = Poco::Path(ConfigService::Instance().getTempDir())
+                      .append(key + ".instrument")
+                      .toString();
+    }
+    InstrumentBinaryCache(cacheFile).write(*m_instrument, key,
+                                           mapTypeNameToShape);
+    g_log.information("Created instrument cache " + cacheFile);
+  } catch (std::invalid_argument &exc) {
+    g_log.information() << "Instrument " << m_instName
+                        << " cannot be cached: " << exc.what() << "\n";
+  } catch (std::exception &exc) {
+    g_log.warning() << "Unable to write instrument cache " << cacheFile << ": "
+                    << exc.what() << "\n";
+  } catch (Poco::Exception &exc) {
+    g_log.warning() << "Unable to write instrument cache " << cacheFile << ": "
+                    << exc.displayText() << "\n";
+  }
+}
+
 /**
 Getter for the applied caching option.
 @return selected caching.
@@ -2981,6 +3078,24 @@ const std::string InstrumentDefinitionParser::createVTPFileName() {
   return retVal;
 }
 
+/** Generates a binary instrument cache filename from a xml filename. The
+ * cache files are kept with the vtp files.
+ *
+ *  @return The instrument cache filename
+ *
+ */
+const std::string InstrumentDefinitionParser::createInstrumentCacheFileName() {
+  std::string retVal;
+  std::string filename = getMangledName();
+  if (!filename.empty()) {
+    Poco::Path path(ConfigService::Instance().getVTPFileDirectory());
+    path.makeDirectory();
+    path.append(filename + ".instrument");
+    retVal = path.toString();
+  }
+  return retVal;
+}
+
 /** Return a subelement of an XML element, but also checks that there exist
  *exactly one entry
  *  of this subelement.
@@ -141,6 +141,7 @@ int CSGObject::setObject(const int ON, const std::string &Ln) {
   if (procString(Ln)) // this currently does not fail:
   {
     m_SurList.clear();
+    m_interceptParts.clear();
     ObjNum = ON;
     return 1;
   }
@@ -233,6 +234,7 @@ int CSGObject::complementaryObject(const int Cnum, std::string &Ln) {
   ObjNum = Cnum;
   if (procString(Part)) {
     m_SurList.clear();
+    m_interceptParts.clear();
     Ln.erase(posA - 1, posB + 1); // Delete brackets ( Part ) .
     std::ostringstream CompCell;
     CompCell << Cnum << " ";
@@ -519,9 +521,92 @@ int CSGObject::createSurfaceList(const int outFlag) {
       std::cerr << (*vc)->getName() << '\n';
     }
   }
+  createInterceptParts();
   return 1;
 }
 
+/**
+ * Splits the object into the members of the union at the top of the rule
+ * tree and records the bounding box and surfaces of each. A track that misses
+ * the bounding box of a member cannot cross any of its surfaces, so those
+ * surfaces need not be tested by interceptSurface.
+ */
+void CSGObject::createInterceptParts() {
+  m_interceptParts.clear();
+  if (!TopRule ||
+      std::find(m_SurList.cbegin(), m_SurList.cend(), nullptr) !=
+          m_SurList.cend())
+    return;
+
+  std::vector<Rule *> members;
+  std::stack<Rule *> unions;
+  unions.push(TopRule.get());
+  while (!unions.empty()) {
+    Rule *rule = unions.top();
+    unions.pop();
+    if (dynamic_cast<const Union *>(rule)) {
+      unions.push(rule->leaf(1));
+      unions.push(rule->leaf(0));
+    } else if (rule) {
+      members.push_back(rule);
+    }
+  }
+
+  const double huge(1e10);
+  const double big(1e4);
+  bool anyBounded(false);
+  for (auto member : members) {
+    InterceptPart part{BoundingBox(), 0};
+    std::stack<const Rule *> treeLine;
+    treeLine.push(member);
+    while (!treeLine.empty()) {
+      const Rule *rule = treeLine.top();
+      treeLine.pop();
+      const Rule *leafA = rule->leaf(0);
+      const Rule *leafB = rule->leaf(1);
+      if (leafA || leafB) {
+        if (leafA)
+          treeLine.push(leafA);
+        if (leafB)
+          treeLine.push(leafB);
+      } else if (auto surfPoint = dynamic_cast<const SurfPoint *>(rule)) {
+        const auto index = std::distance(
+            m_SurList.cbegin(), std::lower_bound(m_SurList.cbegin(),
+                                                 m_SurList.cend(),
+                                                 surfPoint->getKey()));
+        part.surfaces |= index < 64 ? uint64_t(1) << index : ~uint64_t(0);
+      }
+    }
+    double minX(-huge), minY(-huge), minZ(-huge);
+    double maxX(huge), maxY(huge), maxZ(huge);
+    member->getBoundingBox(maxX, maxY, maxZ, minX, minY, minZ);
+    if (minX > -big && maxX < big && minY > -big && maxY < big &&
+        minZ > -big && maxZ < big && minX <= maxX && minY <= maxY &&
+        minZ <= maxZ) {
+      const double pad(Kernel::Tolerance);
+      part.boundingBox = BoundingBox(maxX + pad, maxY + pad, maxZ + pad,
+                                     minX - pad, minY - pad, minZ - pad);
+      anyBounded = true;
+    }
+    m_interceptParts.push_back(part);
+  }
+  if (!anyBounded) {
+    m_interceptParts.clear();
+  } else if (m_SurList.size() > 64) {
+    // Surfaces beyond the mask are always tested, so a single part bounding
+    // the whole object is all that can still be skipped
+    InterceptPart whole{m_interceptParts.front().boundingBox, ~uint64_t(0)};
+    for (const auto &part : m_interceptParts) {
+      if (part.boundingBox.isNull()) {
+        whole.boundingBox = BoundingBox();
+        break;
+      }
+      whole.boundingBox.grow(part.boundingBox);
+    }
+    m_interceptParts.assign(1, whole);
+  }
+}
+
 /**
  * Returns all of the numbers of surfaces
  * @return Surface numbers
@@ -612,6 +697,8 @@ void CSGObject::print() const {
 void CSGObject::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(TopRule));
   TopRule = std::move(NCG);
+  // The members of the union at the top of the tree have changed
+  createInterceptParts();
 }
 
 /**
@@ -753,10 +840,18 @@ int CSGObject::procString(const std::string &Line) {
 int CSGObject::interceptSurface(Geometry::Track &UT) const {
   int originalCount = UT.count(); // Number of intersections original track
   // Loop over all the surfaces.
+  // Skip the surfaces of parts the track cannot reach
+  uint64_t surfaceMask(m_interceptParts.empty() ? ~uint64_t(0) : 0);
+  for (const auto &part : m_interceptParts) {
+    if (part.boundingBox.isNull() || part.boundingBox.doesLineIntersect(UT))
+      surfaceMask |= part.surfaces;
+  }
+  if (surfaceMask == 0)
+    return 0;
   LineIntersectVisit LI(UT.startPoint(), UT.direction());
-  std::vector<const Surface *>::const_iterator vc;
-  for (vc = m_SurList.begin(); vc != m_SurList.end(); ++vc) {
-    (*vc)->acceptVisitor(LI);
+  for (size_t i = 0; i < m_SurList.size(); ++i) {
+    if (i >= 64 || (surfaceMask >> i) & 1)
+      m_SurList[i]->acceptVisitor(LI);
   }
   const auto &IPoints(LI.getPoints());
   const auto &dPoints(LI.getDistance());
@@ -61,7 +61,7 @@ int Track::nonComplete() const {
 
   while (bc != m_links.end()) {
     if ((ac->exitPoint).distance(bc->entryPoint) > Tolerance) {
-      return (static_cast<int>(distance(m_links.begin(), bc)) + 1);
+      return (static_cast<int>(std::distance(m_links.begin(), bc)) + 1);
     }
     ++ac;
     ++bc;
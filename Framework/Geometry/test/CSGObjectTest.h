@@ -24,6 +24,7 @@
 #include <ctime>
 #include <cxxtest/TestSuite.h>
 #include <ostream>
+#include <sstream>
 #include <vector>
 
 #include "boost/make_shared.hpp"
@@ -460,6 +461,55 @@ public:
     checkTrackIntercept(TL, expectedResults);
   }
 
+  void testInterceptSurfaceUnionOfSeparatedSpheres() {
+    auto spheres = createUnionOfSeparatedSpheres();
+    std::vector<Link> expectedResults;
+    Track track(V3D(-10, 0, 0), V3D(1, 0, 0));
+    expectedResults.push_back(
+        Link(V3D(-4, 0, 0), V3D(-2, 0, 0), 8, *spheres));
+    expectedResults.push_back(Link(V3D(2, 0, 0), V3D(4, 0, 0), 14, *spheres));
+    checkTrackIntercept(spheres, track, expectedResults);
+  }
+
+  void testInterceptSurfaceUnionOfSeparatedSpheresMissingOne() {
+    auto spheres = createUnionOfSeparatedSpheres();
+    std::vector<Link> expectedResults;
+    Track track(V3D(3, -10, 0), V3D(0, 1, 0));
+    expectedResults.push_back(Link(V3D(3, -1, 0), V3D(3, 1, 0), 11, *spheres));
+    checkTrackIntercept(spheres, track, expectedResults);
+  }
+
+  void testInterceptSurfaceUnionOfSeparatedSpheresMissingBoth() {
+    auto spheres = createUnionOfSeparatedSpheres();
+    Track track(V3D(0, -10, 0), V3D(0, 1, 0));
+    checkTrackIntercept(spheres, track, std::vector<Link>());
+  }
+
+  void testInterceptSurfaceUnionStartingInsideOneMember() {
+    auto spheres = createUnionOfSeparatedSpheres();
+    std::vector<Link> expectedResults;
+    Track track(V3D(-3, 0, 0), V3D(1, 0, 0));
+    expectedResults.push_back(Link(V3D(-3, 0, 0), V3D(-2, 0, 0), 1, *spheres));
+    expectedResults.push_back(Link(V3D(2, 0, 0), V3D(4, 0, 0), 7, *spheres));
+    checkTrackIntercept(spheres, track, expectedResults);
+  }
+
+  void testInterceptSurfaceAfterRedefiningUnion() {
+    auto object = createUnionOfSeparatedSpheres();
+    // Replace the two spheres by one at the origin, between them
+    std::map<int, boost::shared_ptr<Surface>> sphereMap;
+    sphereMap[41] = boost::make_shared<Sphere>();
+    sphereMap[41]->setSurface("so 1.0");
+    sphereMap[41]->setName(41);
+    TS_ASSERT_EQUALS(object->setObject(41, "-41"), 1);
+    object->populate(sphereMap);
+
+    std::vector<Link> expectedResults;
+    Track track(V3D(0, -10, 0), V3D(0, 1, 0));
+    expectedResults.push_back(Link(V3D(0, -1, 0), V3D(0, 1, 0), 11, *object));
+    checkTrackIntercept(object, track, expectedResults);
+  }
+
   void testTrackTwoTouchingCubes()
   /**
   Test a track going through an object
@@ -1191,6 +1241,15 @@ private:
     return retVal;
   }
 
+  /// Two spheres of radius 1 centred at x = -3 and x = 3
+  boost::shared_ptr<CSGObject> createUnionOfSeparatedSpheres() {
+    const std::string xml =
+        ComponentCreationHelper::sphereXML(1.0, V3D(-3, 0, 0), "left") +
+        ComponentCreationHelper::sphereXML(1.0, V3D(3, 0, 0), "right") +
+        "<algebra val=\"left : right\" />";
+    return ShapeFactory().createShape(xml);
+  }
+
   // This creates a cylinder to test the solid angle that is more realistic in
   // size
   // for a detector cylinder
@@ -1547,7 +1606,26 @@ public:
 
   CSGObjectTestPerformance()
       : rng(200000), solid(ComponentCreationHelper::createSphere(0.1)),
-        shell(ComponentCreationHelper::createHollowShell(0.009, 0.01)) {}
+        shell(ComponentCreationHelper::createHollowShell(0.009, 0.01)),
+        cylinder(ComponentCreationHelper::createCappedCylinder(
+            0.005, 0.04, V3D(0, -0.02, 0), V3D(0, 1, 0), "sample")),
+        annulus(createAnnulus(0.006, 0.007, 0.04)) {
+    // Rays towards the axis of the shapes from random points on a ring
+    // around it
+    const double pi = std::acos(-1.0);
+    tracks.reserve(ntracks);
+    for (size_t i = 0; i < ntracks; ++i) {
+      const double phi = 2.0 * pi * rng.nextValue();
+      const V3D start(0.1 * std::cos(phi), 0.04 * (rng.nextValue() - 0.5),
+                      0.1 * std::sin(phi));
+      V3D direction = V3D(0.01 * (rng.nextValue() - 0.5),
+                          0.04 * (rng.nextValue() - 0.5),
+                          0.01 * (rng.nextValue() - 0.5)) -
+                      start;
+      direction.normalize();
+      tracks.emplace_back(start, direction);
+    }
+  }
 
   void test_generatePointInside_Solid_Primitive() {
     const size_t maxAttempts(500);
@@ -1563,11 +1641,49 @@ public:
     }
   }
 
+  void test_Intercept_Cylinder() { traceTracks({cylinder}); }
+
+  void test_Intercept_Annulus() { traceTracks({annulus}); }
+
+  void test_Intercept_Container_And_Sample() {
+    traceTracks({annulus, cylinder});
+  }
+
 private:
+  /// A hollow cylinder along the y axis centred at the origin
+  static IObject_sptr createAnnulus(double innerRadius, double outerRadius,
+                                    double height) {
+    std::ostringstream xml;
+    xml << "<hollow-cylinder id=\"container\">"
+        << "<centre-of-bottom-base x=\"0\" y=\"" << -0.5 * height
+        << "\" z=\"0\"/>"
+        << "<axis x=\"0\" y=\"1\" z=\"0\"/>"
+        << "<inner-radius val=\"" << innerRadius << "\" />"
+        << "<outer-radius val=\"" << outerRadius << "\" />"
+        << "<height val=\"" << height << "\" />"
+        << "</hollow-cylinder>";
+    return ShapeFactory().createShape(xml.str());
+  }
+
+  void traceTracks(const std::vector<IObject_sptr> &objects) {
+    for (size_t repeat = 0; repeat < nrepeats; ++repeat) {
+      for (const auto &track : tracks) {
+        Track ray(track);
+        for (const auto &object : objects)
+          object->interceptSurface(ray);
+      }
+    }
+  }
+
   const size_t npoints = 20000;
+  const size_t ntracks = 10000;
+  const size_t nrepeats = 20;
   Mantid::Kernel::MersenneTwister rng;
   IObject_sptr solid;
   IObject_sptr shell;
+  IObject_sptr cylinder;
+  IObject_sptr annulus;
+  std::vector<Track> tracks;
 };
 
 #endif // MANTID_TESTCSGOBJECT__
@@ -0,0 +1,207 @@
+#ifndef MANTID_GEOMETRY_COMPACTPARAMETERMAPTEST_H_
+#define MANTID_GEOMETRY_COMPACTPARAMETERMAPTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/CompactParameterMap.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+using namespace Mantid::Geometry;
+
+class CompactParameterMapTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompactParameterMapTest *createSuite() {
+    return new CompactParameterMapTest();
+  }
+  static void destroySuite(CompactParameterMapTest *suite) { delete suite; }
+
+  CompactParameterMapTest() {
+    // 2 banks of 2x2 pixels, detector IDs 4 to 11
+    m_instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 2);
+    std::tie(m_componentInfo, m_detectorInfo) =
+        m_instrument->makeBeamline(m_beamlinePmap);
+  }
+
+  void test_empty_map() {
+    ParameterMap pmap;
+    CompactParameterMap compact(pmap, *m_componentInfo);
+    TS_ASSERT_EQUALS(compact.size(), 0);
+    TS_ASSERT_EQUALS(compact.numberOfComponents(), m_componentInfo->size());
+    TS_ASSERT_EQUALS(compact.nameIndex("x"), CompactParameterMap::NO_NAME);
+    TS_ASSERT(!compact.get(0, "x"));
+    TS_ASSERT(!compact.getRecursive(0, "x"));
+  }
+
+  void test_get() {
+    ParameterMap pmap;
+    const auto bank = m_instrument->getComponentByName("bank1");
+    const auto detector = m_instrument->getDetector(5);
+    pmap.addDouble(bank.get(), "BankParam", 1.5);
+    pmap.addDouble(detector.get(), "DetParam", 2.5);
+    pmap.addString(detector.get(), "Name", "pixel");
+    CompactParameterMap compact(pmap, *m_componentInfo);
+    TS_ASSERT_EQUALS(compact.size(), 3);
+
+    const size_t bankIndex = indexOf(*bank);
+    const size_t detIndex = indexOf(*detector);
+    TS_ASSERT_EQUALS(compact.get(bankIndex, "BankParam")->value<double>(), 1.5);
+    TS_ASSERT_EQUALS(compact.get(detIndex, "DetParam")->value<double>(), 2.5);
+    TS_ASSERT_EQUALS(compact.get(detIndex, "Name")->value<std::string>(),
+                     "pixel");
+    // Not recursive
+    TS_ASSERT(!compact.get(detIndex, "BankParam"));
+    TS_ASSERT(!compact.get(bankIndex, "DetParam"));
+  }
+
+  void test_names_are_case_insensitive() {
+    ParameterMap pmap;
+    const auto detector = m_instrument->getDetector(5);
+    pmap.addDouble(detector.get(), "DetParam", 2.5);
+    CompactParameterMap compact(pmap, *m_componentInfo);
+    const size_t detIndex = indexOf(*detector);
+    TS_ASSERT(compact.get(detIndex, "detparam"));
+    TS_ASSERT_EQUALS(compact.nameIndex("DETPARAM"),
+                     compact.nameIndex("DetParam"));
+  }
+
+  void test_get_with_type() {
+    ParameterMap pmap;
+    const auto detector = m_instrument->getDetector(5);
+    pmap.addDouble(detector.get(), "DetParam", 2.5);
+    CompactParameterMap compact(pmap, *m_componentInfo);
+    const size_t detIndex = indexOf(*detector);
+    TS_ASSERT(compact.get(detIndex, "DetParam", ParameterMap::pDouble()));
+    TS_ASSERT(!compact.get(detIndex, "DetParam", ParameterMap::pInt()));
+  }
+
+  void test_getRecursive_matches_ParameterMap() {
+    ParameterMap pmap;
+    const auto bank = m_instrument->getComponentByName("bank2");
+    const auto detector = m_instrument->getDetector(9);
+    pmap.addDouble(m_instrument.get(), "Efixed", 1.0);
+    pmap.addDouble(bank.get(), "Efixed", 2.0);
+    pmap.addDouble(detector.get(), "Efixed", 3.0);
+    CompactParameterMap compact(pmap, *m_componentInfo);
+
+    for (const auto detID : m_detectorInfo->detectorIDs()) {
+      const auto det = m_instrument->getDetector(detID);
+      const auto expected = pmap.getRecursive(det.get(), "Efixed");
+      const auto param = compact.getRecursive(indexOf(*det), "Efixed");
+      TS_ASSERT(param);
+      TS_ASSERT_EQUALS(param->value<double>(), expected->value<double>());
+    }
+    TS_ASSERT_EQUALS(
+        compact.getRecursive(indexOf(*detector), "Efixed")->value<double>(),
+        3.0);
+    const auto other = m_instrument->getDetector(4);
+    TS_ASSERT_EQUALS(
+        compact.getRecursive(indexOf(*other), "Efixed")->value<double>(), 1.0);
+    TS_ASSERT(!compact.getRecursive(indexOf(*other), "Missing"));
+  }
+
+  void test_is_a_snapshot() {
+    ParameterMap pmap;
+    const auto detector = m_instrument->getDetector(5);
+    pmap.addDouble(detector.get(), "DetParam", 2.5);
+    CompactParameterMap compact(pmap, *m_componentInfo);
+    pmap.addDouble(detector.get(), "DetParam", 3.5);
+    pmap.addDouble(detector.get(), "Other", 1.0);
+    const size_t detIndex = indexOf(*detector);
+    TS_ASSERT_EQUALS(compact.get(detIndex, "DetParam")->value<double>(), 2.5);
+    TS_ASSERT(!compact.get(detIndex, "Other"));
+  }
+
+private:
+  size_t indexOf(const IComponent &comp) const {
+    return m_componentInfo->indexOf(comp.getComponentID());
+  }
+
+  Instrument_sptr m_instrument;
+  ParameterMap m_beamlinePmap;
+  std::unique_ptr<ComponentInfo> m_componentInfo;
+  std::unique_ptr<DetectorInfo> m_detectorInfo;
+};
+
+class CompactParameterMapTestPerformance : public CxxTest::TestSuite {
+public:
+  static CompactParameterMapTestPerformance *createSuite() {
+    return new CompactParameterMapTestPerformance();
+  }
+  static void destroySuite(CompactParameterMapTestPerformance *suite) {
+    delete suite;
+  }
+
+  CompactParameterMapTestPerformance() {
+    // 10 banks of 100x100 pixels with a parameter per pixel and per bank
+    m_instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(10, 100);
+    std::tie(m_componentInfo, m_detectorInfo) =
+        m_instrument->makeBeamline(m_beamlinePmap);
+    m_pmap.addDouble(m_instrument.get(), "Efixed", 1.0);
+    for (size_t i = 0; i < m_detectorInfo->size(); ++i) {
+      m_detectors.push_back(m_instrument->getDetector(
+                                m_detectorInfo->detectorIDs()[i])
+                                ->getComponentID());
+      m_pmap.addDouble(m_detectors.back(), "DetParam",
+                       static_cast<double>(i));
+    }
+    for (int bank = 1; bank <= 10; ++bank)
+      m_pmap.addDouble(
+          m_instrument->getComponentByName("bank" + std::to_string(bank))
+              .get(),
+          "BankParam", 2.0);
+  }
+
+  void test_build() {
+    CompactParameterMap compact(m_pmap, *m_componentInfo);
+    TS_ASSERT_EQUALS(compact.size(), m_detectors.size() + 11);
+  }
+
+  void test_get_ParameterMap() {
+    double sum = 0.;
+    for (const auto det : m_detectors)
+      sum += m_pmap.get(det, "DetParam")->value<double>();
+    TS_ASSERT_LESS_THAN(0., sum);
+  }
+
+  void test_get_CompactParameterMap() {
+    CompactParameterMap compact(m_pmap, *m_componentInfo);
+    double sum = 0.;
+    for (size_t i = 0; i < m_detectors.size(); ++i)
+      sum += compact.get(i, "DetParam")->value<double>();
+    TS_ASSERT_LESS_THAN(0., sum);
+  }
+
+  void test_getRecursive_ParameterMap() {
+    double sum = 0.;
+    for (const auto det : m_detectors)
+      sum += m_pmap.getRecursive(det, "Efixed")->value<double>();
+    TS_ASSERT_EQUALS(sum, static_cast<double>(m_detectors.size()));
+  }
+
+  void test_getRecursive_CompactParameterMap() {
+    CompactParameterMap compact(m_pmap, *m_componentInfo);
+    const size_t name = compact.nameIndex("Efixed");
+    double sum = 0.;
+    for (size_t i = 0; i < m_detectors.size(); ++i)
+      sum += compact.getRecursive(i, name)->value<double>();
+    TS_ASSERT_EQUALS(sum, static_cast<double>(m_detectors.size()));
+  }
+
+private:
+  Instrument_sptr m_instrument;
+  ParameterMap m_beamlinePmap;
+  ParameterMap m_pmap;
+  std::unique_ptr<ComponentInfo> m_componentInfo;
+  std::unique_ptr<DetectorInfo> m_detectorInfo;
+  std::vector<ComponentID> m_detectors;
+};
+
+#endif /* MANTID_GEOMETRY_COMPACTPARAMETERMAPTEST_H_ */
@@ -0,0 +1,315 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTBINARYCACHETEST_H_
+#define MANTID_GEOMETRY_INSTRUMENTBINARYCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentBinaryCache.h"
+#include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/StructuredDetector.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Strings.h"
+#include "MantidKernel/make_unique.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <boost/make_shared.hpp>
+
+using Mantid::Geometry::InstrumentBinaryCache;
+using namespace Mantid::Geometry;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Parses an IDF without going through the binary instrument cache
+Instrument_sptr parseIDF(const std::string &filename,
+                         const std::string &instName) {
+  auto &config = ConfigService::Instance();
+  const auto useCache = config.getString("instrumentDefinition.binaryCache");
+  config.setString("instrumentDefinition.binaryCache", "0");
+  InstrumentDefinitionParser parser(filename, instName,
+                                    Strings::loadFile(filename));
+  auto instrument = parser.parseXML(nullptr);
+  config.setString("instrumentDefinition.binaryCache", useCache);
+  return instrument;
+}
+
+std::string shapeXML(const boost::shared_ptr<const IObject> &shape) {
+  return boost::dynamic_pointer_cast<const CSGObject>(shape)->getShapeXML();
+}
+
+std::string cacheFilename(const std::string &name) {
+  return Poco::Path(ConfigService::Instance().getTempDir())
+      .append(name + ".instrument")
+      .toString();
+}
+} // namespace
+
+class InstrumentBinaryCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentBinaryCacheTest *createSuite() {
+    return new InstrumentBinaryCacheTest();
+  }
+  static void destroySuite(InstrumentBinaryCacheTest *suite) { delete suite; }
+
+  InstrumentBinaryCacheTest()
+      : m_filename(cacheFilename("InstrumentBinaryCacheTest")) {}
+
+  void tearDown() override {
+    Poco::File file(m_filename);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_round_trip() {
+    auto instrument = parseIDF(unitTestingIDF("IDF_for_UNIT_TESTING.xml"),
+                               "For Unit Testing");
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    const auto detector = instrument->getDetector(1);
+    typeShapes["pixel"] = boost::const_pointer_cast<IObject>(detector->shape());
+
+    InstrumentBinaryCache cache(m_filename);
+    TS_ASSERT_THROWS_NOTHING(cache.write(*instrument, "key", typeShapes));
+    auto read = boost::make_shared<Instrument>(instrument->getName());
+    InstrumentBinaryCache::TypeShapes readTypeShapes;
+    TS_ASSERT_THROWS_NOTHING(cache.read(*read, "key", readTypeShapes));
+
+    assertSameInstrument(*instrument, *read);
+    TS_ASSERT_EQUALS(readTypeShapes.size(), 1);
+    TS_ASSERT_EQUALS(shapeXML(readTypeShapes["pixel"]),
+                     shapeXML(detector->shape()));
+    TS_ASSERT_EQUALS(readTypeShapes["pixel"]->getName(),
+                     detector->shape()->getName());
+    // The components share the shapes like those built from the XML
+    TS_ASSERT_EQUALS(read->getDetector(1)->shape(), readTypeShapes["pixel"]);
+  }
+
+  void test_round_trip_with_rectangular_detectors() {
+    auto instrument =
+        parseIDF(unitTestingIDF("IDF_for_RECTANGULAR_UNIT_TESTING.xml"),
+                 "RectangularUnitTest");
+    InstrumentBinaryCache cache(m_filename);
+    cache.write(*instrument, "key", {});
+    auto read = boost::make_shared<Instrument>(instrument->getName());
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    TS_ASSERT_THROWS_NOTHING(cache.read(*read, "key", typeShapes));
+
+    assertSameInstrument(*instrument, *read);
+    auto bank = boost::dynamic_pointer_cast<const RectangularDetector>(
+        read->getComponentByName("bank1"));
+    auto expected = boost::dynamic_pointer_cast<const RectangularDetector>(
+        instrument->getComponentByName("bank1"));
+    TS_ASSERT(bank);
+    TS_ASSERT_EQUALS(bank->xpixels(), expected->xpixels());
+    TS_ASSERT_EQUALS(bank->ypixels(), expected->ypixels());
+    TS_ASSERT_EQUALS(bank->xstep(), expected->xstep());
+    TS_ASSERT_EQUALS(bank->idstart(), expected->idstart());
+    TS_ASSERT_EQUALS(bank->getDetectorIDAtXY(2, 3),
+                     expected->getDetectorIDAtXY(2, 3));
+  }
+
+  void test_round_trip_with_parameters() {
+    auto instrument = parseIDF(unitTestingIDF("IDF_for_UNIT_TESTING2.xml"),
+                               "For Unit Testing2");
+    TS_ASSERT(!instrument->getLogfileCache().empty());
+    InstrumentBinaryCache cache(m_filename);
+    cache.write(*instrument, "key", {});
+    auto read = boost::make_shared<Instrument>(instrument->getName());
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    TS_ASSERT_THROWS_NOTHING(cache.read(*read, "key", typeShapes));
+
+    assertSameInstrument(*instrument, *read);
+    const auto &expected = instrument->getLogfileCache();
+    const auto &parameters = read->getLogfileCache();
+    TS_ASSERT_EQUALS(parameters.size(), expected.size());
+    for (const auto &item : expected) {
+      const auto &name = item.first.first;
+      const auto component = item.first.second;
+      const auto readComponent =
+          component ? read->getComponentByName(component->getFullName()).get()
+                    : nullptr;
+      const auto match = parameters.find(std::make_pair(name, readComponent));
+      TS_ASSERT(match != parameters.end());
+      if (match == parameters.end())
+        continue;
+      const auto &param = *match->second;
+      TS_ASSERT_EQUALS(param.m_value, item.second->m_value);
+      TS_ASSERT_EQUALS(param.m_type, item.second->m_type);
+      TS_ASSERT_EQUALS(param.m_formula, item.second->m_formula);
+      TS_ASSERT_EQUALS(param.m_description, item.second->m_description);
+    }
+  }
+
+  void test_read_with_different_key_throws() {
+    auto instrument = parseIDF(unitTestingIDF("IDF_for_UNIT_TESTING.xml"),
+                               "For Unit Testing");
+    InstrumentBinaryCache cache(m_filename);
+    cache.write(*instrument, "key", {});
+    Instrument read;
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    TS_ASSERT_THROWS(cache.read(read, "other key", typeShapes),
+                     std::runtime_error);
+    TS_ASSERT_EQUALS(read.nelements(), 0);
+  }
+
+  void test_read_missing_file_throws() {
+    Instrument read;
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    TS_ASSERT_THROWS(InstrumentBinaryCache(m_filename)
+                         .read(read, "key", typeShapes),
+                     std::runtime_error);
+  }
+
+  void test_read_into_non_empty_instrument_throws() {
+    auto instrument = parseIDF(unitTestingIDF("IDF_for_UNIT_TESTING.xml"),
+                               "For Unit Testing");
+    InstrumentBinaryCache cache(m_filename);
+    cache.write(*instrument, "key", {});
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    TS_ASSERT_THROWS(cache.read(*instrument, "key", typeShapes),
+                     std::invalid_argument);
+  }
+
+  void test_structured_detectors_are_rejected() {
+    Instrument instrument("structured");
+    instrument.add(new StructuredDetector("panel"));
+    TS_ASSERT_THROWS(InstrumentBinaryCache(m_filename)
+                         .write(instrument, "key", {}),
+                     std::invalid_argument);
+    TS_ASSERT(!Poco::File(m_filename).exists());
+  }
+
+  void test_instruments_with_physical_instrument_are_rejected() {
+    Instrument instrument("neutronic");
+    instrument.setPhysicalInstrument(
+        Mantid::Kernel::make_unique<Instrument>("physical"));
+    TS_ASSERT_THROWS(InstrumentBinaryCache(m_filename)
+                         .write(instrument, "key", {}),
+                     std::invalid_argument);
+    TS_ASSERT(!Poco::File(m_filename).exists());
+  }
+
+  void test_parser_reads_instrument_written_to_cache() {
+    const auto filename = unitTestingIDF("IDF_for_UNIT_TESTING.xml");
+    const auto xmlText = Strings::loadFile(filename);
+    const std::string instName = "InstrumentBinaryCacheTest";
+    auto expected = parseIDF(filename, instName);
+
+    InstrumentDefinitionParser parser(filename, instName, xmlText);
+    const auto instrumentCache = cacheFilename(parser.getMangledName());
+    InstrumentBinaryCache(instrumentCache)
+        .write(*expected, parser.getMangledName(), {});
+    // The vtp directory is tried before the temporary directory
+    Poco::File primaryCache(parser.createInstrumentCacheFileName());
+    if (primaryCache.exists())
+      primaryCache.remove();
+
+    Instrument_sptr instrument;
+    TS_ASSERT_THROWS_NOTHING(instrument = parser.parseXML(nullptr));
+    assertSameInstrument(*expected, *instrument);
+    Poco::File(instrumentCache).remove();
+
+    const auto vtpFilename = parser.createVTPFileName();
+    if (!vtpFilename.empty() && Poco::File(vtpFilename).exists())
+      Poco::File(vtpFilename).remove();
+  }
+
+private:
+  std::string unitTestingIDF(const std::string &name) {
+    return ConfigService::Instance().getInstrumentDirectory() +
+           "/IDFs_for_UNIT_TESTING/" + name;
+  }
+
+  void assertSameInstrument(const Instrument &expected,
+                            const Instrument &instrument) {
+    TS_ASSERT_EQUALS(instrument.nelements(), expected.nelements());
+    TS_ASSERT_EQUALS(instrument.getValidFromDate(),
+                     expected.getValidFromDate());
+    TS_ASSERT_EQUALS(instrument.getValidToDate(), expected.getValidToDate());
+    TS_ASSERT_EQUALS(instrument.getDefaultView(), expected.getDefaultView());
+    TS_ASSERT_EQUALS(instrument.getDefaultAxis(), expected.getDefaultAxis());
+    const auto frame = instrument.getReferenceFrame();
+    const auto expectedFrame = expected.getReferenceFrame();
+    TS_ASSERT_EQUALS(frame->pointingUp(), expectedFrame->pointingUp());
+    TS_ASSERT_EQUALS(frame->pointingAlongBeam(),
+                     expectedFrame->pointingAlongBeam());
+    TS_ASSERT_EQUALS(frame->getHandedness(), expectedFrame->getHandedness());
+    TS_ASSERT_EQUALS(frame->origin(), expectedFrame->origin());
+
+    TS_ASSERT_EQUALS(instrument.getSource()->getFullName(),
+                     expected.getSource()->getFullName());
+    TS_ASSERT_EQUALS(instrument.getSource()->getPos(),
+                     expected.getSource()->getPos());
+    TS_ASSERT_EQUALS(instrument.getSample()->getFullName(),
+                     expected.getSample()->getFullName());
+    TS_ASSERT_EQUALS(instrument.getSample()->getPos(),
+                     expected.getSample()->getPos());
+    TS_ASSERT_EQUALS(instrument.getNumberOfChopperPoints(),
+                     expected.getNumberOfChopperPoints());
+
+    const auto detectorIDs = instrument.getDetectorIDs();
+    TS_ASSERT_EQUALS(detectorIDs, expected.getDetectorIDs());
+    TS_ASSERT_EQUALS(instrument.getMonitors(), expected.getMonitors());
+    for (const auto id : detectorIDs) {
+      const auto detector = instrument.getDetector(id);
+      const auto expectedDetector = expected.getDetector(id);
+      TS_ASSERT_EQUALS(detector->getFullName(),
+                       expectedDetector->getFullName());
+      TS_ASSERT_EQUALS(detector->getPos(), expectedDetector->getPos());
+      TS_ASSERT_EQUALS(detector->getRotation(),
+                       expectedDetector->getRotation());
+      TS_ASSERT_EQUALS(shapeXML(detector->shape()),
+                       shapeXML(expectedDetector->shape()));
+    }
+  }
+
+  const std::string m_filename;
+};
+
+class InstrumentBinaryCacheTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentBinaryCacheTestPerformance *createSuite() {
+    return new InstrumentBinaryCacheTestPerformance();
+  }
+  static void destroySuite(InstrumentBinaryCacheTestPerformance *suite) {
+    delete suite;
+  }
+
+  InstrumentBinaryCacheTestPerformance()
+      : m_filename(cacheFilename("InstrumentBinaryCacheTestPerformance")) {
+    m_wish = parseIDF(ConfigService::Instance().getInstrumentDirectory() +
+                          "/WISH_Definition_10Panels.xml",
+                      "WISH");
+    InstrumentBinaryCache(m_filename).write(*m_wish, "key", {});
+  }
+
+  ~InstrumentBinaryCacheTestPerformance() override {
+    Poco::File(m_filename).remove();
+  }
+
+  void test_read_wish() {
+    Instrument instrument("WISH");
+    InstrumentBinaryCache::TypeShapes typeShapes;
+    InstrumentBinaryCache(m_filename).read(instrument, "key", typeShapes);
+    TS_ASSERT_EQUALS(instrument.getNumberDetectors(),
+                     m_wish->getNumberDetectors());
+  }
+
+  void test_write_wish() {
+    InstrumentBinaryCache(m_filename).write(*m_wish, "key", {});
+  }
+
+private:
+  const std::string m_filename;
+  Instrument_sptr m_wish;
+};
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTBINARYCACHETEST_H_ */
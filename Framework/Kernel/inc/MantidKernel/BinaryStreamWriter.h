@@ -0,0 +1,74 @@
+#ifndef MANTID_KERNEL_BINARYSTREAMWRITER_H_
+#define MANTID_KERNEL_BINARYSTREAMWRITER_H_
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+#include "MantidKernel/DllConfig.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/**
+ * Assists with writing a binary file by providing standard overloads for the
+ * ostream operators (<<) to given types (and vectors of those types). The
+ * layout matches what BinaryStreamReader expects, in particular strings are
+ * written as a 4-byte length followed by the characters. It only allows for
+ * writing fixed-width integer types to avoid cross-platform differences on
+ * the sizes of various types.
+ *
+ * Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+ * National Laboratory & European Spallation Source
+ *
+ * This file is part of Mantid.
+ *
+ * Mantid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Mantid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File change history is stored at: <https://github.com/mantidproject/mantid>
+ * Code Documentation is available at: <http://doxygen.mantidproject.org>
+ */
+class MANTID_KERNEL_DLL BinaryStreamWriter {
+public:
+  BinaryStreamWriter(std::ostream &ostrm);
+
+  ///@name Single-value stream operators
+  /// @{
+  BinaryStreamWriter &operator<<(const int32_t value);
+  BinaryStreamWriter &operator<<(const int64_t value);
+  BinaryStreamWriter &operator<<(const float value);
+  BinaryStreamWriter &operator<<(const double value);
+  BinaryStreamWriter &operator<<(const std::string &value);
+  /// @}
+
+  ///@name 1D methods
+  /// @{
+  BinaryStreamWriter &write(const std::vector<int32_t> &value);
+  BinaryStreamWriter &write(const std::vector<int64_t> &value);
+  BinaryStreamWriter &write(const std::vector<float> &value);
+  BinaryStreamWriter &write(const std::vector<double> &value);
+  /// @}
+
+private:
+  /// Reference to the stream being written
+  std::ostream &m_ostrm;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_BINARYSTREAMWRITER_H_ */
@@ -0,0 +1,88 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler that keeps one queue of
+ * tasks per thread instead of a single shared queue, so that threads do not
+ * all contend for the same lock when the tasks are very short.
+
+ * - Tasks pushed from outside the thread pool are placed on the queue with
+ *   the lowest total Task::cost(), balancing the initial load.
+ * - Tasks pushed by a running task (e.g. when splitting boxes) go on the
+ *   queue of the thread running it, which keeps related work together.
+ * - A thread pops the newest task from its own queue. When that is empty it
+ *   steals the oldest task from another queue, starting at a random one.
+ *
+ * Like ThreadSchedulerFIFO, task mutexes are not considered.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+
+  /// @return the number of per-thread queues
+  size_t numQueues() const { return m_queues.size(); }
+
+private:
+  /// The tasks belonging to one thread
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task *> tasks;
+    /// Total cost of the tasks, only modified while holding mutex
+    std::atomic<double> cost{0.};
+    /// Number of tasks, readable without taking the mutex
+    std::atomic<size_t> count{0};
+  };
+
+  size_t queueForPush() const;
+  Task *popBack(WorkQueue &queue);
+  Task *popFront(WorkQueue &queue);
+
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  /// Total number of queued tasks
+  std::atomic<size_t> m_size{0};
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
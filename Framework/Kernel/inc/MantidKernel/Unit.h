@@ -183,6 +183,23 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of values to TOF. The unit must be initialized.
+   * @param x :: the values to convert
+   * @param tof :: receives the TOF values, may be the same array as x
+   * @param count :: the number of values
+   */
+  virtual void multipleToTOF(const double *x, double *tof,
+                             const size_t count) const;
+
+  /** Convert an array of tof values to this unit. The unit must be
+   * initialized.
+   * @param tof :: the values to convert
+   * @param x :: receives the converted values, may be the same array as tof
+   * @param count :: the number of values
+   */
+  virtual void multipleFromTOF(const double *tof, double *x,
+                               const size_t count) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -320,6 +337,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -347,6 +368,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -394,6 +419,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -444,6 +473,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -489,6 +522,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -548,6 +585,10 @@ public:
 
   double singleToTOF(const double ki) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -574,6 +615,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -593,6 +638,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(const double *x, double *tof,
+                     const size_t count) const override;
+  void multipleFromTOF(const double *tof, double *x,
+                       const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
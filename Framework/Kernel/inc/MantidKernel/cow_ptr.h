@@ -8,7 +8,6 @@
 #include <boost/shared_ptr.hpp>
 #endif
 
-#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -61,7 +60,6 @@ public:
 
 private:
   ptr_type Data; ///< Real object Ptr
-  std::mutex copyMutex;
 
 public:
   cow_ptr(ptr_type &&resourceSptr) noexcept;
@@ -71,14 +69,9 @@ public:
   /// Constructs a cow_ptr with no managed object, i.e. empty cow_ptr.
   constexpr cow_ptr(std::nullptr_t) noexcept : Data(nullptr) {}
   cow_ptr(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
-  cow_ptr(cow_ptr<DataType> &&other) noexcept : Data(std::move(other.Data)) {}
+  cow_ptr(cow_ptr<DataType> &&other) noexcept = default;
   cow_ptr<DataType> &operator=(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
-  cow_ptr<DataType> &operator=(cow_ptr<DataType> &&rhs) noexcept {
-    Data = std::move(rhs.Data);
-    return *this;
-  }
+  cow_ptr<DataType> &operator=(cow_ptr<DataType> &&rhs) noexcept = default;
   cow_ptr<DataType> &operator=(const ptr_type &) noexcept;
 
   /// Returns the stored pointer.
@@ -127,7 +120,7 @@ cow_ptr<DataType>::cow_ptr() : Data(boost::make_shared<DataType>()) {}
   Copy constructor : double references the data object
   @param A :: object to copy
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
+// Note: Need custom implementation, the pointer is loaded atomically.
 template <typename DataType>
 cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept
     : Data(boost::atomic_load(&A.Data)) {}
@@ -138,7 +131,7 @@ cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept
   @param A :: object to copy
   @return *this
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
+// Note: Need custom implementation, the pointers are swapped atomically.
 template <typename DataType>
 cow_ptr<DataType> &cow_ptr<DataType>::
 operator=(const cow_ptr<DataType> &A) noexcept {
@@ -175,14 +168,17 @@ cow_ptr<DataType> &cow_ptr<DataType>::operator=(const ptr_type &A) noexcept {
   @return new copy of *this, if required
 */
 template <typename DataType> DataType &cow_ptr<DataType>::access() {
-  // Use a double-check for sharing so that we only acquire the lock if
-  // absolutely necessary
+  // Use a double-check for sharing so that we only copy if absolutely
+  // necessary. There is no lock: if several threads copy at the same time,
+  // the compare-exchange installs the first copy and the other threads
+  // discard theirs, so all of them get a reference to the same data.
   if (!Data.unique()) {
-    std::lock_guard<std::mutex> lock{copyMutex};
-    // Check again because another thread may have taken copy and dropped
-    // reference count since previous check
-    if (!Data.unique()) {
-      boost::atomic_store(&Data, boost::make_shared<DataType>(*Data));
+    ptr_type shared = boost::atomic_load(&Data);
+    // Check again, counting the reference held by shared, because another
+    // thread may have installed its own copy since the previous check
+    if (shared.use_count() > 2) {
+      ptr_type copy = boost::make_shared<DataType>(*shared);
+      boost::atomic_compare_exchange(&Data, &shared, std::move(copy));
     }
   }
   return *Data;
@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+#include "MantidKernel/BinaryStreamWriter.h"
+
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+//------------------------------------------------------------------------------
+// Anonymous functions
+//------------------------------------------------------------------------------
+namespace {
+
+/**
+ * Write a value to the stream based on the template type
+ * @param stream The open stream on which to perform the write
+ * @param value The value to write
+ */
+template <typename T>
+inline void writeToStream(std::ostream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * Overload to write an array of values to the stream based on the template
+ * type for the element of the array.
+ * @param stream The open stream on which to perform the write
+ * @param value The values to write
+ */
+template <typename T>
+inline void writeToStream(std::ostream &stream, const std::vector<T> &value) {
+  stream.write(reinterpret_cast<const char *>(value.data()),
+               value.size() * sizeof(T));
+}
+} // namespace
+
+//------------------------------------------------------------------------------
+// Public members
+//------------------------------------------------------------------------------
+
+/**
+ * Constructor taking the stream to write.
+ * @param ostrm An open stream to which data will be written. The object does
+ * not take ownership of the stream. The caller is responsible for closing
+ * it.
+ */
+BinaryStreamWriter::BinaryStreamWriter(std::ostream &ostrm) : m_ostrm(ostrm) {
+  if (!ostrm) {
+    throw std::runtime_error("BinaryStreamWriter: Output stream is in a bad "
+                             "state. Cannot continue.");
+  }
+}
+
+/**
+ * Write a int32_t to the stream
+ * @param value The value to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::operator<<(const int32_t value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write a int64_t to the stream
+ * @param value The value to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::operator<<(const int64_t value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write a float (4-bytes) to the stream
+ * @param value The value to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::operator<<(const float value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write a double (8-bytes) to the stream
+ * @param value The value to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::operator<<(const double value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write a string to the stream as its length, as a int32_t, followed directly
+ * by the characters. This is the layout expected by
+ * BinaryStreamReader::operator>>(std::string&).
+ * @param value The string to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::operator<<(const std::string &value) {
+  if (value.size() >
+      static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    throw std::length_error("BinaryStreamWriter: String is too long to be "
+                            "written.");
+  }
+  writeToStream(m_ostrm, static_cast<int32_t>(value.size()));
+  m_ostrm.write(value.data(), value.size());
+  return *this;
+}
+
+/**
+ * Write an array of int32_t to the stream. The length is not written.
+ * @param value The array to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &
+BinaryStreamWriter::write(const std::vector<int32_t> &value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write an array of int64_t to the stream. The length is not written.
+ * @param value The array to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &
+BinaryStreamWriter::write(const std::vector<int64_t> &value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write an array of float values to the stream. The length is not written.
+ * @param value The array to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &BinaryStreamWriter::write(const std::vector<float> &value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+/**
+ * Write an array of double values to the stream. The length is not written.
+ * @param value The array to write
+ * @return A reference to the BinaryStreamWriter object
+ */
+BinaryStreamWriter &
+BinaryStreamWriter::write(const std::vector<double> &value) {
+  writeToStream(m_ostrm, value);
+  return *this;
+}
+
+} // namespace Kernel
+} // namespace Mantid
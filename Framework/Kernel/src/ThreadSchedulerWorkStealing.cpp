@@ -0,0 +1,165 @@
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <random>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scheduler and queue of the task being run by this thread, if any
+struct CurrentQueue {
+  const ThreadSchedulerWorkStealing *scheduler = nullptr;
+  size_t queue = 0;
+};
+thread_local CurrentQueue currentQueue;
+} // namespace
+
+/** Constructor
+ *
+ * @param numQueues :: number of per-thread queues. This should match the
+ *        number of threads of the ThreadPool; thread N uses queue
+ *        N % numQueues. Default 0 means one per physical core.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler() {
+  if (numQueues == 0)
+    numQueues = std::max(ThreadPool::getNumPhysicalCores(), size_t(1));
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(make_unique<WorkQueue>());
+}
+
+/// Destructor, deletes any tasks left in the queues
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() {
+  if (currentQueue.scheduler == this)
+    currentQueue.scheduler = nullptr;
+  clear();
+}
+
+//-------------------------------------------------------------------------------
+/** Add a Task to the queue of the calling thread if it is running a task
+ * from this scheduler, otherwise to the queue with the lowest total cost.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  auto &queue = *m_queues[queueForPush()];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.tasks.push_back(newTask);
+  queue.cost.store(queue.cost.load() + newTask->cost());
+  ++queue.count;
+  ++m_size;
+}
+
+//-------------------------------------------------------------------------------
+/** Retrieves the next Task to execute: the newest one in the thread's own
+ * queue, or else the oldest one from another queue.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or nullptr if all queues are empty.
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t numQueues = m_queues.size();
+  const size_t own = threadnum % numQueues;
+  currentQueue.scheduler = this;
+  currentQueue.queue = own;
+
+  if (Task *task = popBack(*m_queues[own]))
+    return task;
+
+  // Steal, starting from a random victim to spread out contention
+  thread_local std::minstd_rand generator(
+      static_cast<std::minstd_rand::result_type>(threadnum + 1));
+  const size_t start = generator() % numQueues;
+  for (size_t i = 0; i < numQueues && m_size > 0; ++i) {
+    const size_t victim = (start + i) % numQueues;
+    if (victim == own)
+      continue;
+    if (Task *task = popFront(*m_queues[victim]))
+      return task;
+  }
+  return nullptr;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the number of queued tasks
+size_t ThreadSchedulerWorkStealing::size() { return m_size; }
+
+/// @return true if no tasks are queued
+bool ThreadSchedulerWorkStealing::empty() { return m_size == 0; }
+
+//-------------------------------------------------------------------------------
+/// Empty out all the queues, deleting the tasks
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    for (auto &task : queue->tasks)
+      delete task;
+    m_size -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->cost = 0.;
+    queue->count = 0;
+  }
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the total cost of all queued tasks
+double ThreadSchedulerWorkStealing::totalCost() {
+  double cost(0.);
+  for (const auto &queue : m_queues)
+    cost += queue->cost;
+  return cost;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the index of the queue a task pushed now should go on
+size_t ThreadSchedulerWorkStealing::queueForPush() const {
+  if (currentQueue.scheduler == this)
+    return currentQueue.queue;
+  size_t best = 0;
+  double bestCost = m_queues[0]->cost;
+  for (size_t i = 1; i < m_queues.size(); ++i) {
+    const double cost = m_queues[i]->cost;
+    if (cost < bestCost) {
+      best = i;
+      bestCost = cost;
+    }
+  }
+  return best;
+}
+
+/// @return the newest task in the queue, or nullptr if it is empty
+Task *ThreadSchedulerWorkStealing::popBack(WorkQueue &queue) {
+  if (queue.count == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.back();
+  queue.tasks.pop_back();
+  queue.cost.store(queue.cost.load() - task->cost());
+  --queue.count;
+  --m_size;
+  return task;
+}
+
+/// @return the oldest task in the queue, or nullptr if it is empty
+Task *ThreadSchedulerWorkStealing::popFront(WorkQueue &queue) {
+  if (queue.count == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.front();
+  queue.tasks.pop_front();
+  queue.cost.store(queue.cost.load() - task->cost());
+  --queue.count;
+  --m_size;
+  return task;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -5,11 +5,29 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/** Apply a conversion to an array of values. The loop has no function calls
+ * and no aliasing through members, so the compiler can vectorise it for
+ * conversions written with arithmetic and conditional expressions only.
+ * @param in :: the values to convert
+ * @param out :: receives the converted values, may be the same array as in
+ * @param count :: the number of values
+ * @param func :: the conversion of a single value
+ */
+template <typename Func>
+void convertEach(const double *in, double *out, const size_t count,
+                 const Func &func) {
+  for (size_t i = 0; i < count; ++i)
+    out[i] = func(in[i]);
+}
+} // namespace
+
 /**
  * Default constructor
  * Gives the unit an empty UnitLabel
@@ -138,9 +156,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->multipleToTOF(xdata.data(), xdata.data(), xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -169,9 +185,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->multipleFromTOF(xdata.data(), xdata.data(), xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -191,6 +205,22 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1,
   return this->singleFromTOF(xvalue);
 }
 
+/// Convert each value with singleToTOF(). Units override this where the
+/// conversion can be done without a virtual call per value.
+void Unit::multipleToTOF(const double *x, double *tof,
+                         const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    tof[i] = this->singleToTOF(x[i]);
+}
+
+/// Convert each value with singleFromTOF(). Units override this where the
+/// conversion can be done without a virtual call per value.
+void Unit::multipleFromTOF(const double *tof, double *x,
+                           const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    x[i] = this->singleFromTOF(tof[i]);
+}
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -415,6 +445,28 @@ double Wavelength::conversionTOFMax() const {
   return max_tof;
 }
 
+void Wavelength::multipleToTOF(const double *x, double *tof,
+                               const size_t count) const {
+  const double factor = factorTo;
+  if (emode == 1 || emode == 2) {
+    const double sfp = sfpTo;
+    convertEach(x, tof, count, [=](double v) { return v * factor + sfp; });
+  } else {
+    convertEach(x, tof, count, [=](double v) { return v * factor; });
+  }
+}
+
+void Wavelength::multipleFromTOF(const double *tof, double *x,
+                                 const size_t count) const {
+  const double factor = factorFrom;
+  if (do_sfpFrom) {
+    const double sfp = sfpFrom;
+    convertEach(tof, x, count, [=](double v) { return (v - sfp) * factor; });
+  } else {
+    convertEach(tof, x, count, [=](double v) { return v * factor; });
+  }
+}
+
 Unit *Wavelength::clone() const { return new Wavelength(*this); }
 
 // ============================================================================================
@@ -471,6 +523,23 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::multipleToTOF(const double *x, double *tof,
+                           const size_t count) const {
+  const double factor = factorTo;
+  convertEach(x, tof, count, [=](double v) {
+    return factor / sqrt(v == 0.0 ? DBL_MIN : v);
+  });
+}
+
+void Energy::multipleFromTOF(const double *tof, double *x,
+                             const size_t count) const {
+  const double factor = factorFrom;
+  convertEach(tof, x, count, [=](double v) {
+    const double temp = v == 0.0 ? DBL_MIN : v;
+    return factor / (temp * temp);
+  });
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -580,6 +649,18 @@ double dSpacing::singleFromTOF(const double tof) const {
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
+void dSpacing::multipleToTOF(const double *x, double *tof,
+                             const size_t count) const {
+  const double factor = factorTo;
+  convertEach(x, tof, count, [=](double v) { return v * factor; });
+}
+
+void dSpacing::multipleFromTOF(const double *tof, double *x,
+                               const size_t count) const {
+  const double factor = factorFrom;
+  convertEach(tof, x, count, [=](double v) { return v / factor; });
+}
+
 Unit *dSpacing::clone() const { return new dSpacing(*this); }
 
 // ==================================================================================================
@@ -693,6 +774,20 @@ double MomentumTransfer::conversionTOFMin() const {
 }
 double MomentumTransfer::conversionTOFMax() const { return DBL_MAX; }
 
+void MomentumTransfer::multipleToTOF(const double *x, double *tof,
+                                     const size_t count) const {
+  const double factor = factorTo;
+  convertEach(x, tof, count,
+              [=](double v) { return factor / (v == 0.0 ? DBL_MIN : v); });
+}
+
+void MomentumTransfer::multipleFromTOF(const double *tof, double *x,
+                                       const size_t count) const {
+  const double factor = factorFrom;
+  convertEach(tof, x, count,
+              [=](double v) { return factor / (v == 0.0 ? DBL_MIN : v); });
+}
+
 Unit *MomentumTransfer::clone() const { return new MomentumTransfer(*this); }
 
 /* ===================================================================================================
@@ -877,6 +972,46 @@ double DeltaE::conversionTOFMax() const {
     return t_otherFrom + sqrt(factorFrom) / sqrt(DBL_MIN);
 }
 
+void DeltaE::multipleToTOF(const double *x, double *tof,
+                           const size_t count) const {
+  const double tofMax = DeltaE::conversionTOFMax();
+  if (emode != 1 && emode != 2) {
+    std::fill_n(tof, count, tofMax);
+    return;
+  }
+  // e = efixed - x for direct and efixed + x for indirect geometry
+  const double sign = emode == 1 ? -1. : 1.;
+  const double fixed = efixed;
+  const double scaling = unitScaling;
+  const double factor = factorTo;
+  const double other = t_other;
+  convertEach(x, tof, count, [=](double v) {
+    const double e = fixed + sign * (v / scaling);
+    return e <= 0.0 ? tofMax : factor / sqrt(e) + other;
+  });
+}
+
+void DeltaE::multipleFromTOF(const double *tof, double *x,
+                             const size_t count) const {
+  const double fixed = efixed;
+  const double scaling = unitScaling;
+  const double factor = factorFrom;
+  const double other = t_otherFrom;
+  if (emode == 1) {
+    convertEach(tof, x, count, [=](double v) {
+      const double t = v - other;
+      return t <= 0.0 ? -DBL_MAX : (fixed - factor / (t * t)) * scaling;
+    });
+  } else if (emode == 2) {
+    convertEach(tof, x, count, [=](double v) {
+      const double t = v - other;
+      return t <= 0.0 ? DBL_MAX : (factor / (t * t) - fixed) * scaling;
+    });
+  } else {
+    std::fill_n(x, count, DBL_MAX);
+  }
+}
+
 Unit *DeltaE::clone() const { return new DeltaE(*this); }
 
 // =====================================================================================================
@@ -1063,6 +1198,27 @@ double Momentum::singleFromTOF(const double tof) const {
   return factorFrom / x;
 }
 
+void Momentum::multipleToTOF(const double *x, double *tof,
+                             const size_t count) const {
+  const double factor = factorTo;
+  if (emode == 1 || emode == 2) {
+    const double sfp = sfpTo;
+    convertEach(x, tof, count, [=](double v) { return factor / v + sfp; });
+  } else {
+    convertEach(x, tof, count, [=](double v) { return factor / v; });
+  }
+}
+
+void Momentum::multipleFromTOF(const double *tof, double *x,
+                               const size_t count) const {
+  const double factor = factorFrom;
+  const double sfp = do_sfpFrom ? sfpFrom : 0.;
+  convertEach(tof, x, count, [=](double v) {
+    const double temp = v - sfp;
+    return factor / (temp == 0 ? DBL_MIN : temp);
+  });
+}
+
 Unit *Momentum::clone() const { return new Momentum(*this); }
 
 // ============================================================================================
@@ -1114,6 +1270,17 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+/// Not a multiple of the wavelength, so convert one value at a time
+void SpinEchoLength::multipleToTOF(const double *x, double *tof,
+                                   const size_t count) const {
+  Unit::multipleToTOF(x, tof, count);
+}
+
+void SpinEchoLength::multipleFromTOF(const double *tof, double *x,
+                                     const size_t count) const {
+  Unit::multipleFromTOF(tof, x, count);
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1159,6 +1326,17 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+/// Not a multiple of the wavelength, so convert one value at a time
+void SpinEchoTime::multipleToTOF(const double *x, double *tof,
+                                 const size_t count) const {
+  Unit::multipleToTOF(x, tof, count);
+}
+
+void SpinEchoTime::multipleFromTOF(const double *tof, double *x,
+                                   const size_t count) const {
+  Unit::multipleFromTOF(tof, x, count);
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
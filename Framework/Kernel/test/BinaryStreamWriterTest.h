@@ -0,0 +1,114 @@
+#ifndef MANTID_KERNEL_BINARYSTREAMWRITERTEST_H_
+#define MANTID_KERNEL_BINARYSTREAMWRITERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/BinaryStreamReader.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+
+#include <sstream>
+
+using Mantid::Kernel::BinaryStreamReader;
+using Mantid::Kernel::BinaryStreamWriter;
+
+class BinaryStreamWriterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinaryStreamWriterTest *createSuite() {
+    return new BinaryStreamWriterTest();
+  }
+  static void destroySuite(BinaryStreamWriterTest *suite) { delete suite; }
+
+  void test_Constructor_With_Bad_Stream_Throws() {
+    std::ostringstream stream;
+    stream.setstate(std::ios_base::badbit);
+    TS_ASSERT_THROWS(BinaryStreamWriter writer(stream), std::runtime_error);
+  }
+
+  void test_Write_int32_t() { doWriteSingleValueTest<int32_t>(6); }
+
+  void test_Write_int64_t() { doWriteSingleValueTest<int64_t>(580); }
+
+  void test_Write_float() { doWriteSingleValueTest<float>(787.0f); }
+
+  void test_Write_double() { doWriteSingleValueTest<double>(2.0); }
+
+  void test_Write_String_Writes_Length_Then_Characters() {
+    std::ostringstream stream;
+    BinaryStreamWriter writer(stream);
+    writer << std::string("mantid");
+    const std::string bytes = stream.str();
+    TS_ASSERT_EQUALS(sizeof(int32_t) + 6, bytes.size());
+    TS_ASSERT_EQUALS("mantid", bytes.substr(sizeof(int32_t)));
+
+    std::istringstream input(bytes);
+    BinaryStreamReader reader(input);
+    std::string value;
+    reader >> value;
+    TS_ASSERT_EQUALS("mantid", value);
+  }
+
+  void test_Write_Empty_String() { doWriteSingleValueTest<std::string>(""); }
+
+  void test_Write_Vector_int32_t() {
+    doWriteArrayValueTest(std::vector<int32_t>{2, 4, 6});
+  }
+
+  void test_Write_Vector_int64_t() {
+    doWriteArrayValueTest(std::vector<int64_t>{200, 400, 600, 900});
+  }
+
+  void test_Write_Vector_float() {
+    doWriteArrayValueTest(std::vector<float>{0.0f, 5.0f, 10.0f});
+  }
+
+  void test_Write_Vector_double() {
+    doWriteArrayValueTest(std::vector<double>{10.0, 15.0, 20.0, 25.0});
+  }
+
+  void test_Mixed_Values_Are_Read_Back_In_Order() {
+    std::stringstream stream;
+    BinaryStreamWriter writer(stream);
+    writer << int32_t(1) << std::string("abc") << 3.5 << int64_t(-7);
+
+    BinaryStreamReader reader(stream);
+    int32_t first(0);
+    std::string second;
+    double third(0.);
+    int64_t fourth(0);
+    reader >> first >> second >> third >> fourth;
+    TS_ASSERT_EQUALS(1, first);
+    TS_ASSERT_EQUALS("abc", second);
+    TS_ASSERT_EQUALS(3.5, third);
+    TS_ASSERT_EQUALS(-7, fourth);
+  }
+
+private:
+  template <typename T> void doWriteSingleValueTest(const T &expected) {
+    std::stringstream stream;
+    BinaryStreamWriter writer(stream);
+    writer << expected;
+
+    BinaryStreamReader reader(stream);
+    T value;
+    reader >> value;
+    TS_ASSERT_EQUALS(expected, value);
+    TS_ASSERT(stream.peek() == std::char_traits<char>::eof());
+  }
+
+  template <typename T>
+  void doWriteArrayValueTest(const std::vector<T> &expected) {
+    std::stringstream stream;
+    BinaryStreamWriter writer(stream);
+    writer.write(expected);
+    TS_ASSERT_EQUALS(expected.size() * sizeof(T), stream.str().size());
+
+    BinaryStreamReader reader(stream);
+    std::vector<T> value;
+    reader.read(value, expected.size());
+    TS_ASSERT_EQUALS(expected, value);
+  }
+};
+
+#endif /* MANTID_KERNEL_BINARYSTREAMWRITERTEST_H_ */
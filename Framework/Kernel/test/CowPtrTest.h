@@ -1,6 +1,7 @@
 #ifndef COW_PTR_TEST_H_
 #define COW_PTR_TEST_H_
 
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/cow_ptr.h"
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
@@ -153,6 +154,29 @@ public:
                        copyResource.value);
   }
 
+  void test_access_from_several_threads() {
+    cow_ptr<MyType> original{boost::make_shared<MyType>(3)};
+    auto copy = original;
+
+    // All threads must get the same copy of the resource
+    std::vector<MyType *> resources(16);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(resources.size()); ++i)
+      resources[i] = &copy.access();
+
+    TS_ASSERT(copy.unique());
+    TS_ASSERT_DIFFERS(original.get(), copy.get());
+    for (const auto resource : resources)
+      TS_ASSERT_EQUALS(resource, copy.get());
+    TS_ASSERT_EQUALS(copy->value, 3);
+  }
+
+  void test_size_is_that_of_shared_ptr() {
+    // cow_ptr is held several times by every spectrum of a workspace
+    TS_ASSERT_EQUALS(sizeof(cow_ptr<MyType>),
+                     sizeof(boost::shared_ptr<MyType>));
+  }
+
   void test_equals_not_equals() {
     cow_ptr<MyType> cow{nullptr};
     TS_ASSERT(cow == cow);
@@ -167,4 +191,43 @@ public:
   }
 };
 
+class CowPtrTestPerformance : public CxxTest::TestSuite {
+public:
+  static CowPtrTestPerformance *createSuite() {
+    return new CowPtrTestPerformance();
+  }
+  static void destroySuite(CowPtrTestPerformance *suite) { delete suite; }
+
+  CowPtrTestPerformance() : m_cows(1000000) {
+    for (auto &cow : m_cows)
+      cow = boost::make_shared<MyType>(1);
+  }
+
+  void test_access_unique() {
+    int sum = 0;
+    for (size_t i = 0; i < 100; ++i)
+      for (auto &cow : m_cows)
+        sum += ++cow.access().value;
+    TS_ASSERT_DIFFERS(sum, 0);
+  }
+
+  void test_access_shared() {
+    auto copies = m_cows;
+    for (auto &cow : copies)
+      cow.access().value = 2;
+    TS_ASSERT_EQUALS(copies.back()->value, 2);
+  }
+
+  void test_dereference() {
+    int sum = 0;
+    for (size_t i = 0; i < 100; ++i)
+      for (const auto &cow : m_cows)
+        sum += (*cow).value;
+    TS_ASSERT_DIFFERS(sum, 0);
+  }
+
+private:
+  std::vector<cow_ptr<MyType>> m_cows;
+};
+
 #endif /*COW_PTR_TEST_H_*/
@@ -5,6 +5,7 @@
 
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include <MantidKernel/FunctionTask.h>
 #include <MantidKernel/ProgressText.h>
 #include <MantidKernel/ThreadPool.h>
@@ -14,6 +15,8 @@
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
+
+#include <atomic>
 #include <cstdlib>
 
 using namespace Mantid::Kernel;
@@ -370,6 +373,10 @@ public:
     do_StressTest_scheduler(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() {
+    do_StressTest_scheduler(new ThreadSchedulerWorkStealing());
+  }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -408,6 +415,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
@@ -432,4 +443,60 @@ public:
   }
 };
 
+//=======================================================================================
+/** Measures the scheduling overhead of each scheduler: a large number of
+ * tasks that do almost nothing, so the threads mostly contend for the queue.
+ */
+class ThreadPoolTestPerformance : public CxxTest::TestSuite {
+public:
+  static ThreadPoolTestPerformance *createSuite() {
+    return new ThreadPoolTestPerformance();
+  }
+  static void destroySuite(ThreadPoolTestPerformance *suite) { delete suite; }
+
+  void test_contention_ThreadSchedulerFIFO() {
+    do_test_contention(new ThreadSchedulerFIFO());
+  }
+
+  void test_contention_ThreadSchedulerLargestCost() {
+    do_test_contention(new ThreadSchedulerLargestCost());
+  }
+
+  void test_contention_ThreadSchedulerMutexes() {
+    do_test_contention(new ThreadSchedulerMutexes());
+  }
+
+  void test_contention_ThreadSchedulerWorkStealing() {
+    do_test_contention(new ThreadSchedulerWorkStealing());
+  }
+
+  void test_tasks_that_create_tasks_ThreadSchedulerFIFO() {
+    do_test_tasks_that_create_tasks(new ThreadSchedulerFIFO());
+  }
+
+  void test_tasks_that_create_tasks_ThreadSchedulerWorkStealing() {
+    do_test_tasks_that_create_tasks(new ThreadSchedulerWorkStealing());
+  }
+
+private:
+  void do_test_contention(ThreadScheduler *sched) {
+    ThreadPool p(sched, 0);
+    std::atomic<size_t> total{0};
+    const size_t num = 2000000;
+    for (size_t i = 0; i < num; i++)
+      p.schedule(new FunctionTask([&total] { ++total; }, 1.0));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    TS_ASSERT_EQUALS(total, num);
+  }
+
+  void do_test_tasks_that_create_tasks(ThreadScheduler *sched) {
+    ThreadPool p(sched, 0);
+    TaskThatAddsTasks_counter = 0;
+    for (size_t i = 0; i < 100; i++)
+      p.schedule(new TaskThatAddsTasks(sched, 0));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    TS_ASSERT_EQUALS(TaskThatAddsTasks_counter, 1000000);
+  }
+};
+
 #endif
@@ -7,6 +7,7 @@
 
 #include <MantidKernel/Task.h>
 #include <MantidKernel/ThreadScheduler.h>
+#include <MantidKernel/ThreadSchedulerWorkStealing.h>
 
 using namespace Mantid::Kernel;
 
@@ -60,6 +61,10 @@ public:
     do_basic_test(new ThreadSchedulerLargestCost());
   }
 
+  void test_basic_ThreadSchedulerWorkStealing() {
+    do_basic_test(new ThreadSchedulerWorkStealing(4));
+  }
+
   //==================================================================================================
 
   void do_test(ThreadScheduler *sc, double *costs, size_t *poppedIndices) {
@@ -115,6 +120,37 @@ public:
     do_test(sc, costs, poppedIndices);
     delete sc;
   }
+
+  void test_ThreadSchedulerWorkStealing_single_queue_is_LIFO() {
+    ThreadScheduler *sc = new ThreadSchedulerWorkStealing(1);
+    double costs[4] = {0, 1, 2, 3};
+    size_t poppedIndices[4] = {3, 2, 1, 0};
+    do_test(sc, costs, poppedIndices);
+    delete sc;
+  }
+
+  void test_ThreadSchedulerWorkStealing_places_by_cost_and_steals() {
+    ThreadSchedulerWorkStealing sc(2);
+    TS_ASSERT_EQUALS(sc.numQueues(), 2);
+    // The expensive task goes on queue 0, the rest balance onto queue 1
+    TaskDoNothing *tasks[4] = {new TaskDoNothing(5.), new TaskDoNothing(1.),
+                               new TaskDoNothing(1.), new TaskDoNothing(1.)};
+    for (auto task : tasks)
+      sc.push(task);
+    TS_ASSERT_EQUALS(sc.size(), 4);
+    TS_ASSERT_DELTA(sc.totalCost(), 8., 1e-12);
+
+    // Thread 0 takes its own task, then steals the oldest from queue 1
+    TS_ASSERT_EQUALS(sc.pop(0), tasks[0]);
+    TS_ASSERT_EQUALS(sc.pop(0), tasks[1]);
+    // Thread 1 takes the newest from its own queue
+    TS_ASSERT_EQUALS(sc.pop(1), tasks[3]);
+    TS_ASSERT_EQUALS(sc.pop(3), tasks[2]);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT(!sc.pop(0));
+    for (auto task : tasks)
+      delete task;
+  }
 };
 
 #endif /* MANTID_KERNEL_THREADSCHEDULERTEST_H_ */
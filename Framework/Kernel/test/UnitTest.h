@@ -1390,7 +1390,54 @@ public:
     TS_ASSERT_EQUALS(degrees.unitID(), "Degrees");
   }
 
+  void test_multiple_conversions_match_single_conversions() {
+    for (const int emode : {0, 1, 2}) {
+      checkMultipleConversions(lambda, emode);
+      checkMultipleConversions(energy, emode);
+      checkMultipleConversions(energyk, emode);
+      checkMultipleConversions(d, emode);
+      checkMultipleConversions(q, emode);
+      checkMultipleConversions(k_i, emode);
+    }
+    for (const int emode : {1, 2}) {
+      checkMultipleConversions(dE, emode);
+      checkMultipleConversions(dEk, emode);
+      checkMultipleConversions(dEf, emode);
+    }
+    // Derived from Wavelength but not a multiple of it
+    checkMultipleConversions(delta, 0);
+    checkMultipleConversions(tau, 0);
+  }
+
 private:
+  /// Compare multipleToTOF/multipleFromTOF with singleToTOF/singleFromTOF,
+  /// including values where the conversions protect against division by zero
+  void checkMultipleConversions(Unit &unit, const int emode) {
+    unit.initialize(10.0, 1.5, 0.6, emode, 25.0, 0.0);
+    const std::vector<double> values{0.0,   0.5,    1.0,    2.5,   10.0,
+                                     100.0, 5000.0, 2.0e4, -3.0};
+    std::vector<double> out(values.size());
+    unit.multipleToTOF(values.data(), out.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+      checkSame(unit.unitID() + " toTOF", out[i],
+                unit.singleToTOF(values[i]));
+    // In place
+    out = values;
+    unit.multipleFromTOF(out.data(), out.data(), out.size());
+    for (size_t i = 0; i < values.size(); ++i)
+      checkSame(unit.unitID() + " fromTOF", out[i],
+                unit.singleFromTOF(values[i]));
+  }
+
+  void checkSame(const std::string &message, const double value,
+                 const double expected) {
+    if (std::isnan(expected)) {
+      TSM_ASSERT(message, std::isnan(value));
+    } else {
+      TSM_ASSERT_EQUALS(message, value, expected);
+    }
+  }
+
   Units::Label label;
   Units::TOF tof;
   Units::Wavelength lambda;
@@ -1409,4 +1456,46 @@ private:
   Units::Degrees degrees;
 };
 
+class UnitTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static UnitTestPerformance *createSuite() {
+    return new UnitTestPerformance();
+  }
+  static void destroySuite(UnitTestPerformance *suite) { delete suite; }
+
+  UnitTestPerformance() : m_values(10000000) {
+    for (size_t i = 0; i < m_values.size(); ++i)
+      m_values[i] = 1000.0 + static_cast<double>(i % 20000);
+    m_dSpacing.initialize(10.0, 1.5, 0.6, 0, 0.0, 0.0);
+    m_energy.initialize(10.0, 1.5, 0.6, 0, 0.0, 0.0);
+  }
+
+  void test_dSpacing_singleFromTOF() {
+    for (auto &value : m_values)
+      value = m_dSpacing.singleFromTOF(value);
+  }
+
+  void test_dSpacing_multipleFromTOF() {
+    m_dSpacing.multipleFromTOF(m_values.data(), m_values.data(),
+                               m_values.size());
+  }
+
+  void test_Energy_singleFromTOF() {
+    for (auto &value : m_values)
+      value = m_energy.singleFromTOF(value);
+  }
+
+  void test_Energy_multipleFromTOF() {
+    m_energy.multipleFromTOF(m_values.data(), m_values.data(),
+                             m_values.size());
+  }
+
+private:
+  std::vector<double> m_values;
+  Units::dSpacing m_dSpacing;
+  Units::Energy m_energy;
+};
+
 #endif /*UNITTEST_H_*/
@@ -105,8 +105,11 @@ private:
                                                          const int32_t *spec,
                                                          const int32_t *udet,
                                                          uint32_t length);
-  DataObjects::EventWorkspace_sptr
-  createBufferWorkspace(const DataObjects::EventWorkspace_sptr &parent);
+  std::vector<DataObjects::EventWorkspace_sptr>
+  allocateBufferWorkspaces() const;
+  void
+  initializeBufferWorkspace(const DataObjects::EventWorkspace_sptr &parent,
+                            DataObjects::EventWorkspace_sptr &buffer) const;
 
   /// Load a named instrument into a workspace
   void loadInstrument(const std::string &name,
@@ -123,7 +126,8 @@ private:
   void sampleDataFromMessage(const std::string &buffer);
 
   /// For LoadLiveData to extract the cached data
-  API::Workspace_sptr extractDataImpl();
+  API::Workspace_sptr
+  extractDataImpl(std::vector<DataObjects::EventWorkspace_sptr> buffers);
 
   /// Broker to use to subscribe to topics
   std::shared_ptr<IKafkaBroker> m_broker;
@@ -6,6 +6,7 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
@@ -22,6 +23,9 @@ GNU_DIAG_OFF("conversion")
 #include "private/Schema/is84_isis_events_generated.h"
 GNU_DIAG_ON("conversion")
 
+#include <algorithm>
+#include <numeric>
+
 using namespace Mantid::Types;
 
 namespace {
@@ -39,6 +43,10 @@ const std::string SAMPLE_MESSAGE_ID = "f142";
 
 const std::chrono::seconds MAX_LATENCY(1);
 
+/// Messages with at least this many events are added to the buffer by
+/// several threads, each filling a separate range of spectra
+constexpr size_t MIN_EVENTS_PARALLEL = 10000;
+
 /**
  * Append sample log data to existing log or create a new log if one with
  * specified name does not already exist
@@ -206,10 +214,14 @@ API::Workspace_sptr KafkaEventStreamDecoder::extractData() {
     throw std::runtime_error(*m_exception);
   }
 
+  // Allocate the new buffers before pausing the capture, so that it only
+  // waits for the buffers to be swapped
+  auto buffers = allocateBufferWorkspaces();
+
   m_extractWaiting = true;
   m_cv.notify_one();
 
-  auto workspace_ptr = extractDataImpl();
+  auto workspace_ptr = extractDataImpl(std::move(buffers));
 
   m_extractWaiting = false;
   m_cv.notify_one();
@@ -221,24 +233,32 @@ API::Workspace_sptr KafkaEventStreamDecoder::extractData() {
 // Private members
 // -----------------------------------------------------------------------------
 
-API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl() {
+/**
+ * Swap the filled buffers for new ones
+ * @param buffers Empty workspaces, allocated by allocateBufferWorkspaces(), to
+ * use as the new buffers
+ * @return The filled buffer, or a group of them if there are several periods
+ */
+API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl(
+    std::vector<DataObjects::EventWorkspace_sptr> buffers) {
   std::lock_guard<std::mutex> lock(m_mutex);
-  if (m_localEvents.size() == 1) {
-    auto temp = createBufferWorkspace(m_localEvents.front());
-    std::swap(m_localEvents.front(), temp);
-    return temp;
-  } else if (m_localEvents.size() > 1) {
-    auto group = boost::make_shared<API::WorkspaceGroup>();
-    size_t index(0);
-    for (auto &filledBuffer : m_localEvents) {
-      auto temp = createBufferWorkspace(filledBuffer);
-      std::swap(m_localEvents[index++], temp);
-      group->addWorkspace(temp);
-    }
-    return group;
-  } else {
+  if (m_localEvents.empty()) {
     throw Exception::NotYet("Local buffers not initialized.");
   }
+  // The buffers may have been recreated for a new run in the meantime
+  buffers.resize(m_localEvents.size());
+  for (size_t i = 0; i < m_localEvents.size(); ++i) {
+    initializeBufferWorkspace(m_localEvents[i], buffers[i]);
+    std::swap(m_localEvents[i], buffers[i]);
+  }
+  if (buffers.size() == 1) {
+    return buffers.front();
+  }
+  auto group = boost::make_shared<API::WorkspaceGroup>();
+  for (auto &filledBuffer : buffers) {
+    group->addWorkspace(filledBuffer);
+  }
+  return group;
 }
 
 /**
@@ -609,7 +629,35 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer) {
   DateAndTime pulseTime = static_cast<int64_t>(eventMsg->pulse_time());
   const auto &tofData = *(eventMsg->time_of_flight());
   const auto &detData = *(eventMsg->detector_id());
-  auto nEvents = tofData.size();
+  const size_t nEvents = tofData.size();
+  const bool parallel = nEvents >= MIN_EVENTS_PARALLEL;
+
+  // Decode the events before taking the lock on the buffers
+  std::vector<size_t> wsIndices(nEvents);
+  std::vector<double> tofs(nEvents);
+  PARALLEL_FOR_IF(parallel)
+  for (int64_t i = 0; i < static_cast<int64_t>(nEvents); ++i) {
+    const auto j = static_cast<flatbuffers::uoffset_t>(i);
+    const auto search = m_specToIdx.find(static_cast<int32_t>(detData[j]));
+    wsIndices[i] = search != m_specToIdx.end() ? search->second : 0;
+    // nanoseconds to microseconds
+    tofs[i] = static_cast<double>(tofData[j]) * 1e-3;
+  }
+
+  // Sort the events by range of spectra with a counting sort. The sort is
+  // stable, so the events of a spectrum stay in the order of the message.
+  const int nRanges = parallel ? PARALLEL_GET_MAX_THREADS : 1;
+  const size_t nIndices =
+      nEvents > 0 ? *std::max_element(wsIndices.begin(), wsIndices.end()) + 1
+                  : 0;
+  std::vector<size_t> rangeStart(nRanges + 1, 0);
+  for (const auto wsIndex : wsIndices)
+    ++rangeStart[wsIndex * nRanges / nIndices + 1];
+  std::partial_sum(rangeStart.begin(), rangeStart.end(), rangeStart.begin());
+  std::vector<size_t> order(nEvents);
+  auto next = rangeStart;
+  for (size_t i = 0; i < nEvents; ++i)
+    order[next[wsIndices[i] * nRanges / nIndices]++] = i;
 
   DataObjects::EventWorkspace_sptr periodBuffer;
   std::lock_guard<std::mutex> lock(m_mutex);
@@ -623,12 +671,14 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer) {
   } else {
     periodBuffer = m_localEvents[0];
   }
-  for (decltype(nEvents) i = 0; i < nEvents; ++i) {
-    auto &spectrum = periodBuffer->getSpectrum(
-        m_specToIdx[static_cast<int32_t>(detData[i])]);
-    spectrum.addEventQuickly(TofEvent(static_cast<double>(tofData[i]) *
-                                          1e-3, // nanoseconds to microseconds
-                                      pulseTime));
+  // Each thread adds the events of its own range of spectra
+  PARALLEL_FOR_IF(parallel)
+  for (int range = 0; range < nRanges; ++range) {
+    for (size_t j = rangeStart[range]; j < rangeStart[range + 1]; ++j) {
+      const size_t i = order[j];
+      periodBuffer->getSpectrum(wsIndices[i])
+          .addEventQuickly(TofEvent(tofs[i], pulseTime));
+    }
   }
 }
 
@@ -808,20 +858,46 @@ DataObjects::EventWorkspace_sptr KafkaEventStreamDecoder::createBufferWorkspace(
 }
 
 /**
- * Create new buffer workspace from an existing copy
+ * Allocate empty workspaces of the sizes of the current buffers
+ * @return A workspace for each of the current buffers
+ */
+std::vector<DataObjects::EventWorkspace_sptr>
+KafkaEventStreamDecoder::allocateBufferWorkspaces() const {
+  std::vector<size_t> nspectra;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &filledBuffer : m_localEvents)
+      nspectra.push_back(filledBuffer->getNumberHistograms());
+  }
+  std::vector<DataObjects::EventWorkspace_sptr> buffers;
+  buffers.reserve(nspectra.size());
+  for (const auto n : nspectra) {
+    buffers.push_back(boost::static_pointer_cast<DataObjects::EventWorkspace>(
+        API::WorkspaceFactory::Instance().create("EventWorkspace", n, 2, 1)));
+  }
+  return buffers;
+}
+
+/**
+ * Initialize a new buffer workspace from an existing copy
  * @param parent A pointer to an existing workspace
+ * @param buffer An empty workspace, replaced by a new one if it is null or
+ * does not have the size of the parent
  */
-DataObjects::EventWorkspace_sptr KafkaEventStreamDecoder::createBufferWorkspace(
-    const DataObjects::EventWorkspace_sptr &parent) {
-  auto buffer = boost::static_pointer_cast<DataObjects::EventWorkspace>(
-      API::WorkspaceFactory::Instance().create(
-          "EventWorkspace", parent->getNumberHistograms(), 2, 1));
+void KafkaEventStreamDecoder::initializeBufferWorkspace(
+    const DataObjects::EventWorkspace_sptr &parent,
+    DataObjects::EventWorkspace_sptr &buffer) const {
+  if (!buffer ||
+      buffer->getNumberHistograms() != parent->getNumberHistograms()) {
+    buffer = boost::static_pointer_cast<DataObjects::EventWorkspace>(
+        API::WorkspaceFactory::Instance().create(
+            "EventWorkspace", parent->getNumberHistograms(), 2, 1));
+  }
   // Copy meta data
   API::WorkspaceFactory::Instance().initializeFromParent(*parent, *buffer,
                                                          false);
   // Clear out the old logs, except for the most recent entry
   buffer->mutableRun().clearOutdatedTimeSeriesLogValues();
-  return buffer;
 }
 
 /**
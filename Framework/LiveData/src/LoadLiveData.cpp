@@ -1,10 +1,15 @@
 #include "MantidLiveData/LoadLiveData.h"
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/Workspace.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ReadLock.h"
+#include "MantidKernel/Unit.h"
 #include "MantidKernel/WriteLock.h"
 #include "MantidLiveData/Exception.h"
 
@@ -52,6 +57,54 @@ void copyInstrument(const API::Workspace *source, API::Workspace &target) {
     }
   }
 }
+
+/**
+ * Check whether a chunk of events can be added directly onto the accumulated
+ * events, i.e. whether Plus would accept the pair and keep the events.
+ *
+ * @param accumWS : The accumulation workspace
+ * @param chunkWS : The chunk of live data to add
+ * @return true if the events can be appended in place
+ */
+bool canAddEventsInPlace(const EventWorkspace &accumWS,
+                         const EventWorkspace &chunkWS) {
+  if (accumWS.getNumberHistograms() != chunkWS.getNumberHistograms() ||
+      accumWS.YUnit() != chunkWS.YUnit() ||
+      accumWS.isDistribution() != chunkWS.isDistribution())
+    return false;
+  const auto accumUnit = accumWS.getAxis(0)->unit();
+  const auto chunkUnit = chunkWS.getAxis(0)->unit();
+  return accumUnit && chunkUnit &&
+         accumUnit->unitID() == chunkUnit->unitID();
+}
+
+/**
+ * Append the events of a chunk onto the accumulation workspace in place.
+ * This does what Plus does for a pair of EventWorkspaces, without the
+ * overhead of running a child algorithm or copying the accumulated run logs
+ * every time a chunk arrives.
+ *
+ * @param accumWS : The accumulation workspace, modified in place
+ * @param chunkWS : The chunk of live data to add
+ */
+void addEventsInPlace(EventWorkspace &accumWS, const EventWorkspace &chunkWS) {
+  const auto &chunkSpectrumInfo = chunkWS.spectrumInfo();
+  auto &accumSpectrumInfo = accumWS.mutableSpectrumInfo();
+  const auto numHists = static_cast<int64_t>(accumWS.getNumberHistograms());
+  PARALLEL_FOR_IF(Kernel::threadSafe(accumWS, chunkWS))
+  for (int64_t i = 0; i < numHists; ++i) {
+    // Masked spectra are emptied, as in BinaryOperation
+    if ((accumSpectrumInfo.hasDetectors(i) && accumSpectrumInfo.isMasked(i)) ||
+        (chunkSpectrumInfo.hasDetectors(i) && chunkSpectrumInfo.isMasked(i))) {
+      accumWS.getSpectrum(i).clearData();
+      PARALLEL_CRITICAL(setMasked) { accumSpectrumInfo.setMasked(i, true); }
+    } else {
+      accumWS.getSpectrum(i) += chunkWS.getSpectrum(i);
+    }
+  }
+  accumWS.mutableRun() += chunkWS.run();
+  accumWS.clearMRU();
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -271,6 +324,16 @@ void LoadLiveData::addMatrixWSChunk(Workspace_sptr accumWS,
       accumMon += chunkMon;
   }
 
+  // Events are appended in place so the cost of each update depends only on
+  // the size of the chunk, not on how much data has been accumulated
+  auto accumEvents = boost::dynamic_pointer_cast<EventWorkspace>(accumWS);
+  auto chunkEvents = boost::dynamic_pointer_cast<EventWorkspace>(chunkWS);
+  if (accumEvents && chunkEvents &&
+      canAddEventsInPlace(*accumEvents, *chunkEvents)) {
+    addEventsInPlace(*accumEvents, *chunkEvents);
+    return;
+  }
+
   // Now do the main workspace
   IAlgorithm_sptr alg = this->createChildAlgorithm("Plus");
   alg->setProperty("LHSWorkspace", accumWS);
@@ -89,6 +89,49 @@ public:
     checkWorkspaceEventData(*eventWksp);
   }
 
+  void test_Large_Messages_Keep_Event_Order_In_Each_Spectrum() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    // Large enough to be added to the buffer by several threads
+    const size_t nEvents = 20000;
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeLargeISISEventSubscriber(nEvents)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = createTestDecoder(mockBroker);
+    startCapturing(*decoder, 2);
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder->extractData());
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+    TS_ASSERT(!decoder->isCapturing());
+
+    auto eventWksp = boost::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    TS_ASSERT_EQUALS(eventWksp->getNumberEvents() % nEvents, 0);
+    TS_ASSERT(eventWksp->getNumberEvents() >= 2 * nEvents);
+    // Each spectrum receives every fifth event of each message, in order
+    const size_t eventsPerSpectrum = nEvents / 5;
+    for (size_t i = 0; i < eventWksp->getNumberHistograms(); ++i) {
+      const auto &events = eventWksp->getSpectrum(i).getEvents();
+      for (size_t j = 0; j < events.size(); ++j) {
+        const auto k = j % eventsPerSpectrum;
+        const double tof = static_cast<double>(5 * k + i + 1);
+        if (events[j].tof() != tof) {
+          TS_FAIL("Events of spectrum " + std::to_string(i) +
+                  " are not in message order");
+          break;
+        }
+      }
+    }
+  }
+
   void test_Multiple_Period_Event_Stream() {
     using namespace ::testing;
     using namespace KafkaTesting;
@@ -502,4 +545,50 @@ private:
   uint8_t m_niterations = 0;
 };
 
+class KafkaEventStreamDecoderTestPerformance : public CxxTest::TestSuite {
+public:
+  static KafkaEventStreamDecoderTestPerformance *createSuite() {
+    return new KafkaEventStreamDecoderTestPerformance();
+  }
+  static void destroySuite(KafkaEventStreamDecoderTestPerformance *suite) {
+    delete suite;
+  }
+
+  void test_decode_large_event_messages() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using namespace Mantid::LiveData;
+
+    // 200 messages of 10^5 events
+    const size_t nEvents = 100000;
+    const uint8_t nMessages = 200;
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeLargeISISEventSubscriber(nEvents)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    KafkaEventStreamDecoder decoder(mockBroker, "", "", "", "");
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint8_t niterations = 0;
+    decoder.registerIterationEndCb([&]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (niterations < nMessages && ++niterations == nMessages)
+        condition.notify_one();
+    });
+    decoder.startCapture();
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&]() { return niterations == nMessages; });
+    }
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder.extractData());
+    decoder.stopCapture();
+    TS_ASSERT(workspace);
+  }
+};
+
 #endif /* MANTID_LIVEDATA_KAFKAEVENTSTREAMDECODERTEST_H_ */
@@ -150,6 +150,31 @@ void fakeReceiveAnISISEventMessage(std::string *buffer, int32_t nextPeriod) {
                  builder.GetSize());
 }
 
+void fakeReceiveALargeISISEventMessage(std::string *buffer, size_t nEvents) {
+  flatbuffers::FlatBufferBuilder builder;
+  // Spread the events over the 5 spectra, in increasing time of flight
+  std::vector<uint32_t> spec(nEvents);
+  std::vector<uint32_t> tof(nEvents);
+  for (size_t i = 0; i < nEvents; ++i) {
+    spec[i] = static_cast<uint32_t>(i % 5 + 1);
+    tof[i] = static_cast<uint32_t>(1000 * (i + 1));
+  }
+
+  uint64_t frameTime = 1;
+  float protonCharge(0.5f);
+
+  auto messageFlatbuf = CreateEventMessage(
+      builder, builder.CreateString("KafkaTesting"), 0, frameTime,
+      builder.CreateVector(tof), builder.CreateVector(spec),
+      FacilityData_ISISData,
+      CreateISISData(builder, 0, RunState_RUNNING, protonCharge).Union());
+  FinishEventMessageBuffer(builder, messageFlatbuf);
+
+  // Copy to provided buffer
+  buffer->assign(reinterpret_cast<const char *>(builder.GetBufferPointer()),
+                 builder.GetSize());
+}
+
 void fakeReceiveAnEventMessage(std::string *buffer) {
   flatbuffers::FlatBufferBuilder builder;
   std::vector<uint32_t> spec = {5, 4, 3};
@@ -263,6 +288,52 @@ private:
   int32_t m_nextPeriod;
 };
 
+// -----------------------------------------------------------------------------
+// Fake ISIS event stream sending the same large event message repeatedly
+// -----------------------------------------------------------------------------
+class FakeLargeISISEventSubscriber
+    : public Mantid::LiveData::IKafkaStreamSubscriber {
+public:
+  explicit FakeLargeISISEventSubscriber(size_t nEvents) {
+    fakeReceiveALargeISISEventMessage(&m_message, nEvents);
+  }
+  void subscribe() override {}
+  void subscribe(int64_t offset) override { UNUSED_ARG(offset) }
+  void consumeMessage(std::string *message, int64_t &offset, int32_t &partition,
+                      std::string &topic) override {
+    assert(message);
+
+    *message = m_message;
+
+    UNUSED_ARG(offset);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(topic);
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>>
+  getOffsetsForTimestamp(int64_t timestamp) override {
+    UNUSED_ARG(timestamp);
+    return {
+        std::pair<std::string, std::vector<int64_t>>("topic_name", {1, 2, 3})};
+  }
+
+  std::unordered_map<std::string, std::vector<int64_t>>
+  getCurrentOffsets() override {
+    std::unordered_map<std::string, std::vector<int64_t>> offsets;
+    return offsets;
+  }
+
+  void seek(const std::string &topic, uint32_t partition,
+            int64_t offset) override {
+    UNUSED_ARG(topic);
+    UNUSED_ARG(partition);
+    UNUSED_ARG(offset);
+  }
+
+private:
+  std::string m_message;
+};
+
 // ---------------------------------------------------------------------------------------
 // Fake non-institution-specific event stream to provide event and sample
 // environment data
@@ -170,6 +170,19 @@ public:
     TS_ASSERT(ws2->monitorWorkspace());
   }
 
+  //--------------------------------------------------------------------------------------------
+  void test_add_keeps_masking_and_logs() {
+    auto ws1 = doExec<EventWorkspace>("Add");
+    ws1->mutableSpectrumInfo().setMasked(0, true);
+
+    auto ws2 = doExec<EventWorkspace>("Add");
+    TSM_ASSERT("Workspace being added stayed the same pointer", ws1 == ws2);
+    TS_ASSERT(ws2->spectrumInfo().isMasked(0));
+    TS_ASSERT_EQUALS(ws2->getSpectrum(0).getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(ws2->getSpectrum(1).getNumberEvents(), 200);
+    TS_ASSERT_EQUALS(ws2->run().getProperty("run_number")->value(), "999");
+  }
+
   //--------------------------------------------------------------------------------------------
   void test_add_DontPreserveEvents() {
     Workspace2D_sptr ws1, ws2;
@@ -67,9 +67,24 @@ private:
   // the public Matrix WS interface
   DataObjects::EventWorkspace_const_sptr m_EventWS;
 
-  /**function converts particular type of events into MD space and add these
-   * events to the workspace itself    */
-  template <class T> size_t convertEventList(size_t workspaceIndex);
+  /// MD events converted from one spectrum and not yet added to the workspace
+  struct MDEventsBuffer {
+    std::vector<coord_t> allCoord;   // MD events coordinates
+    std::vector<float> sigErr;       // signal and error of each event
+    std::vector<uint16_t> runIndex;  // run index of each event
+    std::vector<uint32_t> detIDs;    // detector ID of each event
+  };
+
+  /**function converts particular type of events into MD space and stores
+   * them in the buffer provided    */
+  template <class T>
+  void convertEventList(size_t workspaceIndex, MDTransfInterface &qConverter,
+                        MDEventsBuffer &buffer) const;
+  /// converts the events of one spectrum into the buffer provided
+  void convertSpectrum(size_t workspaceIndex, MDTransfInterface &qConverter,
+                       MDEventsBuffer &buffer) const;
+  /// adds the buffered events to the target workspace and clears the buffer
+  size_t addEvents(MDEventsBuffer &buffer);
 };
 
 } // namespace MDAlgorithms
@@ -1,10 +1,12 @@
 #include "MantidMDAlgorithms/BinMD.h"
 #include "MantidAPI/ImplicitFunctionFactory.h"
+#include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/CoordTransformAffineParser.h"
 #include "MantidDataObjects/CoordTransformAligned.h"
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDBoxBase.h"
+#include "MantidDataObjects/MDBoxPrefetcher.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
@@ -23,6 +25,11 @@ namespace MDAlgorithms {
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(BinMD)
 
+namespace {
+/// Number of events transformed and binned together by BinMD::binMDBox
+constexpr size_t EVENTS_BLOCK_SIZE = 1024;
+} // namespace
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::Geometry;
@@ -174,43 +181,58 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
 
   // If you get here, you could not determine that the entire box was in the
   // same bin.
-  // So you need to iterate through events.
+  // So you need to iterate through events. They are transformed and binned a
+  // block at a time, with the coordinates stored one dimension after the other
+  // so that the transformation and the bin indices are computed in vectorised
+  // loops over the events.
   const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
-    // Cache the center of the event (again for speed)
-    const coord_t *inCenter = it->getCenter();
+  const size_t blockSize = std::min(events.size(), EVENTS_BLOCK_SIZE);
+  std::vector<coord_t> inColumns(nd * blockSize);
+  std::vector<coord_t> outColumns(m_outD * blockSize);
+  std::vector<size_t> linearIndices(blockSize);
+  std::vector<char> inRange(blockSize);
+  for (size_t first = 0; first < events.size(); first += blockSize) {
+    const size_t numInBlock = std::min(blockSize, events.size() - first);
+    // Transpose the centers of the events into the columns
+    for (size_t i = 0; i < numInBlock; ++i) {
+      const coord_t *inCenter = events[first + i].getCenter();
+      for (size_t d = 0; d < nd; ++d)
+        inColumns[d * blockSize + i] = inCenter[d];
+    }
 
     // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter);
-
-    // To build up the linear index
-    size_t linearIndex = 0;
-    // To mark events outside range
-    bool badOne = false;
+    m_transform->applyToColumns(inColumns.data(), outColumns.data(),
+                                numInBlock, blockSize);
 
-    /// Loop through the dimensions on which we bin
+    // Build up the linear index, marking events outside range
+    std::fill_n(linearIndices.begin(), numInBlock, 0);
+    std::fill_n(inRange.begin(), numInBlock, 1);
     for (size_t bd = 0; bd < m_outD; bd++) {
-      // What is the bin index in that dimension
-      coord_t x = outCenter[bd];
-      size_t ix = size_t(x);
-      // Within range (for this chunk)?
-      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-        // Build up the linear index
-        linearIndex += indexMultiplier[bd] * ix;
-      } else {
-        // Outside the range
-        badOne = true;
-        break;
+      const coord_t *outColumn = outColumns.data() + bd * blockSize;
+      const size_t multiplier = indexMultiplier[bd];
+      const size_t min = chunkMin[bd];
+      const size_t max = chunkMax[bd];
+      for (size_t i = 0; i < numInBlock; ++i) {
+        // What is the bin index in that dimension
+        const coord_t x = outColumn[i];
+        const size_t ix = size_t(x);
+        // Within range (for this chunk)?
+        inRange[i] &= static_cast<char>((x >= 0) && (ix >= min) && (ix < max));
+        linearIndices[i] += multiplier * ix;
       }
     } // (for each dim in MDHisto)
 
-    if (!badOne) {
-      // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[linearIndex] += 1.0;
+    for (size_t i = 0; i < numInBlock; ++i) {
+      if (inRange[i]) {
+        const MDE &event = events[first + i];
+        const size_t linearIndex = linearIndices[i];
+        // Sum the signals as doubles to preserve precision
+        signals[linearIndex] += static_cast<signal_t>(event.getSignal());
+        errors[linearIndex] += static_cast<signal_t>(event.getErrorSquared());
+        // TODO: If DataObjects get a weight, this would need to get the summed
+        // weight.
+        numEvents[linearIndex] += 1.0;
+      }
     }
   }
   // Done with the events list
@@ -327,9 +349,17 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
       }
 
+      // Read the events of the next boxes in the background while binning
+      std::unique_ptr<MDBoxPrefetcher> prefetcher;
+      if (bc->isFileBacked())
+        prefetcher = make_unique<MDBoxPrefetcher>(
+            boxes, bc->getFileIO()->getWriteBufferSize());
+
       // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
+      for (size_t i = 0; i < boxes.size(); ++i) {
+        if (prefetcher)
+          prefetcher->advanceTo(i);
+        MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
           this->binMDBox(box, chunkMin.data(), chunkMax.data());
@@ -345,6 +375,14 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
 
+    if (auto nexusIO = dynamic_cast<BoxControllerNeXusIO *>(bc->getFileIO())) {
+      const auto statistics = nexusIO->getPrefetchStatistics();
+      g_log.information() << "Boxes loaded from events read ahead: "
+                          << statistics.hits << ", loaded from the file: "
+                          << statistics.misses << ", read ahead but not used: "
+                          << statistics.discarded << "\n";
+    }
+
     // Now the implicit function
     if (implicitFunction) {
       if (prog)
@@ -2,18 +2,26 @@
 
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include "MantidKernel/MultiThreaded.h"
+
+#include <exception>
+
 namespace Mantid {
 namespace MDAlgorithms {
-/**function converts particular list of events of type T into MD workspace and
- * adds these events to the workspace itself  */
+/**function converts particular list of events of type T into MD space and
+ * stores the resulting MD events in the buffer provided.
+ * Safe to call from several threads at once, as long as each thread uses its
+ * own Q converter and buffer. */
 template <class T>
-size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
+void ConvToMDEventsWS::convertEventList(size_t workspaceIndex,
+                                        MDTransfInterface &qConverter,
+                                        MDEventsBuffer &buffer) const {
 
   const Mantid::DataObjects::EventList &el =
       m_EventWS->getSpectrum(workspaceIndex);
   size_t numEvents = el.getNumberEvents();
   if (numEvents == 0)
-    return 0;
+    return;
 
   // create local unit conversion class
   UnitsConversionHelper localUnitConv(m_UnitConversion);
@@ -24,21 +32,15 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   std::vector<coord_t> locCoord(m_Coord);
   // set up unit conversion and calculate up all coordinates, which depend on
   // spectra index only
-  if (!m_QConverter->calcYDepCoordinates(locCoord, workspaceIndex))
-    return 0; // skip if any y outsize of the range of interest;
+  if (!qConverter.calcYDepCoordinates(locCoord, workspaceIndex))
+    return; // skip if any y outsize of the range of interest;
   localUnitConv.updateConversion(workspaceIndex);
   //
   // allocate temporary buffers for MD Events data
-  // MD events coordinates buffer
-  std::vector<coord_t> allCoord;
-  std::vector<float> sig_err;      // array for signal and error.
-  std::vector<uint16_t> run_index; // Buffer for run index for each event
-  std::vector<uint32_t> det_ids;   // Buffer of det Id-s for each event
-
-  allCoord.reserve(this->m_NDims * numEvents);
-  sig_err.reserve(2 * numEvents);
-  run_index.reserve(numEvents);
-  det_ids.reserve(numEvents);
+  buffer.allCoord.reserve(this->m_NDims * numEvents);
+  buffer.sigErr.reserve(2 * numEvents);
+  buffer.runIndex.reserve(numEvents);
+  buffer.detIDs.reserve(numEvents);
 
   // This little dance makes the getting vector of events more general (since
   // you can't overload by return type).
@@ -51,42 +53,61 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
     double val = localUnitConv.convertUnits(it->tof());
     double signal = it->weight();
     double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+    if (!qConverter.calcMatrixCoord(val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
-    sig_err.push_back(static_cast<float>(signal));
-    sig_err.push_back(static_cast<float>(errorSq));
-    run_index.push_back(runIndexLoc);
-    det_ids.push_back(detID);
-    allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+    buffer.sigErr.push_back(static_cast<float>(signal));
+    buffer.sigErr.push_back(static_cast<float>(errorSq));
+    buffer.runIndex.push_back(runIndexLoc);
+    buffer.detIDs.push_back(detID);
+    buffer.allCoord.insert(buffer.allCoord.end(), locCoord.begin(),
+                           locCoord.end());
   }
-
-  // Add them to the MDEW
-  size_t n_added_events = run_index.size();
-  m_OutWSWrapper->addMDData(sig_err, run_index, det_ids, allCoord,
-                            n_added_events);
-  return n_added_events;
 }
 
-/** The method runs conversion for a single event list, corresponding to a
- * particular workspace index */
-size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+/** The method converts the events of a single event list, corresponding to a
+ * particular workspace index, into the buffer provided */
+void ConvToMDEventsWS::convertSpectrum(size_t workspaceIndex,
+                                       MDTransfInterface &qConverter,
+                                       MDEventsBuffer &buffer) const {
 
   switch (m_EventWS->getSpectrum(workspaceIndex).getEventType()) {
   case Mantid::API::TOF:
-    return this->convertEventList<Mantid::Types::Event::TofEvent>(
-        workspaceIndex);
+    this->convertEventList<Mantid::Types::Event::TofEvent>(workspaceIndex,
+                                                           qConverter, buffer);
+    break;
   case Mantid::API::WEIGHTED:
-    return this->convertEventList<Mantid::DataObjects::WeightedEvent>(
-        workspaceIndex);
+    this->convertEventList<Mantid::DataObjects::WeightedEvent>(
+        workspaceIndex, qConverter, buffer);
+    break;
   case Mantid::API::WEIGHTED_NOTIME:
-    return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(
-        workspaceIndex);
+    this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(
+        workspaceIndex, qConverter, buffer);
+    break;
   default:
     throw std::runtime_error("EventList had an unexpected data type!");
   }
 }
 
+/** Add the events stored in the buffer to the MDEW and release the buffer
+ * memory
+ * @return the number of events added */
+size_t ConvToMDEventsWS::addEvents(MDEventsBuffer &buffer) {
+  size_t n_added_events = buffer.runIndex.size();
+  m_OutWSWrapper->addMDData(buffer.sigErr, buffer.runIndex, buffer.detIDs,
+                            buffer.allCoord, n_added_events);
+  buffer = MDEventsBuffer();
+  return n_added_events;
+}
+
+/** The method runs conversion for a single event list, corresponding to a
+ * particular workspace index */
+size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+  MDEventsBuffer buffer;
+  this->convertSpectrum(workspaceIndex, *m_QConverter, buffer);
+  return this->addEvents(buffer);
+}
+
 /** method sets up all internal variables necessary to convert from Event
 Workspace to MDEvent workspace
 @param WSD         -- the class describing the target MD workspace, sorurce
@@ -149,31 +170,68 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   if (!m_QConverter->calcGenericVariables(m_Coord, m_NDims))
     return;
 
+  // The spectra are converted into MD events in parallel, a block at a time,
+  // each thread using its own copy of the Q converter. The converted events
+  // are then added to the workspace in spectrum order, so the contents of the
+  // boxes do not depend on the number of threads.
+  // Reading the spectra may load lazily loaded banks or switch events stored
+  // in columns back to rows, so the workspace must allow concurrent access.
+  const bool parallelConversion =
+      runMultithreaded && Kernel::threadSafe(*m_EventWS);
+  int nConverters = 1;
+  if (parallelConversion)
+    nConverters = m_NumThreads > 0 ? m_NumThreads : PARALLEL_GET_MAX_THREADS;
+  std::vector<MDTransf_sptr> qConverters(nConverters);
+  for (auto &qConverter : qConverters)
+    qConverter.reset(m_QConverter->clone());
+  const size_t blockSize = 16 * static_cast<size_t>(nConverters);
+  std::vector<MDEventsBuffer> buffers(std::min(blockSize, nValidSpectra));
+
   size_t eventsAdded = 0;
-  for (size_t wi = 0; wi < nValidSpectra; wi++) {
-
-    size_t nConverted = this->conversionChunk(wi);
-    eventsAdded += nConverted;
-    nEventsInWS += nConverted;
-    // Keep a running total of how many events we've added
-    if (bc->shouldSplitBoxes(nEventsInWS, eventsAdded, lastNumBoxes)) {
-      if (runMultithreaded) {
-        // Now do all the splitting tasks
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
-        if (ts->size() > 0)
-          tp.joinAll();
-      } else {
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(
-            nullptr); // it is done this way as it is possible trying to do
-                      // single
-                      // threaded split more efficiently
+  for (size_t blockStart = 0; blockStart < nValidSpectra;
+       blockStart += blockSize) {
+    const size_t blockEnd = std::min(blockStart + blockSize, nValidSpectra);
+    const auto nBlockSpectra = static_cast<int>(blockEnd - blockStart);
+    std::vector<std::exception_ptr> errors(nBlockSpectra);
+    PRAGMA_OMP(parallel for if (parallelConversion) num_threads(nConverters))
+    for (int i = 0; i < nBlockSpectra; ++i) {
+      try {
+        this->convertSpectrum(blockStart + i,
+                              *qConverters[PARALLEL_THREAD_NUMBER], buffers[i]);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+    for (const auto &error : errors) {
+      if (error)
+        std::rethrow_exception(error);
+    }
+
+    for (size_t wi = blockStart; wi < blockEnd; wi++) {
+
+      size_t nConverted = this->addEvents(buffers[wi - blockStart]);
+      eventsAdded += nConverted;
+      nEventsInWS += nConverted;
+      // Keep a running total of how many events we've added
+      if (bc->shouldSplitBoxes(nEventsInWS, eventsAdded, lastNumBoxes)) {
+        if (runMultithreaded) {
+          // Now do all the splitting tasks
+          m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
+          if (ts->size() > 0)
+            tp.joinAll();
+        } else {
+          m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(
+              nullptr); // it is done this way as it is possible trying to do
+                        // single
+                        // threaded split more efficiently
+        }
+        // Count the new # of boxes.
+        lastNumBoxes = m_OutWSWrapper->pWorkspace()
+                           ->getBoxController()
+                           ->getTotalNumMDBoxes();
+        eventsAdded = 0;
+        pProgress->report(wi);
       }
-      // Count the new # of boxes.
-      lastNumBoxes = m_OutWSWrapper->pWorkspace()
-                         ->getBoxController()
-                         ->getTotalNumMDBoxes();
-      eventsAdded = 0;
-      pProgress->report(wi);
     }
   }
   // Do a final splitting of everything
@@ -21,6 +21,11 @@ namespace MDAlgorithms {
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(SliceMD)
 
+namespace {
+/// Number of events transformed together by SliceMD::slice
+constexpr size_t EVENTS_BLOCK_SIZE = 1024;
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Initialize the algorithm's properties.
  */
@@ -205,21 +210,38 @@ void SliceMD::slice(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 
       const std::vector<MDE> &events = box->getConstEvents();
 
-      for (auto it = events.cbegin(); it != events.cend(); ++it) {
-        // Cache the center of the event (again for speed)
-        const coord_t *inCenter = it->getCenter();
-
-        if (function->isPointContained(inCenter)) {
-          // Now transform to the output dimensions
-          m_transformFromOriginal->apply(inCenter, outCenter);
-
-          // Create the event
-          OMDE newEvent(it->getSignal(), it->getErrorSquared(), outCenter);
-          // Copy extra data, if any
-          copyEvent(*it, newEvent);
-          // Add it to the workspace
-          if (outRootBox->addEvent(newEvent))
-            numSinceSplit++;
+      // The events are transformed a block at a time, with the coordinates
+      // stored one dimension after the other so that the transformation is
+      // vectorised over the events.
+      const size_t blockSize = std::min(events.size(), EVENTS_BLOCK_SIZE);
+      std::vector<coord_t> inColumns(nd * blockSize);
+      std::vector<coord_t> outColumns(ond * blockSize);
+      for (size_t first = 0; first < events.size(); first += blockSize) {
+        const size_t numInBlock = std::min(blockSize, events.size() - first);
+        for (size_t j = 0; j < numInBlock; ++j) {
+          const coord_t *inCenter = events[first + j].getCenter();
+          for (size_t d = 0; d < nd; ++d)
+            inColumns[d * blockSize + j] = inCenter[d];
+        }
+        // Now transform to the output dimensions
+        m_transformFromOriginal->applyToColumns(
+            inColumns.data(), outColumns.data(), numInBlock, blockSize);
+
+        for (size_t j = 0; j < numInBlock; ++j) {
+          const MDE &event = events[first + j];
+          if (function->isPointContained(event.getCenter())) {
+            for (size_t d = 0; d < ond; ++d)
+              outCenter[d] = outColumns[d * blockSize + j];
+
+            // Create the event
+            OMDE newEvent(event.getSignal(), event.getErrorSquared(),
+                          outCenter);
+            // Copy extra data, if any
+            copyEvent(event, newEvent);
+            // Add it to the workspace
+            if (outRootBox->addEvent(newEvent))
+              numSinceSplit++;
+          }
         }
       }
       box->releaseEvents();
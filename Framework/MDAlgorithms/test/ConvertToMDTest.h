@@ -309,6 +309,36 @@ public:
                       Mantid::API::NoNormalization);
   }
 
+  void test_parallel_and_serial_event_conversion_give_identical_boxes() {
+    auto alg = Mantid::API::AlgorithmManager::Instance().create(
+        "CreateSampleWorkspace");
+    alg->initialize();
+    alg->setChild(true);
+    alg->setProperty("WorkspaceType", "Event");
+    alg->setPropertyValue("OutputWorkspace", "dummy");
+    alg->execute();
+    Mantid::API::MatrixWorkspace_sptr ws = alg->getProperty("OutputWorkspace");
+    ws->mutableRun().addProperty("Ei", 12.0, true);
+
+    // NUM_THREADS = 0 converts serially, a positive value sets the threads
+    auto serialWS = convertEventsWithThreads(ws, 0.);
+    auto parallelWS = convertEventsWithThreads(ws, 4.);
+    TS_ASSERT_EQUALS(serialWS->getNPoints(), parallelWS->getNPoints());
+
+    auto compare = Mantid::API::AlgorithmManager::Instance().create(
+        "CompareMDWorkspaces");
+    compare->initialize();
+    compare->setChild(true);
+    compare->setProperty("Workspace1", serialWS);
+    compare->setProperty("Workspace2", parallelWS);
+    compare->setProperty("CheckEvents", true);
+    compare->setProperty("IgnoreBoxID", true);
+    compare->execute();
+    TS_ASSERT(compare->isExecuted());
+    const bool equals = compare->getProperty("Equals");
+    TSM_ASSERT(compare->getPropertyValue("Result"), equals);
+  }
+
   void testInitialSplittingDisabled() {
     Mantid::API::MatrixWorkspace_sptr ws2D =
         AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
@@ -545,6 +575,28 @@ private:
     }
   }
 
+  IMDEventWorkspace_sptr
+  convertEventsWithThreads(const Mantid::API::MatrixWorkspace_sptr &ws,
+                           const double numThreads) {
+    ws->mutableRun().addProperty("NUM_THREADS", numThreads, true);
+    ConvertToMD convertAlg;
+    convertAlg.setChild(true);
+    convertAlg.initialize();
+    convertAlg.setPropertyValue("OutputWorkspace", "dummy");
+    convertAlg.setProperty("InputWorkspace", ws);
+    convertAlg.setProperty("QDimensions", "Q3D");
+    convertAlg.setProperty("dEAnalysisMode", "Direct");
+    convertAlg.setPropertyValue("MinValues", "-10,-10,-10, 0");
+    convertAlg.setPropertyValue("MaxValues", " 10, 10, 10, 1");
+    // Split often so box splitting happens while the events are added
+    convertAlg.setPropertyValue("SplitInto", "2");
+    convertAlg.setPropertyValue("SplitThreshold", "100");
+    convertAlg.setPropertyValue("MaxRecursionDepth", "6");
+    convertAlg.execute();
+    TS_ASSERT(convertAlg.isExecuted());
+    return convertAlg.getProperty("OutputWorkspace");
+  }
+
   bool findValue(const PropertyAllowedValues &container,
                  const std::string &value) {
     return std::find(container.begin(), container.end(), value) !=
@@ -734,6 +786,62 @@ public:
         boost::lexical_cast<std::string>(sec) + " sec");
   }
 
+  void test_EventNoUnitsConv_accumulate_200_runs() {
+    // A rotation scan: many small runs appended to the same MD workspace
+    const size_t nRuns = 200;
+    const size_t nRunHist = 1000;
+    auto runWs = boost::dynamic_pointer_cast<MatrixWorkspace>(
+        WorkspaceCreationHelper::createRandomEventWorkspace(50, nRunHist,
+                                                            0.1));
+    runWs->setInstrument(
+        ComponentCreationHelper::createTestInstrumentCylindrical(
+            int(nRunHist)));
+    runWs->mutableRun().addProperty("Ei", 12., "meV", true);
+    NumericAxis *pAxis0 = new NumericAxis(2);
+    pAxis0->setUnit("DeltaE");
+    runWs->replaceAxis(0, pAxis0);
+    API::AnalysisDataService::Instance().addOrReplace("TestRunWS", runWs);
+
+    PreprocessDetectorsToMD preprocess;
+    preprocess.initialize();
+    preprocess.setPropertyValue("InputWorkspace", "TestRunWS");
+    preprocess.setPropertyValue("OutputWorkspace", "RunDetectorsTable");
+    preprocess.execute();
+    auto pDetLoc_run = API::AnalysisDataService::Instance()
+                           .retrieveWS<DataObjects::TableWorkspace>(
+                               "RunDetectorsTable");
+
+    MDWSDescription WSD;
+    std::vector<double> min(4, -1e+30), max(4, 1e+30);
+    WSD.setMinMax(min, max);
+    WSD.buildFromMatrixWS(runWs, "Q3D", "Indirect");
+    WSD.m_PreprDetTable = pDetLoc_run;
+    WSD.m_RotMatrix = Rot;
+
+    pTargWS->releaseWorkspace();
+    pTargWS->createEmptyMDWS(WSD);
+
+    ConvToMDSelector AlgoSelector;
+    pConvMethods = AlgoSelector.convSelector(runWs, pConvMethods);
+
+    std::time(&start);
+    for (size_t run = 0; run < nRuns; ++run) {
+      WSD.addProperty("RUN_INDEX", static_cast<uint16_t>(run), true);
+      pConvMethods->initialize(WSD, pTargWS, false);
+      pMockAlgorithm->resetProgress(nRunHist);
+      TS_ASSERT_THROWS_NOTHING(
+          pConvMethods->runConversion(pMockAlgorithm->getProgress()));
+    }
+    std::time(&end);
+    double sec = std::difftime(end, start);
+    TS_WARN("Time to accumulate " + std::to_string(nRuns) +
+            " runs: <EventWSType,Q3D,Indir,ConvertNo,CrystType>: " +
+            boost::lexical_cast<std::string>(sec) + " sec");
+
+    API::AnalysisDataService::Instance().remove("TestRunWS");
+    API::AnalysisDataService::Instance().remove("RunDetectorsTable");
+  }
+
   ConvertToMDTestPerformance() : Rot(3, 3) {
     numHist = 100 * 100;
     size_t nEvents = 1000;
@@ -22,6 +22,10 @@ DLLExport int getNexusEntryTypes(const std::string &fileName,
                                  std::vector<std::string> &entryName,
                                  std::vector<std::string> &definition);
 
+/// Number of rows of a data set that are stored in one compressed chunk
+DLLExport int rowsPerNexusChunk(const size_t nRows, const size_t rowLength,
+                                const size_t elementSize = sizeof(double));
+
 /** @class NexusFileIO NexusFileIO.h NeXus/NexusFileIO.h
 
 Utility method for saving NeXus format of Mantid Workspace
@@ -1,5 +1,7 @@
 // NexusFileIO
 // @author Ronald Fowler
+#include <functional>
+#include <numeric>
 #include <sstream>
 #include <vector>
 
@@ -34,6 +36,39 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+
+/// Size in bytes of the compressed chunks of the data sets. It matches the
+/// default chunk cache of HDF5, so reading a chunk in several slabs only
+/// decompresses it once.
+constexpr size_t CHUNK_BYTES = 1024 * 1024;
+
+/**
+ * Write the rows of the open 2D data set in blocks of rows. The rows of a
+ * block are copied into one buffer and written as one slab.
+ * @param fileID :: Handle of the file with the open data set
+ * @param nRows :: Number of rows of the data set
+ * @param rowLength :: Number of values in each row
+ * @param blockRows :: Number of rows written by each slab
+ * @param row :: Returns a pointer to the values of the given row
+ */
+template <typename RowAccess>
+void writeRowBlocks(NXhandle fileID, const size_t nRows,
+                    const size_t rowLength, const size_t blockRows,
+                    const RowAccess &row) {
+  std::vector<double> buffer(blockRows * rowLength);
+  int start[2] = {0, 0};
+  int size[2] = {0, static_cast<int>(rowLength)};
+  for (size_t first = 0; first < nRows; first += blockRows) {
+    const size_t nBlock = std::min(blockRows, nRows - first);
+    for (size_t i = 0; i < nBlock; ++i) {
+      const double *values = row(first + i);
+      std::copy(values, values + rowLength, buffer.begin() + i * rowLength);
+    }
+    start[0] = static_cast<int>(first);
+    size[0] = static_cast<int>(nBlock);
+    NXputslab(fileID, buffer.data(), start, size);
+  }
+}
 } // namespace
 
 /// Empty default constructor
@@ -337,8 +372,9 @@ int NexusFileIO::writeNexusProcessedData2D(
     for (size_t i = 0; i < sAxis->length(); i++)
       axis2.push_back((*sAxis)(i));
 
-  int start[2] = {0, 0};
-  int asize[2] = {1, dims_array[1]};
+  // Each compressed chunk holds a block of spectra
+  const int chunkRows = rowsPerNexusChunk(nSpect, nSpectBins);
+  int asize[2] = {chunkRows, dims_array[1]};
 
   // -------------- Actually write the 2D data ----------------------------
   if (write2Ddata) {
@@ -346,11 +382,10 @@ int NexusFileIO::writeNexusProcessedData2D(
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->y(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    writeRowBlocks(fileID, nSpect, nSpectBins, chunkRows,
+                   [&](const size_t i) {
+                     return localworkspace->y(spec[i]).rawData().data();
+                   });
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
     int signal = 1;
@@ -372,12 +407,10 @@ int NexusFileIO::writeNexusProcessedData2D(
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
-    start[0] = 0;
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->e(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    writeRowBlocks(fileID, nSpect, nSpectBins, chunkRows,
+                   [&](const size_t i) {
+                     return localworkspace->e(spec[i]).rawData().data();
+                   });
 
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
@@ -390,31 +423,29 @@ int NexusFileIO::writeNexusProcessedData2D(
       NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                      m_nexuscompression, asize);
       NXopendata(fileID, name.c_str());
-      start[0] = 0;
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, rebin_workspace->readF(s).data(), start, asize);
-        start[0]++;
-      }
+      writeRowBlocks(fileID, nSpect, nSpectBins, chunkRows,
+                     [&](const size_t i) {
+                       return rebin_workspace->readF(spec[i]).data();
+                     });
       if (m_progress != nullptr)
         m_progress->reportIncrement(1, "Writing data");
     }
 
     // Potentially x error
     if (localworkspace->hasDx(0)) {
+      const size_t dxLength = localworkspace->dx(0).size();
       dims_array[0] = static_cast<int>(nSpect);
-      dims_array[1] = static_cast<int>(localworkspace->dx(0).size());
+      dims_array[1] = static_cast<int>(dxLength);
+      asize[0] = rowsPerNexusChunk(nSpect, dxLength);
+      asize[1] = dims_array[1];
       std::string dxErrorName = "xerrors";
       NXcompmakedata(fileID, dxErrorName.c_str(), NX_FLOAT64, 2, dims_array,
                      m_nexuscompression, asize);
       NXopendata(fileID, dxErrorName.c_str());
-      start[0] = 0;
-      asize[1] = dims_array[1];
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, localworkspace->dx(s).rawData().data(), start, asize);
-        start[0]++;
-      }
+      writeRowBlocks(fileID, nSpect, dxLength, asize[0],
+                     [&](const size_t i) {
+                       return localworkspace->dx(spec[i]).rawData().data();
+                     });
     }
 
     NXclosedata(fileID);
@@ -432,12 +463,11 @@ int NexusFileIO::writeNexusProcessedData2D(
     dims_array[1] = static_cast<int>(localworkspace->x(0).size());
     NXmakedata(fileID, "axis1", NX_FLOAT64, 2, dims_array);
     NXopendata(fileID, "axis1");
-    start[0] = 0;
-    asize[1] = dims_array[1];
-    for (size_t i = 0; i < nSpect; i++) {
-      NXputslab(fileID, localworkspace->x(i).rawData().data(), start, asize);
-      start[0]++;
-    }
+    const size_t xLength = localworkspace->x(0).size();
+    writeRowBlocks(fileID, nSpect, xLength, rowsPerNexusChunk(nSpect, xLength),
+                   [&](const size_t i) {
+                     return localworkspace->x(i).rawData().data();
+                   });
   }
 
   std::string dist = (localworkspace->isDistribution()) ? "1" : "0";
@@ -741,9 +771,10 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
   // The array of indices for each event list #
   int dims_array[1] = {static_cast<int>(indices.size())};
   if (!indices.empty()) {
+    int chunk[1] = {rowsPerNexusChunk(indices.size(), 1)};
     if (compress)
       NXcompmakedata(fileID, "indices", NX_INT64, 1, dims_array,
-                     m_nexuscompression, dims_array);
+                     m_nexuscompression, chunk);
     else
       NXmakedata(fileID, "indices", NX_INT64, 1, dims_array);
     NXopendata(fileID, "indices");
@@ -803,9 +834,14 @@ void NexusFileIO::NXwritedata(const char *name, int datatype, int rank,
                               int *dims_array, void *data,
                               bool compress) const {
   if (compress) {
-    // We'll use the same slab/buffer size as the size of the array
+    // Compress the array in chunks of whole rows of a bounded size, rather
+    // than as one chunk that has to be (de)compressed all at once
+    std::vector<int> chunk(dims_array, dims_array + rank);
+    const auto rowLength = std::accumulate(
+        chunk.begin() + 1, chunk.end(), size_t(1), std::multiplies<size_t>());
+    chunk[0] = rowsPerNexusChunk(dims_array[0], rowLength);
     NXcompmakedata(fileID, name, datatype, rank, dims_array, m_nexuscompression,
-                   dims_array);
+                   chunk.data());
   } else {
     // Write uncompressed.
     NXmakedata(fileID, name, datatype, rank, dims_array);
@@ -1224,6 +1260,23 @@ template <> std::string NexusFileIO::logValueType<bool>() const {
   return "bool";
 }
 
+/**
+ * Number of rows of a data set that are stored in one compressed chunk. The
+ * chunks hold whole rows and are about CHUNK_BYTES in size, so that neither
+ * the per-chunk overhead of HDF5 for short rows nor the decompression of a
+ * whole large data set to read part of it dominate.
+ * @param nRows :: Number of rows of the data set
+ * @param rowLength :: Number of values in each row
+ * @param elementSize :: Size in bytes of a value
+ * @return The number of rows in a chunk, at least 1 and at most nRows
+ */
+int rowsPerNexusChunk(const size_t nRows, const size_t rowLength,
+                      const size_t elementSize) {
+  const size_t rowBytes = std::max(rowLength * elementSize, size_t(1));
+  const size_t rows = std::max(CHUNK_BYTES / rowBytes, size_t(1));
+  return static_cast<int>(std::min(rows, std::max(nRows, size_t(1))));
+}
+
 /** Get all the Nexus entry types for a file
  *
  * Try to open named Nexus file and return all entries plus the definition found
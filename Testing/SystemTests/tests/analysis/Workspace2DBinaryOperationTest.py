@@ -0,0 +1,52 @@
+#pylint: disable=no-init,attribute-defined-outside-init
+import stresstesting
+from mantid.api import WorkspaceFactory
+from mantid.simpleapi import Multiply, Plus, mtd
+
+
+class Workspace2DBinaryOperationMixin(object):
+    '''Runs a binary operation on two workspaces with 10^5 spectra of 10^4
+    bins'''
+
+    NSPECTRA = 100000
+    NBINS = 10000
+
+    def requiredMemoryMB(self):
+        # X, Y and E of both operands plus Y and E of the result
+        return 65000
+
+    def excludeInPullRequests(self):
+        return True
+
+    def runTest(self):
+        for name in ['lhs', 'rhs']:
+            mtd.addOrReplace(name, WorkspaceFactory.create(
+                "Workspace2D", self.NSPECTRA, self.NBINS + 1, self.NBINS))
+        self.operation(LHSWorkspace='lhs', RHSWorkspace='rhs',
+                       OutputWorkspace='out')
+
+    def validate(self):
+        out = mtd['out']
+        return (out.getNumberHistograms() == self.NSPECTRA and
+                out.blocksize() == self.NBINS)
+
+    def cleanup(self):
+        for name in ['lhs', 'rhs', 'out']:
+            if name in mtd:
+                mtd.remove(name)
+
+
+class Workspace2DPlusTest(Workspace2DBinaryOperationMixin,
+                          stresstesting.MantidStressTest):
+    '''Times adding two workspaces with 10^5 spectra of 10^4 bins'''
+
+    def operation(self, **kwargs):
+        Plus(**kwargs)
+
+
+class Workspace2DMultiplyTest(Workspace2DBinaryOperationMixin,
+                              stresstesting.MantidStressTest):
+    '''Times multiplying two workspaces with 10^5 spectra of 10^4 bins'''
+
+    def operation(self, **kwargs):
+        Multiply(**kwargs)
@@ -0,0 +1,26 @@
+#pylint: disable=no-init,attribute-defined-outside-init
+import stresstesting
+from mantid.api import WorkspaceFactory
+
+
+class Workspace2DExtractYTest(stresstesting.MantidStressTest):
+    '''Times extracting the values of a workspace with 10^5 spectra of 10^4
+    bins into one numpy array'''
+
+    NSPECTRA = 100000
+    NBINS = 10000
+
+    def requiredMemoryMB(self):
+        # X, Y and E of the workspace plus the extracted array
+        return 33000
+
+    def excludeInPullRequests(self):
+        return True
+
+    def runTest(self):
+        ws = WorkspaceFactory.create("Workspace2D", self.NSPECTRA,
+                                     self.NBINS + 1, self.NBINS)
+        self.y = ws.extractY()
+
+    def validate(self):
+        return self.y.shape == (self.NSPECTRA, self.NBINS)